@@ -0,0 +1,188 @@
+/*******************************************************************************
+【文件名】 AffineTransformer.cpp
+【功能模块和目的】 实现AffineTransformer类，在按分量存放的坐标数组上并行变换
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <thread>
+#include <vector>
+#include "AffineTransformer.hpp"
+#include "../Models/IndexedModel.hpp"
+
+//每个线程至少变换的点数
+static const std::size_t MinPointsPerWorker = 1 << 14;
+
+/*******************************************************************************
+【函数名称】 AffineTransformer
+【函数功能】 构造函数
+【参数】
+    - std::size_t WorkerCount（输入参数）：线程数，为0时取硬件线程数
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+AffineTransformer::AffineTransformer(std::size_t WorkerCount):
+    m_WorkerCount(WorkerCount != 0 ? WorkerCount
+        : std::max<std::size_t>(1, std::thread::hardware_concurrency())) {}
+
+/*******************************************************************************
+【函数名称】 Transform
+【函数功能】 为模型的点对象建立索引后按分量取出坐标；各线程对自己那一段先在三个
+数组上原地计算x' = m0·x + m1·y + m2·z + m3等，再交错写入新坐标数组；最后由
+Model::TransformPoints写回点对象并换算面属性缓存
+【参数】
+    - Model<3>& Model（输入输出参数）：模型
+    - const std::array<double, 16>& Matrix（输入参数）：4×4仿射矩阵，按行存放
+【返回值】 TransformReport：变换结果
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+TransformReport AffineTransformer::Transform(Model<3>& Model,
+    const std::array<double, 16>& Matrix) const {
+    auto Start = std::chrono::steady_clock::now();
+    TransformReport Report{};
+    Report.Determinant = Determinant(Matrix);
+    IndexedModel<3> Indexed(Model);
+    const std::size_t Count = Indexed.Points.size();
+    Report.PointCount = Count;
+    std::vector<double> X(Count);
+    std::vector<double> Y(Count);
+    std::vector<double> Z(Count);
+    std::vector<double> Positions(Count * 3);
+    auto Work = [&](std::size_t First, std::size_t Last) {
+        for (std::size_t i = First; i < Last; i++) {
+            X[i] = Indexed.Points[i]->GetCoordinate(0);
+            Y[i] = Indexed.Points[i]->GetCoordinate(1);
+            Z[i] = Indexed.Points[i]->GetCoordinate(2);
+        }
+        const double M00 = Matrix[0], M01 = Matrix[1], M02 = Matrix[2];
+        const double M03 = Matrix[3], M10 = Matrix[4], M11 = Matrix[5];
+        const double M12 = Matrix[6], M13 = Matrix[7], M20 = Matrix[8];
+        const double M21 = Matrix[9], M22 = Matrix[10], M23 = Matrix[11];
+        double* PX = X.data();
+        double* PY = Y.data();
+        double* PZ = Z.data();
+        for (std::size_t i = First; i < Last; i++) {
+            const double x = PX[i];
+            const double y = PY[i];
+            const double z = PZ[i];
+            PX[i] = M00 * x + M01 * y + M02 * z + M03;
+            PY[i] = M10 * x + M11 * y + M12 * z + M13;
+            PZ[i] = M20 * x + M21 * y + M22 * z + M23;
+        }//矩阵元素取到局部变量中，循环体只有连续的读写与乘加
+        for (std::size_t i = First; i < Last; i++) {
+            Positions[3 * i] = X[i];
+            Positions[3 * i + 1] = Y[i];
+            Positions[3 * i + 2] = Z[i];
+        }
+    };
+    std::size_t Workers = std::max<std::size_t>(1,
+        std::min(m_WorkerCount, Count / MinPointsPerWorker));
+    std::vector<std::thread> Threads;
+    for (std::size_t w = 1; w < Workers; w++) {
+        Threads.emplace_back(Work, Count * w / Workers,
+            Count * (w + 1) / Workers);
+    }
+    Work(0, Count / Workers);
+    for (auto& Thread: Threads) {
+        Thread.join();
+    }
+    Model.TransformPoints(Indexed.Points, Positions, Matrix.data());
+    Report.Seconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - Start).count();
+    return Report;
+}
+
+/*******************************************************************************
+【函数名称】 Determinant
+【函数功能】 按第一行展开求左上3×3部分的行列式
+【参数】
+    - const std::array<double, 16>& Matrix（输入参数）：4×4仿射矩阵，按行存放
+【返回值】 double：行列式
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+double AffineTransformer::Determinant(const std::array<double, 16>& Matrix) {
+    auto L = [&Matrix](std::size_t Row, std::size_t Column) {
+        return Matrix[Row * 4 + Column];
+    };
+    return L(0, 0) * (L(1, 1) * L(2, 2) - L(1, 2) * L(2, 1))
+        - L(0, 1) * (L(1, 0) * L(2, 2) - L(1, 2) * L(2, 0))
+        + L(0, 2) * (L(1, 0) * L(2, 1) - L(1, 1) * L(2, 0));
+}
+
+/*******************************************************************************
+【函数名称】 Translation
+【函数功能】 构造平移矩阵
+【参数】
+    - double X（输入参数）：x方向的平移量
+    - double Y（输入参数）：y方向的平移量
+    - double Z（输入参数）：z方向的平移量
+【返回值】 std::array<double, 16>：4×4矩阵，按行存放
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+std::array<double, 16> AffineTransformer::Translation(double X, double Y,
+    double Z) {
+    return { 1, 0, 0, X,
+             0, 1, 0, Y,
+             0, 0, 1, Z,
+             0, 0, 0, 1 };
+}
+
+/*******************************************************************************
+【函数名称】 Scaling
+【函数功能】 构造沿坐标轴缩放的矩阵
+【参数】
+    - double X（输入参数）：x方向的倍数
+    - double Y（输入参数）：y方向的倍数
+    - double Z（输入参数）：z方向的倍数
+【返回值】 std::array<double, 16>：4×4矩阵，按行存放
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+std::array<double, 16> AffineTransformer::Scaling(double X, double Y,
+    double Z) {
+    return { X, 0, 0, 0,
+             0, Y, 0, 0,
+             0, 0, Z, 0,
+             0, 0, 0, 1 };
+}
+
+/*******************************************************************************
+【函数名称】 Rotation
+【函数功能】 构造绕坐标轴旋转的矩阵。角度为90的整数倍时正弦与余弦取精确值，
+使这类旋转仍是坐标轴之间的交换，面属性缓存的包围盒可以直接换算
+【参数】
+    - std::size_t Axis（输入参数）：旋转轴，0、1、2分别为x、y、z轴，其他值视为z轴
+    - double Degrees（输入参数）：旋转角（度），从轴的正方向看为逆时针
+【返回值】 std::array<double, 16>：4×4矩阵，按行存放
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+std::array<double, 16> AffineTransformer::Rotation(std::size_t Axis,
+    double Degrees) {
+    double Cosine = std::cos(Degrees * std::acos(-1.0) / 180);
+    double Sine = std::sin(Degrees * std::acos(-1.0) / 180);
+    double Quarters = Degrees / 90;
+    if (std::isfinite(Quarters) && Quarters == std::floor(Quarters)) {
+        const double Exact[4][2] = { { 1, 0 }, { 0, 1 }, { -1, 0 }, { 0, -1 } };
+        long long Index = static_cast<long long>(std::fmod(Quarters, 4.0));
+        Index = (Index + 4) % 4;
+        Cosine = Exact[Index][0];
+        Sine = Exact[Index][1];
+    }
+    std::size_t U = Axis == 0 ? 1 : Axis == 1 ? 2 : 0;//旋转平面的两个轴，
+    std::size_t V = Axis == 0 ? 2 : Axis == 1 ? 0 : 1;//U转向V为正方向
+    std::array<double, 16> Matrix = Scaling(1, 1, 1);
+    Matrix[U * 4 + U] = Cosine;
+    Matrix[U * 4 + V] = -Sine;
+    Matrix[V * 4 + U] = Sine;
+    Matrix[V * 4 + V] = Cosine;
+    return Matrix;
+}
@@ -0,0 +1,85 @@
+/*******************************************************************************
+【文件名】 AffineTransformer.hpp
+【功能模块和目的】 定义AffineTransformer类与TransformReport结构体，对模型的所有点
+一次性施加仿射变换（平移、旋转、缩放及一般的仿射矩阵）
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+#ifndef AFFINE_TRANSFORMER_HPP
+#define AFFINE_TRANSFORMER_HPP
+
+#include <array>
+#include <cstddef>
+#include "../Models/Model.hpp"
+
+/*******************************************************************************
+【结构体名】 TransformReport
+【功能】 结构体，表示一次变换的结果
+【接口说明】
+    - std::size_t PointCount
+        变换的点数（不同的点对象数）
+    - double Determinant
+        线性部分的行列式，即体积的缩放倍数，为负时模型被镜像
+    - double Seconds
+        变换的耗时（秒）
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+struct TransformReport {
+    std::size_t PointCount;
+    double Determinant;
+    double Seconds;
+};
+
+/*******************************************************************************
+【类名】 AffineTransformer
+【功能】 仿射变换器。按点对象建立索引（不焊接，共享关系原样保留），把各点的坐标
+按x、y、z分开取出到三个连续的数组中，各线程分段在数组上做同一个无分支的乘加
+循环，编译器可以将其向量化；再由Model::TransformPoints原地写回点对象，并按矩阵
+换算面属性缓存，而不是让其全部失效后重新计算。矩阵为4×4、按行存放，
+最后一行不被读取，视为(0, 0, 0, 1)
+【接口说明】
+    - AffineTransformer(std::size_t WorkerCount = 0)
+        构造函数，WorkerCount为0时取硬件线程数
+    - const std::size_t& WorkerCount
+        线程数
+    - TransformReport Transform(Model<3>& Model,
+        const std::array<double, 16>& Matrix) const
+        变换模型的所有点
+    - static double Determinant(const std::array<double, 16>& Matrix)
+        线性部分的行列式，为0时变换会把模型压扁，不应使用
+    - static std::array<double, 16> Translation(double X, double Y, double Z)
+        平移矩阵
+    - static std::array<double, 16> Scaling(double X, double Y, double Z)
+        沿坐标轴缩放的矩阵
+    - static std::array<double, 16> Rotation(std::size_t Axis, double Degrees)
+        绕x（0）、y（1）或z（2）轴按右手定则旋转的矩阵
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+class AffineTransformer {
+    public:
+        explicit AffineTransformer(std::size_t WorkerCount = 0);
+        AffineTransformer(const AffineTransformer& Other) = delete;
+        AffineTransformer& operator=(const AffineTransformer& Other) = delete;
+
+        const std::size_t& WorkerCount { m_WorkerCount };
+
+        //变换模型
+        TransformReport Transform(Model<3>& Model,
+            const std::array<double, 16>& Matrix) const;
+        //线性部分的行列式
+        static double Determinant(const std::array<double, 16>& Matrix);
+        //平移矩阵
+        static std::array<double, 16> Translation(double X, double Y, double Z);
+        //缩放矩阵
+        static std::array<double, 16> Scaling(double X, double Y, double Z);
+        //旋转矩阵
+        static std::array<double, 16> Rotation(std::size_t Axis,
+            double Degrees);
+
+    private:
+        std::size_t m_WorkerCount;
+};
+
+#endif // AFFINE_TRANSFORMER_HPP
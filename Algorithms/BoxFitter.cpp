@@ -0,0 +1,586 @@
+/*******************************************************************************
+【文件名】 BoxFitter.cpp
+【功能模块和目的】 实现BoxFitter类，主成分包围盒与旋转卡壳最小体积包围盒
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <thread>
+#include <vector>
+#include "BoxFitter.hpp"
+#include "ConvexHull.hpp"
+#include "../Models/IndexedModel.hpp"
+
+typedef std::array<double, 3> Vector3;
+typedef std::array<double, 2> Vector2;
+
+//所有候选方向的投影点数之和的上限，决定凸包面很多时分桶的数目
+static const std::size_t CandidateWorkBudget = 1 << 23;
+//每维分桶数的上限
+static const std::size_t MaxBinsPerAxis = 32;
+//局部搜索的最小步长（切平面上的偏移量，约为弧度）
+static const double MinRefineStep = 1e-4;
+//预筛选凸包顶点时使用的方向数
+static const std::size_t FilterDirections = 16;
+//局部搜索的最多轮数
+static const std::size_t MaxRefineRounds = 32;
+//局部搜索的最少轮数
+static const std::size_t MinRefineRounds = 4;
+//每个线程至少处理的投影点数
+static const std::size_t MinWorkPerWorker = 1 << 16;
+
+/*******************************************************************************
+【结构体名】 Candidate
+【功能】 结构体，表示一个候选法向的求解结果
+【接口说明】
+    - double Volume
+        包围盒体积
+    - Vector3 Axes[3]
+        包围盒的三条轴，最后一条为候选法向
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+struct Candidate {
+    double Volume;
+    Vector3 Axes[3];
+};
+
+/*******************************************************************************
+【函数名称】 Dot
+【函数功能】 三维向量点积
+【参数】
+    - const Vector3& A（输入参数）：第一个向量
+    - const Vector3& B（输入参数）：第二个向量
+【返回值】 double：A · B
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+static double Dot(const Vector3& A, const Vector3& B) {
+    return A[0] * B[0] + A[1] * B[1] + A[2] * B[2];
+}
+
+/*******************************************************************************
+【函数名称】 Cross
+【函数功能】 三维向量叉积
+【参数】
+    - const Vector3& A（输入参数）：第一个向量
+    - const Vector3& B（输入参数）：第二个向量
+【返回值】 Vector3：A × B
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+static Vector3 Cross(const Vector3& A, const Vector3& B) {
+    return { A[1] * B[2] - A[2] * B[1],
+        A[2] * B[0] - A[0] * B[2],
+        A[0] * B[1] - A[1] * B[0] };
+}
+
+/*******************************************************************************
+【函数名称】 Normalize
+【函数功能】 把向量缩放为单位向量，零向量保持不变
+【参数】
+    - const Vector3& V（输入参数）：向量
+【返回值】 Vector3：单位向量
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+static Vector3 Normalize(const Vector3& V) {
+    double Length = std::sqrt(Dot(V, V));
+    if (!(Length > 0)) {
+        return V;
+    }
+    return { V[0] / Length, V[1] / Length, V[2] / Length };
+}
+
+/*******************************************************************************
+【函数名称】 Perpendicular
+【函数功能】 取一个与单位向量垂直的单位向量
+【参数】
+    - const Vector3& N（输入参数）：单位向量
+【返回值】 Vector3：与N垂直的单位向量
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+static Vector3 Perpendicular(const Vector3& N) {
+    Vector3 Helper = std::fabs(N[0]) < 0.6 ? Vector3 { 1, 0, 0 }
+        : Vector3 { 0, 1, 0 };
+    return Normalize(Cross(N, Helper));
+}
+
+/*******************************************************************************
+【函数名称】 SymmetricEigenvectors
+【函数功能】 用循环Jacobi迭代求3×3对称矩阵的特征向量
+【参数】
+    - double Matrix[3][3]（输入参数）：对称矩阵，会被改写
+    - Vector3* Vectors（输出参数）：3个单位特征向量，彼此正交
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+static void SymmetricEigenvectors(double Matrix[3][3], Vector3* Vectors) {
+    double V[3][3] = { { 1, 0, 0 }, { 0, 1, 0 }, { 0, 0, 1 } };
+    for (std::size_t Sweep = 0; Sweep < 50; Sweep++) {
+        double OffDiagonal = Matrix[0][1] * Matrix[0][1]
+            + Matrix[0][2] * Matrix[0][2] + Matrix[1][2] * Matrix[1][2];
+        if (OffDiagonal == 0) {
+            break;
+        }
+        for (std::size_t p = 0; p < 2; p++) {
+            for (std::size_t q = p + 1; q < 3; q++) {
+                if (Matrix[p][q] == 0) {
+                    continue;
+                }
+                double Theta = (Matrix[q][q] - Matrix[p][p])
+                    / (2 * Matrix[p][q]);
+                double T = (Theta >= 0 ? 1 : -1)
+                    / (std::fabs(Theta) + std::sqrt(Theta * Theta + 1));
+                double C = 1 / std::sqrt(T * T + 1);
+                double S = T * C;
+                for (std::size_t k = 0; k < 3; k++) {
+                    double Kp = Matrix[k][p];
+                    double Kq = Matrix[k][q];
+                    Matrix[k][p] = C * Kp - S * Kq;
+                    Matrix[k][q] = S * Kp + C * Kq;
+                }
+                for (std::size_t k = 0; k < 3; k++) {
+                    double Pk = Matrix[p][k];
+                    double Qk = Matrix[q][k];
+                    Matrix[p][k] = C * Pk - S * Qk;
+                    Matrix[q][k] = S * Pk + C * Qk;
+                }
+                for (std::size_t k = 0; k < 3; k++) {
+                    double Kp = V[k][p];
+                    double Kq = V[k][q];
+                    V[k][p] = C * Kp - S * Kq;
+                    V[k][q] = S * Kp + C * Kq;
+                }
+            }
+        }
+    }
+    for (std::size_t i = 0; i < 3; i++) {
+        Vectors[i] = Normalize({ V[0][i], V[1][i], V[2][i] });
+    }//特征向量是V的列
+}
+
+/*******************************************************************************
+【函数名称】 BoxFromAxes
+【函数功能】 求以给定正交轴为方向、包住所有点的最小包围盒，轴按边长从大到小排列
+【参数】
+    - const std::vector<Vector3>& Points（输入参数）：点集
+    - const Vector3* Axes（输入参数）：3条互相垂直的单位轴
+【返回值】 OrientedBox：包围盒
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+static OrientedBox BoxFromAxes(const std::vector<Vector3>& Points,
+    const Vector3* Axes) {
+    double Min[3];
+    double Max[3];
+    std::fill(Min, Min + 3, std::numeric_limits<double>::max());
+    std::fill(Max, Max + 3, std::numeric_limits<double>::lowest());
+    for (const Vector3& P: Points) {
+        for (std::size_t i = 0; i < 3; i++) {
+            double Projection = Dot(P, Axes[i]);
+            Min[i] = std::min(Min[i], Projection);
+            Max[i] = std::max(Max[i], Projection);
+        }
+    }
+    std::size_t Order[3] = { 0, 1, 2 };
+    std::sort(Order, Order + 3, [&](std::size_t A, std::size_t B) {
+        return Max[A] - Min[A] > Max[B] - Min[B];
+    });
+    OrientedBox Box = {};
+    Box.Volume = 1;
+    for (std::size_t i = 0; i < 3; i++) {
+        std::size_t Axis = Order[i];
+        double Middle = (Min[Axis] + Max[Axis]) / 2;
+        for (std::size_t k = 0; k < 3; k++) {
+            Box.Axes[i][k] = Axes[Axis][k];
+            Box.Center[k] += Middle * Axes[Axis][k];
+        }
+        Box.Extents[i] = Max[Axis] - Min[Axis];
+        Box.Volume *= Box.Extents[i];
+    }
+    return Box;
+}
+
+/*******************************************************************************
+【函数名称】 DiscardInterior
+【函数功能】 Akl-Toussaint预筛选：取均匀分布的若干方向上的极值点构成凸多边形，
+删去严格在其内部的点，它们不可能是凸包顶点。投影点大多落在该多边形内，可大大
+减少排序的点数
+【参数】
+    - std::vector<Vector2>& Points（输入输出参数）：点集
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+static void DiscardInterior(std::vector<Vector2>& Points) {
+    if (Points.size() < 4 * FilterDirections) {
+        return;
+    }
+    //按逆时针排列的方向
+    double Directions[FilterDirections][2];
+    for (std::size_t d = 0; d < FilterDirections; d++) {
+        double Angle = 2 * std::acos(-1.0) * d / FilterDirections;
+        Directions[d][0] = std::cos(Angle);
+        Directions[d][1] = std::sin(Angle);
+    }
+    std::size_t Extremes[FilterDirections] = {};
+    for (std::size_t p = 1; p < Points.size(); p++) {
+        for (std::size_t d = 0; d < FilterDirections; d++) {
+            const Vector2& Best = Points[Extremes[d]];
+            if (Points[p][0] * Directions[d][0] + Points[p][1]
+                * Directions[d][1] > Best[0] * Directions[d][0]
+                + Best[1] * Directions[d][1]) {
+                Extremes[d] = p;
+            }
+        }
+    }
+    std::vector<Vector2> Polygon;
+    for (std::size_t d = 0; d < FilterDirections; d++) {
+        const Vector2& P = Points[Extremes[d]];
+        if (Polygon.empty() || (P != Polygon.back() && P != Polygon[0])) {
+            Polygon.push_back(P);
+        }
+    }
+    if (Polygon.size() < 3) {
+        return;
+    }
+    auto IsInterior = [&](const Vector2& P) {
+        for (std::size_t i = 0; i < Polygon.size(); i++) {
+            const Vector2& A = Polygon[i];
+            const Vector2& B = Polygon[(i + 1) % Polygon.size()];
+            if ((B[0] - A[0]) * (P[1] - A[1])
+                - (B[1] - A[1]) * (P[0] - A[0]) <= 0) {
+                return false;
+            }
+        }
+        return true;
+    };
+    Points.erase(std::remove_if(Points.begin(), Points.end(), IsInterior),
+        Points.end());
+}
+
+/*******************************************************************************
+【函数名称】 PlanarHull
+【函数功能】 用单调链算法求二维凸包，结果按逆时针排列且不含共线的点
+【参数】
+    - std::vector<Vector2>& Points（输入参数）：点集，会被排序
+【返回值】 std::vector<Vector2>：凸包顶点
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+static std::vector<Vector2> PlanarHull(std::vector<Vector2>& Points) {
+    std::sort(Points.begin(), Points.end());
+    Points.erase(std::unique(Points.begin(), Points.end()), Points.end());
+    if (Points.size() < 3) {
+        return Points;
+    }
+    auto Turn = [](const Vector2& O, const Vector2& A, const Vector2& B) {
+        return (A[0] - O[0]) * (B[1] - O[1]) - (A[1] - O[1]) * (B[0] - O[0]);
+    };
+    std::vector<Vector2> Hull(2 * Points.size());
+    std::size_t Size = 0;
+    for (std::size_t i = 0; i < Points.size(); i++) {
+        while (Size >= 2 && Turn(Hull[Size - 2], Hull[Size - 1], Points[i])
+            <= 0) {
+            Size--;
+        }
+        Hull[Size++] = Points[i];
+    }//下凸壳
+    for (std::size_t i = Points.size() - 1, Lower = Size + 1; i > 0; i--) {
+        while (Size >= Lower
+            && Turn(Hull[Size - 2], Hull[Size - 1], Points[i - 1]) <= 0) {
+            Size--;
+        }
+        Hull[Size++] = Points[i - 1];
+    }//上凸壳
+    Hull.resize(Size - 1);//最后一个点与第一个点重复
+    return Hull;
+}
+
+/*******************************************************************************
+【函数名称】 MinAreaRectangle
+【函数功能】 用旋转卡壳求凸多边形的最小面积外接矩形。最小矩形必有一边与多边形的
+某条边共线；依次以每条边为底，沿边方向的最大、最小投影点与离边最远的点随之单调
+前进，因此总共只需线性时间
+【参数】
+    - const std::vector<Vector2>& Hull（输入参数）：逆时针排列的凸多边形
+    - Vector2* Direction（输出参数）：最小矩形一边的单位方向
+【返回值】 double：最小面积
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+static double MinAreaRectangle(const std::vector<Vector2>& Hull,
+    Vector2* Direction) {
+    const std::size_t Size = Hull.size();
+    *Direction = { 1, 0 };
+    if (Size < 3) {
+        if (Size == 2) {
+            double DX = Hull[1][0] - Hull[0][0];
+            double DY = Hull[1][1] - Hull[0][1];
+            double Length = std::sqrt(DX * DX + DY * DY);
+            *Direction = { DX / Length, DY / Length };
+        }
+        return 0;
+    }
+    double Best = std::numeric_limits<double>::max();
+    std::size_t Right = 0;
+    std::size_t Top = 0;
+    std::size_t Left = 0;
+    for (std::size_t i = 0; i < Size; i++) {
+        const Vector2& Origin = Hull[i];
+        const Vector2& Next = Hull[(i + 1) % Size];
+        double DX = Next[0] - Origin[0];
+        double DY = Next[1] - Origin[1];
+        double Length = std::sqrt(DX * DX + DY * DY);
+        DX /= Length;
+        DY /= Length;
+        //沿边方向与指向多边形内侧的法向上的投影
+        auto Along = [&](std::size_t k) {
+            const Vector2& P = Hull[k % Size];
+            return (P[0] - Origin[0]) * DX + (P[1] - Origin[1]) * DY;
+        };
+        auto Across = [&](std::size_t k) {
+            const Vector2& P = Hull[k % Size];
+            return (P[1] - Origin[1]) * DX - (P[0] - Origin[0]) * DY;
+        };
+        if (i == 0) {
+            for (std::size_t k = 1; k < Size; k++) {
+                Right = Along(k) > Along(Right) ? k : Right;
+                Top = Across(k) > Across(Top) ? k : Top;
+                Left = Along(k) < Along(Left) ? k : Left;
+            }
+        }
+        else {
+            for (std::size_t Steps = 0; Steps < Size
+                && Along(Right + 1) >= Along(Right); Steps++) {
+                Right = (Right + 1) % Size;
+            }
+            for (std::size_t Steps = 0; Steps < Size
+                && Across(Top + 1) >= Across(Top); Steps++) {
+                Top = (Top + 1) % Size;
+            }
+            for (std::size_t Steps = 0; Steps < Size
+                && Along(Left + 1) <= Along(Left); Steps++) {
+                Left = (Left + 1) % Size;
+            }
+        }
+        double Area = (Along(Right) - Along(Left)) * Across(Top);
+        if (Area < Best) {
+            Best = Area;
+            *Direction = { DX, DY };
+        }
+    }
+    return Best;
+}
+
+/*******************************************************************************
+【函数名称】 Evaluate
+【函数功能】 以给定方向为一条轴，求其余两条轴使包围盒体积最小
+【参数】
+    - const std::vector<Vector3>& Points（输入参数）：点集
+    - const Vector3& Normal（输入参数）：单位方向
+【返回值】 Candidate：体积与三条轴
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+static Candidate Evaluate(const std::vector<Vector3>& Points,
+    const Vector3& Normal) {
+    Vector3 U = Perpendicular(Normal);
+    Vector3 V = Cross(Normal, U);
+    std::vector<Vector2> Projected(Points.size());
+    double Low = std::numeric_limits<double>::max();
+    double High = std::numeric_limits<double>::lowest();
+    for (std::size_t p = 0; p < Points.size(); p++) {
+        Projected[p] = { Dot(Points[p], U), Dot(Points[p], V) };
+        Low = std::min(Low, Dot(Points[p], Normal));
+        High = std::max(High, Dot(Points[p], Normal));
+    }
+    DiscardInterior(Projected);
+    Vector2 Direction;
+    double Area = MinAreaRectangle(PlanarHull(Projected), &Direction);
+    Candidate Result;
+    Result.Volume = Area * (High - Low);
+    for (std::size_t k = 0; k < 3; k++) {
+        Result.Axes[0][k] = Direction[0] * U[k] + Direction[1] * V[k];
+    }
+    Result.Axes[1] = Cross(Normal, Result.Axes[0]);
+    Result.Axes[2] = Normal;
+    return Result;
+}
+
+/*******************************************************************************
+【函数名称】 BoxFitter
+【函数功能】 构造函数
+【参数】
+    - std::size_t WorkerCount（输入参数）：线程数，为0时取硬件线程数
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+BoxFitter::BoxFitter(std::size_t WorkerCount):
+    m_WorkerCount(WorkerCount != 0 ? WorkerCount
+        : std::max<std::size_t>(1, std::thread::hardware_concurrency())) {}
+
+/*******************************************************************************
+【函数名称】 Fit
+【函数功能】 求凸包，由凸包顶点求主成分包围盒；收集坐标轴、主成分轴与分桶后的
+凸包面法向，多线程逐个求解，再在最优方向附近局部搜索
+【参数】
+    - const Model<3>& Model（输入参数）：模型
+【返回值】 BoxReport：计算结果
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+BoxReport BoxFitter::Fit(const Model<3>& Model) const {
+    BoxReport Report = {};
+    IndexedModel<3> Indexed(Model);
+    if (Indexed.Points.empty()) {
+        return Report;
+    }
+    std::vector<Vector3> Points(Indexed.Points.size());
+    for (std::size_t p = 0; p < Points.size(); p++) {
+        for (std::size_t i = 0; i < 3; i++) {
+            Points[p][i] = Indexed.Points[p]->GetCoordinate(i);
+        }
+    }
+    ConvexHull Hull = HullBuilder().Build(Points);
+    const std::vector<Vector3>& HullPoints = Hull.Points;
+    Report.HullPointCount = HullPoints.size();
+
+    //主成分包围盒
+    Vector3 Mean = {};
+    for (const Vector3& P: HullPoints) {
+        for (std::size_t i = 0; i < 3; i++) {
+            Mean[i] += P[i] / HullPoints.size();
+        }
+    }
+    double Covariance[3][3] = {};
+    for (const Vector3& P: HullPoints) {
+        for (std::size_t i = 0; i < 3; i++) {
+            for (std::size_t j = 0; j < 3; j++) {
+                Covariance[i][j] += (P[i] - Mean[i]) * (P[j] - Mean[j]);
+            }
+        }
+    }
+    Vector3 Principal[3];
+    SymmetricEigenvectors(Covariance, Principal);
+    Report.Pca = BoxFromAxes(HullPoints, Principal);
+
+    //候选法向：坐标轴、主成分轴，以及每个桶中面积最大的凸包面的法向
+    std::vector<Vector3> Normals = { { 1, 0, 0 }, { 0, 1, 0 }, { 0, 0, 1 },
+        Principal[0], Principal[1], Principal[2] };
+    std::size_t Budget = CandidateWorkBudget / HullPoints.size();
+    std::size_t Bins = std::max<std::size_t>(1, std::min(MaxBinsPerAxis,
+        static_cast<std::size_t>(std::sqrt(Budget / 3.0))));
+    //按绝对值最大的分量所在的轴分为3组（n与-n视为同一方向），
+    //每组再按另外两个分量与它的比值分为Bins×Bins个桶
+    std::vector<double> BinAreas(3 * Bins * Bins, 0);
+    std::vector<Vector3> BinNormals(BinAreas.size());
+    for (const auto& Face: Hull.Faces) {
+        const Vector3& A = HullPoints[Face[0]];
+        const Vector3& B = HullPoints[Face[1]];
+        const Vector3& C = HullPoints[Face[2]];
+        Vector3 Normal = Cross({ B[0] - A[0], B[1] - A[1], B[2] - A[2] },
+            { C[0] - A[0], C[1] - A[1], C[2] - A[2] });
+        double Area = std::sqrt(Dot(Normal, Normal)) / 2;
+        if (!(Area > 0)) {
+            continue;
+        }
+        Normal = Normalize(Normal);
+        std::size_t Major = 0;
+        for (std::size_t i = 1; i < 3; i++) {
+            if (std::fabs(Normal[i]) > std::fabs(Normal[Major])) {
+                Major = i;
+            }
+        }
+        std::size_t Bin = Major;
+        for (std::size_t k = 1; k < 3; k++) {
+            double Ratio = Normal[(Major + k) % 3] / std::fabs(Normal[Major]);
+            Bin = Bin * Bins + std::min(Bins - 1,
+                static_cast<std::size_t>((Ratio + 1) / 2 * Bins));
+        }
+        if (Area > BinAreas[Bin]) {
+            BinAreas[Bin] = Area;
+            BinNormals[Bin] = Normal;
+        }
+    }
+    for (std::size_t Bin = 0; Bin < BinAreas.size(); Bin++) {
+        if (BinAreas[Bin] > 0) {
+            Normals.push_back(BinNormals[Bin]);
+        }
+    }
+
+    //多线程求解一组法向，返回其中体积最小的
+    auto Solve = [&](const std::vector<Vector3>& Directions) {
+        std::size_t Workers = std::max<std::size_t>(1, std::min({
+            m_WorkerCount, Directions.size(),
+            Directions.size() * HullPoints.size() / MinWorkPerWorker }));
+        std::vector<Candidate> Bests(Workers);
+        auto Work = [&](std::size_t w) {
+            Bests[w].Volume = std::numeric_limits<double>::max();
+            for (std::size_t d = w; d < Directions.size(); d += Workers) {
+                Candidate Current = Evaluate(HullPoints, Directions[d]);
+                if (Current.Volume < Bests[w].Volume) {
+                    Bests[w] = Current;
+                }
+            }
+        };
+        std::vector<std::thread> Threads;
+        for (std::size_t w = 1; w < Workers; w++) {
+            Threads.emplace_back(Work, w);
+        }
+        Work(0);
+        for (auto& Thread: Threads) {
+            Thread.join();
+        }
+        Report.CandidateCount += Directions.size();
+        return *std::min_element(Bests.begin(), Bests.end(),
+            [](const Candidate& A, const Candidate& B) {
+                return A.Volume < B.Volume;
+            });
+    };
+    Candidate Best = Solve(Normals);
+
+    //局部搜索：沿切平面的四个方向偏移法向，没有改进时步长减半；
+    //每轮求解4个方向，轮数同样受工作量上限约束
+    double Step = 1.0 / Bins;
+    std::size_t Rounds = std::max<std::size_t>(MinRefineRounds,
+        std::min(MaxRefineRounds, Budget / 4));
+    for (std::size_t Round = 0; Round < Rounds
+        && Step > MinRefineStep && Best.Volume > 0; Round++) {
+        const Vector3& Normal = Best.Axes[2];
+        const Vector3& U = Best.Axes[0];
+        const Vector3& V = Best.Axes[1];
+        std::vector<Vector3> Directions;
+        for (double Sign: { 1.0, -1.0 }) {
+            Vector3 ShiftU;
+            Vector3 ShiftV;
+            for (std::size_t k = 0; k < 3; k++) {
+                ShiftU[k] = Normal[k] + Sign * Step * U[k];
+                ShiftV[k] = Normal[k] + Sign * Step * V[k];
+            }
+            Directions.push_back(Normalize(ShiftU));
+            Directions.push_back(Normalize(ShiftV));
+        }
+        Candidate Trial = Solve(Directions);
+        if (Trial.Volume < Best.Volume * (1 - 1e-9)) {
+            Best = Trial;
+        }
+        else {
+            Step /= 2;
+        }
+    }
+
+    Report.Minimum = BoxFromAxes(HullPoints, Best.Axes);
+    if (Report.Pca.Volume < Report.Minimum.Volume) {
+        Report.Minimum = Report.Pca;
+    }
+    return Report;
+}
@@ -0,0 +1,95 @@
+/*******************************************************************************
+【文件名】 BoxFitter.hpp
+【功能模块和目的】 定义BoxFitter类与OrientedBox、BoxReport结构体，求模型的有向
+包围盒：主成分分析的近似包围盒与基于凸包的最小体积包围盒
+ Created by 朱昊东 on 2026/10/18
+【更改记录】
+    2026/10/18
+    - 更新了共面点集凸包顶点数的说明
+*******************************************************************************/
+#ifndef BOX_FITTER_HPP
+#define BOX_FITTER_HPP
+
+#include <cstddef>
+#include "../Models/Model.hpp"
+
+/*******************************************************************************
+【结构体名】 OrientedBox
+【功能】 结构体，表示一个有向包围盒
+【接口说明】
+    - double Center[3]
+        中心
+    - double Axes[3][3]
+        三条互相垂直的单位轴，按边长从大到小排列
+    - double Extents[3]
+        沿各轴的边长
+    - double Volume
+        体积
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+struct OrientedBox {
+    double Center[3];
+    double Axes[3][3];
+    double Extents[3];
+    double Volume;
+};
+
+/*******************************************************************************
+【结构体名】 BoxReport
+【功能】 结构体，表示一次有向包围盒计算的结果
+【接口说明】
+    - OrientedBox Pca
+        以凸包顶点的主成分为轴的包围盒
+    - OrientedBox Minimum
+        找到的体积最小的包围盒，不大于Pca与轴对齐包围盒
+    - std::size_t HullPointCount
+        凸包的顶点数，点集共面时为全部点数
+    - std::size_t CandidateCount
+        尝试过的方向数
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+struct BoxReport {
+    OrientedBox Pca;
+    OrientedBox Minimum;
+    std::size_t HullPointCount;
+    std::size_t CandidateCount;
+};
+
+/*******************************************************************************
+【类名】 BoxFitter
+【功能】 有向包围盒求解器。先求所有点的凸包（HullBuilder），只有凸包顶点会影响包围
+盒。主成分包围盒取凸包顶点协方差矩阵的特征向量为轴（Jacobi迭代）。最小体积包围盒
+枚举候选的“底面法向”：对每个法向，把凸包顶点投影到垂直平面上求二维凸包，用旋转
+卡壳在线性时间内求最小面积外接矩形，乘以沿法向的高度即为体积。候选法向包括坐标轴、
+主成分轴与凸包各面的法向；凸包面很多时按法向分桶，每桶只取面积最大的面，使总工作量
+受限，再在最优法向附近逐步缩小步长做局部搜索。由平面组成的零件上结果通常就是精确
+的最小包围盒（它至少有一个面与凸包的面重合），曲面上是接近最优的近似。各候选方向
+分给多个线程计算
+【接口说明】
+    - BoxFitter(std::size_t WorkerCount = 0)
+        构造函数，WorkerCount为0时取硬件线程数
+    - const std::size_t& WorkerCount
+        线程数
+    - BoxReport Fit(const Model<3>& Model) const
+        求模型所有点的有向包围盒，没有点时结果全为0
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+class BoxFitter {
+    public:
+        explicit BoxFitter(std::size_t WorkerCount = 0);
+        BoxFitter(const BoxFitter& Other) = delete;
+        BoxFitter& operator=(const BoxFitter& Other) = delete;
+
+        const std::size_t& WorkerCount { m_WorkerCount };
+
+        //求模型的有向包围盒
+        BoxReport Fit(const Model<3>& Model) const;
+
+    private:
+        std::size_t m_WorkerCount;
+};
+
+#endif // BOX_FITTER_HPP
@@ -0,0 +1,201 @@
+/*******************************************************************************
+【文件名】 ComponentLabeler.cpp
+【功能模块和目的】 实现ComponentLabeler类，并发并查集标记连通部分
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 面积改为从面属性缓存中读取
+*******************************************************************************/
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <thread>
+#include <vector>
+#include "ComponentLabeler.hpp"
+#include "../Models/IndexedModel.hpp"
+
+//每个线程至少处理的元素数
+static const std::size_t MinElementsPerWorker = 1 << 14;
+
+/*******************************************************************************
+【函数名称】 Find
+【函数功能】 无锁地查找结点所在集合的根，顺便把经过的结点连到祖父结点（路径减半）。
+父结点只会变为序号更小的结点，因此并发修改不会形成环
+【参数】
+    - std::vector<std::atomic<std::size_t>>& Parent（输入输出参数）：父结点数组
+    - std::size_t Node（输入参数）：结点
+【返回值】 std::size_t：根结点
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+static std::size_t Find(std::vector<std::atomic<std::size_t>>& Parent,
+    std::size_t Node) {
+    for (;;) {
+        std::size_t Up = Parent[Node].load(std::memory_order_acquire);
+        if (Up == Node) {
+            return Node;
+        }
+        std::size_t UpUp = Parent[Up].load(std::memory_order_acquire);
+        if (Up != UpUp) {
+            Parent[Node].compare_exchange_weak(Up, UpUp,
+                std::memory_order_acq_rel, std::memory_order_relaxed);
+        }//失败说明其他线程已改写，无需重试
+        Node = UpUp;
+    }
+}
+
+/*******************************************************************************
+【函数名称】 Unite
+【函数功能】 无锁地合并两个结点所在的集合：把序号较大的根连到序号较小的根上，
+根在此期间被其他线程改写时重新查找
+【参数】
+    - std::vector<std::atomic<std::size_t>>& Parent（输入输出参数）：父结点数组
+    - std::size_t First（输入参数）：第一个结点
+    - std::size_t Second（输入参数）：第二个结点
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+static void Unite(std::vector<std::atomic<std::size_t>>& Parent,
+    std::size_t First, std::size_t Second) {
+    for (;;) {
+        First = Find(Parent, First);
+        Second = Find(Parent, Second);
+        if (First == Second) {
+            return;
+        }
+        if (First < Second) {
+            std::swap(First, Second);
+        }
+        std::size_t Expected = First;
+        if (Parent[First].compare_exchange_strong(Expected, Second,
+            std::memory_order_acq_rel, std::memory_order_relaxed)) {
+            return;
+        }
+    }
+}
+
+/*******************************************************************************
+【函数名称】 ComponentLabeler
+【函数功能】 构造函数
+【参数】
+    - std::size_t WorkerCount（输入参数）：线程数，为0时取硬件线程数
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+ComponentLabeler::ComponentLabeler(std::size_t WorkerCount):
+    m_WorkerCount(WorkerCount != 0 ? WorkerCount
+        : std::max<std::size_t>(1, std::thread::hardware_concurrency())) {}
+
+/*******************************************************************************
+【函数名称】 Label
+【函数功能】 为模型建立点索引，多线程合并每个元素的顶点，再顺序地为各个根分配
+部分编号并累计统计信息
+【参数】
+    - const Model<3>& Model（输入参数）：模型
+    - std::vector<std::size_t>* LineLabels（输出参数）：每条线所属部分，可为空
+    - std::vector<std::size_t>* FaceLabels（输出参数）：每个面所属部分，可为空
+【返回值】 std::vector<ComponentInfo>：各部分的统计信息
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+std::vector<ComponentInfo> ComponentLabeler::Label(const Model<3>& Model,
+    std::vector<std::size_t>* LineLabels,
+    std::vector<std::size_t>* FaceLabels) const {
+    IndexedModel<3> Indexed(Model);
+    const std::size_t PointCount = Indexed.Points.size();
+    const std::size_t LineCount = Indexed.LineIndices.size() / 2;
+    const std::size_t FaceCount = Indexed.FaceIndices.size() / 3;
+    std::vector<std::atomic<std::size_t>> Parent(PointCount);
+    for (std::size_t i = 0; i < PointCount; i++) {
+        Parent[i].store(i, std::memory_order_relaxed);
+    }
+
+    //第0到LineCount-1号元素是线，其后是面
+    const std::size_t ElementCount = LineCount + FaceCount;
+    auto Work = [&](std::size_t First, std::size_t Last) {
+        for (std::size_t e = First; e < Last; e++) {
+            if (e < LineCount) {
+                Unite(Parent, Indexed.LineIndices[e * 2],
+                    Indexed.LineIndices[e * 2 + 1]);
+            }
+            else {
+                const std::size_t* Face =
+                    &Indexed.FaceIndices[(e - LineCount) * 3];
+                Unite(Parent, Face[0], Face[1]);
+                Unite(Parent, Face[1], Face[2]);
+            }
+        }
+    };
+    std::size_t Workers = std::max<std::size_t>(1,
+        std::min(m_WorkerCount, ElementCount / MinElementsPerWorker));
+    std::vector<std::thread> Threads;
+    for (std::size_t w = 1; w < Workers; w++) {
+        Threads.emplace_back(Work, ElementCount * w / Workers,
+            ElementCount * (w + 1) / Workers);
+    }
+    Work(0, ElementCount / Workers);
+    for (auto& Thread: Threads) {
+        Thread.join();
+    }
+
+    const std::size_t None = std::numeric_limits<std::size_t>::max();
+    std::vector<std::size_t> RootLabels(PointCount, None);
+    const std::vector<double>& Areas = Model.GetFaceAttributes().Areas;
+    std::vector<ComponentInfo> Components;
+    auto Account = [&](std::size_t PointIndex, bool IsFace) {
+        std::size_t Root = Find(Parent, PointIndex);
+        if (RootLabels[Root] == None) {
+            RootLabels[Root] = Components.size();
+            ComponentInfo Info = {};
+            std::fill(Info.Min, Info.Min + 3,
+                std::numeric_limits<double>::max());
+            std::fill(Info.Max, Info.Max + 3,
+                std::numeric_limits<double>::lowest());
+            Components.push_back(Info);
+        }
+        ComponentInfo& Info = Components[RootLabels[Root]];
+        if (IsFace) {
+            Info.FaceCount++;
+        }
+        else {
+            Info.LineCount++;
+        }
+        return RootLabels[Root];
+    };
+    auto Expand = [&](std::size_t Label, const std::size_t* Indices,
+        std::size_t Count) {
+        ComponentInfo& Info = Components[Label];
+        for (std::size_t k = 0; k < Count; k++) {
+            const Point<3>& P = *Indexed.Points[Indices[k]];
+            for (std::size_t i = 0; i < 3; i++) {
+                Info.Min[i] = std::min(Info.Min[i], P.GetCoordinate(i));
+                Info.Max[i] = std::max(Info.Max[i], P.GetCoordinate(i));
+            }
+        }
+    };
+    if (LineLabels) {
+        LineLabels->resize(LineCount);
+    }
+    if (FaceLabels) {
+        FaceLabels->resize(FaceCount);
+    }
+    for (std::size_t l = 0; l < LineCount; l++) {
+        std::size_t Label = Account(Indexed.LineIndices[l * 2], false);
+        Expand(Label, &Indexed.LineIndices[l * 2], 2);
+        if (LineLabels) {
+            (*LineLabels)[l] = Label;
+        }
+    }
+    for (std::size_t f = 0; f < FaceCount; f++) {
+        std::size_t Label = Account(Indexed.FaceIndices[f * 3], true);
+        Expand(Label, &Indexed.FaceIndices[f * 3], 3);
+        Components[Label].Area += Areas[f];
+        if (FaceLabels) {
+            (*FaceLabels)[f] = Label;
+        }
+    }//不焊接时第f个面就是Model.Faces[f]
+    return Components;
+}
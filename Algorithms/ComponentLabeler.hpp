@@ -0,0 +1,76 @@
+/*******************************************************************************
+【文件名】 ComponentLabeler.hpp
+【功能模块和目的】 定义ComponentLabeler类与ComponentInfo结构体，用并发并查集把模型
+划分为互不相连的部分并统计各部分的信息
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+#ifndef COMPONENT_LABELER_HPP
+#define COMPONENT_LABELER_HPP
+
+#include <cstddef>
+#include <vector>
+#include "../Models/Model.hpp"
+
+/*******************************************************************************
+【结构体名】 ComponentInfo
+【功能】 结构体，表示一个连通部分的统计信息
+【接口说明】
+    - std::size_t LineCount
+        线数
+    - std::size_t FaceCount
+        面数
+    - double Area
+        面的总面积
+    - double Min[3]
+        包围盒的最小坐标
+    - double Max[3]
+        包围盒的最大坐标
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+struct ComponentInfo {
+    std::size_t LineCount;
+    std::size_t FaceCount;
+    double Area;
+    double Min[3];
+    double Max[3];
+};
+
+/*******************************************************************************
+【类名】 ComponentLabeler
+【功能】 连通部分标记器。共享同一个点对象的线和面属于同一部分：以点的序号为结点，
+多个线程各自处理一段元素，用无锁并查集（比较并交换连接，根总是连到序号更小的根上，
+查找时路径减半）合并每个元素的顶点，整体接近线性时间。部分按其第一个元素（先线后面）
+出现的顺序编号
+【接口说明】
+    - ComponentLabeler(std::size_t WorkerCount = 0)
+        构造函数，WorkerCount为0时取硬件线程数
+    - const std::size_t& WorkerCount
+        线程数
+    - std::vector<ComponentInfo> Label(const Model<3>& Model,
+        std::vector<std::size_t>* LineLabels,
+        std::vector<std::size_t>* FaceLabels) const
+        标记模型的各个部分，输出每条线、每个面所属部分的编号（从0开始），
+        返回各部分的统计信息；不需要标记时可传入空指针
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+class ComponentLabeler {
+    public:
+        explicit ComponentLabeler(std::size_t WorkerCount = 0);
+        ComponentLabeler(const ComponentLabeler& Other) = delete;
+        ComponentLabeler& operator=(const ComponentLabeler& Other) = delete;
+
+        const std::size_t& WorkerCount { m_WorkerCount };
+
+        //标记模型的各个部分
+        std::vector<ComponentInfo> Label(const Model<3>& Model,
+            std::vector<std::size_t>* LineLabels,
+            std::vector<std::size_t>* FaceLabels) const;
+
+    private:
+        std::size_t m_WorkerCount;
+};
+
+#endif // COMPONENT_LABELER_HPP
@@ -0,0 +1,155 @@
+/*******************************************************************************
+【文件名】 ContainmentTester.cpp
+【功能模块和目的】 实现ContainmentTester类，按直线分组并行求点的环绕数
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include "ContainmentTester.hpp"
+#include "FaceTree.hpp"
+#include "MortonReorderer.hpp"
+#include "RadixSorter.hpp"
+
+//每个线程每次领取的点数
+static const std::size_t ChunkSize = 1 << 12;
+
+/*******************************************************************************
+【函数名称】 ContainmentTester
+【函数功能】 构造函数
+【参数】
+    - std::size_t WorkerCount（输入参数）：线程数，为0时取硬件线程数
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+ContainmentTester::ContainmentTester(std::size_t WorkerCount):
+    m_WorkerCount(WorkerCount != 0 ? WorkerCount
+        : std::max<std::size_t>(1, std::thread::hardware_concurrency())) {}
+
+/*******************************************************************************
+【函数名称】 Classify
+【函数功能】 建树后把各点按(y, z)在模型包围盒中的Morton码排序，多个线程轮流领取
+排好序的一段点：与上一个点不在同一条直线上时重新求交点、排序并记下前缀环绕数，
+再二分查找点之前的交点个数得到环绕数。交点恰好在点上时不计入，点落在表面上时的
+结果取决于该处的面朝向。最后把各点的结果按原顺序打包为位掩码
+【参数】
+    - const Model<3>& Model（输入参数）：模型
+    - const std::vector<double>& Coordinates（输入参数）：各点的x、y、z坐标，
+    多余的不足3个的坐标被忽略
+【返回值】 std::vector<std::uint64_t>：位掩码，共(点数 + 63) / 64个字
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+std::vector<std::uint64_t> ContainmentTester::Classify(const Model<3>& Model,
+    const std::vector<double>& Coordinates) const {
+    const std::size_t Count = Coordinates.size() / 3;
+    std::vector<std::uint64_t> Mask((Count + 63) / 64, 0);
+    if (Count == 0) {
+        return Mask;
+    }
+    FaceTree Tree(Model);
+    if (Tree.Nodes.empty()) {
+        return Mask;
+    }
+    const FaceTree::Node& Root = Tree.Nodes[0];
+
+    std::vector<RadixSorter::Item> Items(Count);
+    for (std::size_t i = 0; i < Count; i++) {
+        double Normalized[3] = { 0, 0, 0 };
+        for (std::size_t Axis = 1; Axis < 3; Axis++) {
+            double Extent = Root.Max[Axis] - Root.Min[Axis];
+            if (Extent > 0) {
+                Normalized[Axis] = (Coordinates[3 * i + Axis]
+                    - Root.Min[Axis]) / Extent;
+            }
+        }//x分量为0，Morton码只由y、z决定
+        Items[i] = RadixSorter::Item{ MortonReorderer::Encode(Normalized), i };
+    }
+    RadixSorter(m_WorkerCount).Sort(Items);
+
+    std::vector<char> Inside(Count, 0);
+    std::atomic<std::size_t> NextChunk(0);
+    auto Work = [&]() {
+        std::vector<FaceTree::Crossing> Crossings;
+        std::vector<double> Positions;
+        std::vector<int> Windings;//Windings[k]为经过前k + 1个交点后的环绕数
+        const double* Line = nullptr;//当前交点所属直线上的一点
+        for (;;) {
+            std::size_t First = NextChunk.fetch_add(ChunkSize);
+            if (First >= Count) {
+                return;
+            }
+            std::size_t Last = std::min(First + ChunkSize, Count);
+            for (std::size_t k = First; k < Last; k++) {
+                const double* Point = &Coordinates[3 * Items[k].Index];
+                bool IsInBox = true;
+                for (std::size_t Axis = 0; Axis < 3; Axis++) {
+                    IsInBox = IsInBox && Root.Min[Axis] <= Point[Axis]
+                        && Point[Axis] <= Root.Max[Axis];
+                }//NaN也判为外部
+                if (!IsInBox) {
+                    continue;
+                }
+                if (Line == nullptr || Line[1] != Point[1]
+                    || Line[2] != Point[2]) {
+                    Crossings.clear();
+                    Tree.FindCrossings(0, Point, &Crossings);
+                    std::sort(Crossings.begin(), Crossings.end(),
+                        [](const FaceTree::Crossing& Left,
+                            const FaceTree::Crossing& Right) {
+                            return Left.Position < Right.Position;
+                        });
+                    Positions.resize(Crossings.size());
+                    Windings.resize(Crossings.size());
+                    int Winding = 0;
+                    for (std::size_t c = 0; c < Crossings.size(); c++) {
+                        Winding -= Crossings[c].Direction;
+                        Positions[c] = Crossings[c].Position;
+                        Windings[c] = Winding;
+                    }//进入朝外的面时法向与x轴反向
+                    Line = Point;
+                }
+                std::size_t Passed = static_cast<std::size_t>(
+                    std::lower_bound(Positions.begin(), Positions.end(),
+                        Point[0]) - Positions.begin());
+                Inside[Items[k].Index] = Passed > 0
+                    && Windings[Passed - 1] != 0;
+            }
+        }
+    };//每个点写Inside中各自的字节，线程之间不冲突
+    std::size_t Workers = std::min(m_WorkerCount,
+        (Count + ChunkSize - 1) / ChunkSize);
+    std::vector<std::thread> Threads;
+    for (std::size_t w = 1; w < Workers; w++) {
+        Threads.emplace_back(Work);
+    }
+    Work();
+    for (auto& Thread: Threads) {
+        Thread.join();
+    }
+
+    for (std::size_t i = 0; i < Count; i++) {
+        Mask[i / 64] |= static_cast<std::uint64_t>(Inside[i] != 0) << (i % 64);
+    }
+    return Mask;
+}
+
+/*******************************************************************************
+【函数名称】 IsInside
+【函数功能】 取位掩码中的一位
+【参数】
+    - const std::vector<std::uint64_t>& Mask（输入参数）：Classify返回的位掩码
+    - std::size_t Index（输入参数）：点的序号
+【返回值】 bool：该点是否在内部
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+bool ContainmentTester::IsInside(const std::vector<std::uint64_t>& Mask,
+    std::size_t Index) {
+    return (Mask[Index / 64] >> (Index % 64) & 1) != 0;
+}
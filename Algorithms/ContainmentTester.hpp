@@ -0,0 +1,59 @@
+/*******************************************************************************
+【文件名】 ContainmentTester.hpp
+【功能模块和目的】 定义ContainmentTester类，批量判断点是否在封闭模型的内部
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+#ifndef CONTAINMENT_TESTER_HPP
+#define CONTAINMENT_TESTER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "../Models/Model.hpp"
+
+/*******************************************************************************
+【类名】 ContainmentTester
+【功能】 点在模型内的批量判定器。对模型的面建立FaceTree，对每个点求过该点、平行于
+x轴的直线与各面的交点，把点之前的交点方向累加为环绕数，不为0即在内部；环绕数对朝向
+一致的封闭网格是准确的，朝内的网格与互相嵌套的部分也能正确处理。
+为了让相邻的查询共用结果：
+    1. 各点按(y, z)的Morton码排序，相邻处理的点所在直线也相邻，树的访存集中
+    2. 同一条直线上的点（规则采样时很常见）只求一次交点，排序后记下各交点之前的
+    环绕数，之后每个点二分查找即可
+排序后的点分段由多个线程轮流领取，在模型包围盒外的点直接判为外部
+【接口说明】
+    - ContainmentTester(std::size_t WorkerCount = 0)
+        构造函数，WorkerCount为0时取硬件线程数
+    - const std::size_t& WorkerCount
+        线程数
+    - std::vector<std::uint64_t> Classify(const Model<3>& Model,
+        const std::vector<double>& Coordinates) const
+        Coordinates依次存放各点的x、y、z坐标，返回位掩码：第i个点在内部时，
+        第i / 64个字的第i % 64位为1。模型没有面时所有点都在外部
+    - static bool IsInside(const std::vector<std::uint64_t>& Mask,
+        std::size_t Index)
+        从位掩码中取第Index个点的结果
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+class ContainmentTester {
+    public:
+        explicit ContainmentTester(std::size_t WorkerCount = 0);
+        ContainmentTester(const ContainmentTester& Other) = delete;
+        ContainmentTester& operator=(const ContainmentTester& Other) = delete;
+
+        const std::size_t& WorkerCount { m_WorkerCount };
+
+        //批量判断点是否在模型内部
+        std::vector<std::uint64_t> Classify(const Model<3>& Model,
+            const std::vector<double>& Coordinates) const;
+        //取位掩码中的一位
+        static bool IsInside(const std::vector<std::uint64_t>& Mask,
+            std::size_t Index);
+
+    private:
+        std::size_t m_WorkerCount;
+};
+
+#endif // CONTAINMENT_TESTER_HPP
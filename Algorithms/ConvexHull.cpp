@@ -0,0 +1,594 @@
+/*******************************************************************************
+【文件名】 ConvexHull.cpp
+【功能模块和目的】 实现HullBuilder类，Quickhull三维凸包
+ Created by 朱昊东 on 2026/10/18
+【更改记录】
+    2026/10/18
+    - 单线程求解改为文件内的BuildSerial，增添了分块并行求解与逐级合并
+    - 共面的点集返回平面凸多边形，共线的点集返回线段端点
+    - 增添了以模型形式输出凸包
+*******************************************************************************/
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "ConvexHull.hpp"
+#include "../Models/IndexedModel.hpp"
+
+//容差相对于坐标范围的比例
+static const double RelativeEpsilon = 1e-10;
+//每个线程至少处理的点数，点数不到其两倍时不分块
+static const std::size_t MinPointsPerWorker = 1 << 16;
+
+typedef std::array<double, 3> Vector3;
+
+/*******************************************************************************
+【结构体名】 HullFace
+【功能】 结构体，表示构造过程中凸包的一个面
+【接口说明】
+    - std::size_t Vertices[3]
+        顶点序号，从外侧看为逆时针
+    - std::size_t Neighbors[3]
+        Neighbors[k]为与边(Vertices[k], Vertices[(k + 1) % 3])相邻的面
+    - double Normal[3]
+        单位外法向
+    - double Offset
+        平面方程Normal·x = Offset中的常数
+    - std::vector<std::size_t> Outside
+        分给该面、在其外侧的点
+    - bool IsAlive
+        是否仍属于凸包，已删除的面的位置会被新面复用
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+struct HullFace {
+    std::size_t Vertices[3];
+    std::size_t Neighbors[3];
+    double Normal[3];
+    double Offset;
+    std::vector<std::size_t> Outside;
+    bool IsAlive;
+};
+
+/*******************************************************************************
+【结构体名】 HorizonEdge
+【功能】 结构体，表示地平线上的一条边，即可见面与不可见面的公共边
+【接口说明】
+    - std::size_t From
+        边的起点（按可见面的方向）
+    - std::size_t To
+        边的终点
+    - std::size_t Neighbor
+        边另一侧的不可见面
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+struct HorizonEdge {
+    std::size_t From;
+    std::size_t To;
+    std::size_t Neighbor;
+};
+
+/*******************************************************************************
+【函数名称】 Subtract
+【函数功能】 向量相减
+【参数】
+    - const Vector3& A（输入参数）：被减向量
+    - const Vector3& B（输入参数）：减向量
+【返回值】 Vector3：A - B
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+static Vector3 Subtract(const Vector3& A, const Vector3& B) {
+    return { A[0] - B[0], A[1] - B[1], A[2] - B[2] };
+}
+
+/*******************************************************************************
+【函数名称】 Cross
+【函数功能】 向量叉积
+【参数】
+    - const Vector3& A（输入参数）：第一个向量
+    - const Vector3& B（输入参数）：第二个向量
+【返回值】 Vector3：A × B
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+static Vector3 Cross(const Vector3& A, const Vector3& B) {
+    return { A[1] * B[2] - A[2] * B[1],
+        A[2] * B[0] - A[0] * B[2],
+        A[0] * B[1] - A[1] * B[0] };
+}
+
+/*******************************************************************************
+【函数名称】 Dot
+【函数功能】 向量点积
+【参数】
+    - const double* A（输入参数）：第一个向量
+    - const double* B（输入参数）：第二个向量
+【返回值】 double：A · B
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+static double Dot(const double* A, const double* B) {
+    return A[0] * B[0] + A[1] * B[1] + A[2] * B[2];
+}
+
+/*******************************************************************************
+【函数名称】 SetPlane
+【函数功能】 由面的三个顶点求其单位法向与平面常数，退化面的法向为零向量
+【参数】
+    - HullFace& Face（输入输出参数）：面
+    - const Vector3* Points（输入参数）：点集
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+static void SetPlane(HullFace& Face, const Vector3* Points) {
+    const Vector3& A = Points[Face.Vertices[0]];
+    Vector3 Normal = Cross(Subtract(Points[Face.Vertices[1]], A),
+        Subtract(Points[Face.Vertices[2]], A));
+    double Length = std::sqrt(Dot(Normal.data(), Normal.data()));
+    for (std::size_t i = 0; i < 3; i++) {
+        Face.Normal[i] = Length > 0 ? Normal[i] / Length : 0;
+    }
+    Face.Offset = Dot(Face.Normal, A.data());
+}
+
+/*******************************************************************************
+【函数名称】 Distance
+【函数功能】 点到面所在平面的有向距离，在外侧为正
+【参数】
+    - const HullFace& Face（输入参数）：面
+    - const Vector3& P（输入参数）：点
+【返回值】 double：有向距离
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+static double Distance(const HullFace& Face, const Vector3& P) {
+    return Dot(Face.Normal, P.data()) - Face.Offset;
+}
+
+/*******************************************************************************
+【函数名称】 PlanarPolygon
+【函数功能】 用单调链算法求共面点集在其平面内的凸包，并做扇形三角剖分
+【参数】
+    - const Vector3* Points（输入参数）：点集
+    - std::size_t Count（输入参数）：点数
+    - const HullFace& Plane（输入参数）：点集所在的平面
+【返回值】 ConvexHull：逆时针排列（从Plane的法向一侧看）的凸多边形
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+static ConvexHull PlanarPolygon(const Vector3* Points, std::size_t Count,
+    const HullFace& Plane) {
+    Vector3 Normal = { Plane.Normal[0], Plane.Normal[1], Plane.Normal[2] };
+    Vector3 U = Subtract(Points[Plane.Vertices[1]], Points[Plane.Vertices[0]]);
+    double Length = std::sqrt(Dot(U.data(), U.data()));
+    for (std::size_t i = 0; i < 3; i++) {
+        U[i] /= Length;
+    }
+    Vector3 V = Cross(Normal, U);
+    struct Projected {
+        double X;
+        double Y;
+        std::size_t Index;
+    };
+    std::vector<Projected> Sorted(Count);
+    for (std::size_t p = 0; p < Count; p++) {
+        Sorted[p] = { Dot(Points[p].data(), U.data()),
+            Dot(Points[p].data(), V.data()), p };
+    }
+    std::sort(Sorted.begin(), Sorted.end(),
+        [](const Projected& A, const Projected& B) {
+            return A.X < B.X || (A.X == B.X && A.Y < B.Y);
+        });
+    auto Turn = [](const Projected& O, const Projected& A,
+        const Projected& B) {
+        return (A.X - O.X) * (B.Y - O.Y) - (A.Y - O.Y) * (B.X - O.X);
+    };
+    std::vector<Projected> Chain(2 * Count);
+    std::size_t Size = 0;
+    for (std::size_t i = 0; i < Count; i++) {
+        while (Size >= 2 && Turn(Chain[Size - 2], Chain[Size - 1], Sorted[i])
+            <= 0) {
+            Size--;
+        }
+        Chain[Size++] = Sorted[i];
+    }//下凸壳
+    for (std::size_t i = Count - 1, Lower = Size + 1; i > 0; i--) {
+        while (Size >= Lower
+            && Turn(Chain[Size - 2], Chain[Size - 1], Sorted[i - 1]) <= 0) {
+            Size--;
+        }
+        Chain[Size++] = Sorted[i - 1];
+    }//上凸壳，最后一个点与第一个点重复
+    ConvexHull Polygon;
+    for (std::size_t i = 0; i + 1 < Size; i++) {
+        Polygon.Points.push_back(Points[Chain[i].Index]);
+    }
+    for (std::size_t i = 1; i + 1 < Polygon.Points.size(); i++) {
+        Polygon.Faces.push_back({ 0, i, i + 1 });
+    }
+    return Polygon;
+}
+
+/*******************************************************************************
+【函数名称】 BuildSerial
+【函数功能】 在调用线程上求点集的凸包：建立初始四面体并分配外侧点，然后反复用面
+外侧最远的点扩张凸包，最后收集仍属于凸包的面并重新编号顶点
+【参数】
+    - const Vector3* Points（输入参数）：点集
+    - std::size_t Count（输入参数）：点数
+【返回值】 ConvexHull：凸包
+Created by 朱昊东 on 2026/10/18
+【更改记录】
+    2026/10/18
+    - 由HullBuilder::Build改为文件内函数，处理共面与共线的点集
+*******************************************************************************/
+static ConvexHull BuildSerial(const Vector3* Points, std::size_t Count) {
+    ConvexHull Degenerate;
+    if (Count == 0) {
+        return Degenerate;
+    }
+
+    //各轴上的极值点
+    std::size_t Extremes[6] = {};
+    for (std::size_t p = 1; p < Count; p++) {
+        for (std::size_t i = 0; i < 3; i++) {
+            if (Points[p][i] < Points[Extremes[2 * i]][i]) {
+                Extremes[2 * i] = p;
+            }
+            if (Points[p][i] > Points[Extremes[2 * i + 1]][i]) {
+                Extremes[2 * i + 1] = p;
+            }
+        }
+    }
+    double Extent = 0;
+    for (std::size_t i = 0; i < 3; i++) {
+        Extent = std::max(Extent,
+            Points[Extremes[2 * i + 1]][i] - Points[Extremes[2 * i]][i]);
+    }
+    const double Epsilon = Extent * RelativeEpsilon;
+    if (!(Extent > 0)) {
+        Degenerate.Points.push_back(Points[0]);
+        return Degenerate;
+    }//所有点重合
+
+    //初始四面体：距离最远的两个极值点、离其连线最远的点、离三点平面最远的点
+    std::size_t Simplex[4] = { Extremes[0], Extremes[1] };
+    double Best = -1;
+    for (std::size_t i = 0; i < 6; i++) {
+        for (std::size_t j = i + 1; j < 6; j++) {
+            Vector3 D = Subtract(Points[Extremes[i]], Points[Extremes[j]]);
+            if (Dot(D.data(), D.data()) > Best) {
+                Best = Dot(D.data(), D.data());
+                Simplex[0] = Extremes[i];
+                Simplex[1] = Extremes[j];
+            }
+        }
+    }
+    Vector3 Axis = Subtract(Points[Simplex[1]], Points[Simplex[0]]);
+    Best = -1;
+    for (std::size_t p = 0; p < Count; p++) {
+        Vector3 C = Cross(Axis, Subtract(Points[p], Points[Simplex[0]]));
+        if (Dot(C.data(), C.data()) > Best) {
+            Best = Dot(C.data(), C.data());
+            Simplex[2] = p;
+        }
+    }
+    if (std::sqrt(Best / Dot(Axis.data(), Axis.data())) <= Epsilon) {
+        Degenerate.Points.push_back(Points[Simplex[0]]);
+        Degenerate.Points.push_back(Points[Simplex[1]]);
+        return Degenerate;
+    }//共线，距离最远的两个极值点即为端点
+    HullFace Base = {};
+    Base.Vertices[0] = Simplex[0];
+    Base.Vertices[1] = Simplex[1];
+    Base.Vertices[2] = Simplex[2];
+    SetPlane(Base, Points);
+    Best = -1;
+    for (std::size_t p = 0; p < Count; p++) {
+        if (std::fabs(Distance(Base, Points[p])) > Best) {
+            Best = std::fabs(Distance(Base, Points[p]));
+            Simplex[3] = p;
+        }
+    }
+    if (Best <= Epsilon) {
+        return PlanarPolygon(Points, Count, Base);
+    }//共面
+
+    std::vector<HullFace> Faces(4);
+    //第f个面不含Simplex[3 - f]
+    const std::size_t Corners[4][3] = {
+        { 0, 1, 2 }, { 0, 1, 3 }, { 0, 2, 3 }, { 1, 2, 3 } };
+    for (std::size_t f = 0; f < 4; f++) {
+        HullFace& Face = Faces[f];
+        for (std::size_t k = 0; k < 3; k++) {
+            Face.Vertices[k] = Simplex[Corners[f][k]];
+        }
+        SetPlane(Face, Points);
+        if (Distance(Face, Points[Simplex[3 - f]]) > 0) {
+            std::swap(Face.Vertices[1], Face.Vertices[2]);
+            SetPlane(Face, Points);
+        }//使另一个顶点在内侧
+        Face.IsAlive = true;
+    }
+    //四面体中任意两个面都相邻，按公共边找出邻面
+    for (std::size_t f = 0; f < 4; f++) {
+        for (std::size_t k = 0; k < 3; k++) {
+            std::size_t From = Faces[f].Vertices[k];
+            std::size_t To = Faces[f].Vertices[(k + 1) % 3];
+            for (std::size_t g = 0; g < 4; g++) {
+                const std::size_t* V = Faces[g].Vertices;
+                if (g != f && std::count(V, V + 3, From)
+                    && std::count(V, V + 3, To)) {
+                    Faces[f].Neighbors[k] = g;
+                }
+            }
+        }
+    }
+
+    //把点分给第一个在其外侧的面，不在任何面外侧的点已在凸包内
+    auto Assign = [&](std::size_t P, const std::size_t* Candidates,
+        std::size_t CandidateCount) {
+        for (std::size_t c = 0; c < CandidateCount; c++) {
+            HullFace& Face = Faces[Candidates[c]];
+            if (Distance(Face, Points[P]) > Epsilon) {
+                Face.Outside.push_back(P);
+                return;
+            }
+        }
+    };
+    const std::size_t Initial[4] = { 0, 1, 2, 3 };
+    for (std::size_t p = 0; p < Count; p++) {
+        if (std::count(Simplex, Simplex + 4, p) == 0) {
+            Assign(p, Initial, 4);
+        }
+    }
+
+    std::vector<std::size_t> Pending = { 0, 1, 2, 3 };
+    std::vector<std::size_t> FreeFaces;
+    //0：未访问，1：可见，2：不可见
+    std::vector<char> States(Faces.size(), 0);
+    std::vector<std::size_t> Visited;
+    std::vector<std::size_t> Visible;
+    std::vector<HorizonEdge> Horizon;
+    std::vector<std::size_t> Orphans;
+    std::vector<std::size_t> NewFaces;
+    std::unordered_map<std::size_t, std::size_t> StartingAt;
+    while (!Pending.empty()) {
+        std::size_t Current = Pending.back();
+        Pending.pop_back();
+        if (!Faces[Current].IsAlive || Faces[Current].Outside.empty()) {
+            continue;
+        }
+        //外侧最远的点
+        const auto& Outside = Faces[Current].Outside;
+        std::size_t Eye = Outside[0];
+        double Farthest = Distance(Faces[Current], Points[Eye]);
+        for (std::size_t P: Outside) {
+            double D = Distance(Faces[Current], Points[P]);
+            if (D > Farthest) {
+                Farthest = D;
+                Eye = P;
+            }
+        }
+
+        //从当前面出发找出所有可见面，并按可见面的方向记录地平线
+        Visible.assign(1, Current);
+        Visited.assign(1, Current);
+        States[Current] = 1;
+        Horizon.clear();
+        for (std::size_t v = 0; v < Visible.size(); v++) {
+            const HullFace& Face = Faces[Visible[v]];
+            for (std::size_t k = 0; k < 3; k++) {
+                std::size_t Neighbor = Face.Neighbors[k];
+                if (States[Neighbor] == 0) {
+                    Visited.push_back(Neighbor);
+                    bool IsVisible =
+                        Distance(Faces[Neighbor], Points[Eye]) > Epsilon;
+                    States[Neighbor] = IsVisible ? 1 : 2;
+                    if (IsVisible) {
+                        Visible.push_back(Neighbor);
+                    }
+                }
+                if (States[Neighbor] == 2) {
+                    Horizon.push_back({ Face.Vertices[k],
+                        Face.Vertices[(k + 1) % 3], Neighbor });
+                }
+            }
+        }
+        for (std::size_t f: Visited) {
+            States[f] = 0;
+        }
+
+        //删去可见面，收集其外侧点
+        Orphans.clear();
+        for (std::size_t f: Visible) {
+            for (std::size_t P: Faces[f].Outside) {
+                if (P != Eye) {
+                    Orphans.push_back(P);
+                }
+            }
+            std::vector<std::size_t>().swap(Faces[f].Outside);
+            Faces[f].IsAlive = false;
+            FreeFaces.push_back(f);
+        }
+
+        //地平线的每条边与视点连成新面(From, To, Eye)
+        NewFaces.clear();
+        StartingAt.clear();
+        for (const HorizonEdge& Edge: Horizon) {
+            std::size_t Index;
+            if (!FreeFaces.empty()) {
+                Index = FreeFaces.back();
+                FreeFaces.pop_back();
+            }
+            else {
+                Index = Faces.size();
+                Faces.emplace_back();
+                States.push_back(0);
+            }
+            HullFace& Face = Faces[Index];
+            Face.Vertices[0] = Edge.From;
+            Face.Vertices[1] = Edge.To;
+            Face.Vertices[2] = Eye;
+            Face.IsAlive = true;
+            SetPlane(Face, Points);
+            Face.Neighbors[0] = Edge.Neighbor;
+            HullFace& Outer = Faces[Edge.Neighbor];
+            for (std::size_t k = 0; k < 3; k++) {
+                if (Outer.Vertices[k] == Edge.To) {
+                    Outer.Neighbors[k] = Index;
+                }
+            }//不可见面上对应的边为(To, From)
+            NewFaces.push_back(Index);
+            StartingAt[Edge.From] = Index;
+        }
+        //新面(From, To, Eye)的边(To, Eye)与以To起始的新面相邻，
+        //边(Eye, From)与以From终止的新面相邻
+        for (std::size_t f: NewFaces) {
+            HullFace& Face = Faces[f];
+            std::size_t Next = StartingAt[Face.Vertices[1]];
+            Face.Neighbors[1] = Next;
+            Faces[Next].Neighbors[2] = f;
+        }
+
+        for (std::size_t P: Orphans) {
+            Assign(P, NewFaces.data(), NewFaces.size());
+        }
+        for (std::size_t f: NewFaces) {
+            if (!Faces[f].Outside.empty()) {
+                Pending.push_back(f);
+            }
+        }
+    }
+
+    //收集剩下的面，按首次出现的顺序重新编号顶点
+    ConvexHull Hull;
+    const std::size_t None = std::numeric_limits<std::size_t>::max();
+    std::vector<std::size_t> Remap(Count, None);
+    for (const HullFace& Face: Faces) {
+        if (!Face.IsAlive) {
+            continue;
+        }
+        std::array<std::size_t, 3> Triangle;
+        for (std::size_t k = 0; k < 3; k++) {
+            std::size_t& Slot = Remap[Face.Vertices[k]];
+            if (Slot == None) {
+                Slot = Hull.Points.size();
+                Hull.Points.push_back(Points[Face.Vertices[k]]);
+            }
+            Triangle[k] = Slot;
+        }
+        Hull.Faces.push_back(Triangle);
+    }
+    return Hull;
+}
+
+/*******************************************************************************
+【函数名称】 HullBuilder
+【函数功能】 构造函数
+【参数】
+    - std::size_t WorkerCount（输入参数）：线程数，为0时取硬件线程数
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+HullBuilder::HullBuilder(std::size_t WorkerCount):
+    m_WorkerCount(WorkerCount != 0 ? WorkerCount
+        : std::max<std::size_t>(1, std::thread::hardware_concurrency())) {}
+
+/*******************************************************************************
+【函数名称】 Build
+【函数功能】 求点集的凸包。点数较多时均分为若干块，各线程分别求各块的凸包，
+再把相邻两块凸包的顶点合在一起求凸包，逐级并行合并，直到只剩一个
+【参数】
+    - const std::vector<std::array<double, 3>>& Points（输入参数）：点集
+【返回值】 ConvexHull：凸包
+Created by 朱昊东 on 2026/10/18
+【更改记录】
+    2026/10/18
+    - 改为分块并行求解与逐级合并
+*******************************************************************************/
+ConvexHull HullBuilder::Build(const std::vector<Vector3>& Points) const {
+    const std::size_t Count = Points.size();
+    std::size_t Workers = std::max<std::size_t>(1,
+        std::min(m_WorkerCount, Count / MinPointsPerWorker));
+    if (Workers == 1) {
+        return BuildSerial(Points.data(), Count);
+    }
+    //对Parts中的每一项并行执行Task
+    auto RunParallel = [](std::size_t Parts, const auto& Task) {
+        std::vector<std::thread> Threads;
+        for (std::size_t w = 1; w < Parts; w++) {
+            Threads.emplace_back(Task, w);
+        }
+        Task(0);
+        for (auto& Thread: Threads) {
+            Thread.join();
+        }
+    };
+    std::vector<ConvexHull> Hulls(Workers);
+    RunParallel(Workers, [&](std::size_t w) {
+        std::size_t First = Count * w / Workers;
+        std::size_t Last = Count * (w + 1) / Workers;
+        Hulls[w] = BuildSerial(Points.data() + First, Last - First);
+    });
+    while (Hulls.size() > 1) {
+        std::vector<ConvexHull> Merged((Hulls.size() + 1) / 2);
+        RunParallel(Merged.size(), [&](std::size_t m) {
+            if (2 * m + 1 == Hulls.size()) {
+                Merged[m] = std::move(Hulls[2 * m]);
+                return;
+            }//落单的一块直接进入下一级
+            std::vector<Vector3> Union = std::move(Hulls[2 * m].Points);
+            const auto& Other = Hulls[2 * m + 1].Points;
+            Union.insert(Union.end(), Other.begin(), Other.end());
+            Merged[m] = BuildSerial(Union.data(), Union.size());
+        });
+        Hulls.swap(Merged);
+    }
+    return std::move(Hulls[0]);
+}
+
+/*******************************************************************************
+【函数名称】 Build
+【函数功能】 求模型中所有不同点对象的凸包，清空Hull后把凸包的面（共线时为一条线）
+加入其中，面共享凸包的顶点对象，名称为原模型名称加“_hull”
+【参数】
+    - const Model<3>& Source（输入参数）：模型
+    - Model<3>& Hull（输出参数）：凸包模型
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+void HullBuilder::Build(const Model<3>& Source, Model<3>& Hull) const {
+    IndexedModel<3> Indexed(Source);
+    std::vector<Vector3> Coordinates(Indexed.Points.size());
+    for (std::size_t p = 0; p < Coordinates.size(); p++) {
+        for (std::size_t i = 0; i < 3; i++) {
+            Coordinates[p][i] = Indexed.Points[p]->GetCoordinate(i);
+        }
+    }
+    ConvexHull Result = Build(Coordinates);
+    Hull.Clear();
+    Hull.SetName(Source.Name + "_hull");
+    std::vector<std::shared_ptr<Point<3>>> Vertices;
+    Vertices.reserve(Result.Points.size());
+    for (const Vector3& P: Result.Points) {
+        Vertices.push_back(std::make_shared<Point<3>>(P.data()));
+    }
+    for (const auto& Triangle: Result.Faces) {
+        Hull.AddFaceUnchecked(Face<3>(Vertices[Triangle[0]],
+            Vertices[Triangle[1]], Vertices[Triangle[2]]));
+    }
+    if (Result.Faces.empty() && Vertices.size() == 2) {
+        Hull.AddLineUnchecked(Line<3>(Vertices[0], Vertices[1]));
+    }
+}
@@ -0,0 +1,79 @@
+/*******************************************************************************
+【文件名】 ConvexHull.hpp
+【功能模块和目的】 定义HullBuilder类与ConvexHull结构体，用Quickhull算法求三维点集
+的凸包，点数较多时分块并行求解再逐级合并
+ Created by 朱昊东 on 2026/10/18
+【更改记录】
+    2026/10/18
+    - 增添了分治并行求解、共面与共线点集的处理及以模型形式输出凸包
+*******************************************************************************/
+#ifndef CONVEX_HULL_HPP
+#define CONVEX_HULL_HPP
+
+#include <array>
+#include <cstddef>
+#include <vector>
+#include "../Models/Model.hpp"
+
+/*******************************************************************************
+【结构体名】 ConvexHull
+【功能】 结构体，表示一个三维凸包
+【接口说明】
+    - std::vector<std::array<double, 3>> Points
+        凸包的顶点
+    - std::vector<std::array<std::size_t, 3>> Faces
+        凸包的三角形面，元素为Points中的序号，从外侧看为逆时针。点集共面时
+        Points为平面上的凸多边形（按逆时针排列），Faces为它的扇形三角剖分；
+        共线时Points为线段的两个端点，Faces为空
+Created by 朱昊东 on 2026/10/18
+【更改记录】
+    2026/10/18
+    - 共面的点集改为返回凸多边形，共线的点集返回两个端点
+*******************************************************************************/
+struct ConvexHull {
+    std::vector<std::array<double, 3>> Points;
+    std::vector<std::array<std::size_t, 3>> Faces;
+};
+
+/*******************************************************************************
+【类名】 HullBuilder
+【功能】 Quickhull凸包构造器。先取各轴上的极值点张成初始四面体，把每个点分给它在外侧
+的某个面；之后依次取面外侧最远的点，从该面出发沿相邻关系找出该点能看到的所有面，
+删去这些面，用可见区域的边界（地平线）与该点连成新的面，并把被删面外侧的点重新分给
+新的面，直到没有面外侧还有点。点到面的距离不超过容差时视为在面上，因此共面的点不会
+产生狭长的退化面，容差与坐标的量级成正比；整个点集共面或共线时改为求平面凸多边形
+或线段。点数较多时把点集分为若干块，多个线程分别求各块的凸包，再两两合并（对两块
+凸包顶点的并集再求凸包），各级合并同样并行，直到只剩一个凸包
+【接口说明】
+    - HullBuilder(std::size_t WorkerCount = 0)
+        构造函数，WorkerCount为0时取硬件线程数
+    - const std::size_t& WorkerCount
+        线程数
+    - ConvexHull Build(const std::vector<std::array<double, 3>>& Points) const
+        求点集的凸包
+    - void Build(const Model<3>& Source, Model<3>& Hull) const
+        求模型中所有不同点对象的凸包，以新模型的形式输出
+ Created by 朱昊东 on 2026/10/18
+【更改记录】
+    2026/10/18
+    - 增添了WorkerCount与以模型形式输出的Build
+*******************************************************************************/
+class HullBuilder {
+    public:
+        explicit HullBuilder(std::size_t WorkerCount = 0);
+        HullBuilder(const HullBuilder& Other) = delete;
+        HullBuilder& operator=(const HullBuilder& Other) = delete;
+
+        const std::size_t& WorkerCount { m_WorkerCount };
+
+        //求点集的凸包
+        ConvexHull Build(
+            const std::vector<std::array<double, 3>>& Points) const;
+        //求模型的凸包
+        void Build(const Model<3>& Source, Model<3>& Hull) const;
+
+    private:
+        std::size_t m_WorkerCount;
+};
+
+#endif // CONVEX_HULL_HPP
@@ -0,0 +1,434 @@
+/*******************************************************************************
+【文件名】 FaceTree.cpp
+【功能模块和目的】 实现FaceTree类，中位数二分建树与各类查询
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 增添了按线段查询三角形
+*******************************************************************************/
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+#include "FaceTree.hpp"
+
+//线段查询时包围盒各边外扩的距离与坐标最大绝对值之比，抵消求交参数的舍入误差
+static const double SegmentSlack = 1e-9;
+
+/*******************************************************************************
+【函数名称】 EdgeSide
+【函数功能】 求点(U, V)在平面上相对有向边P→Q的位置，即(Q - P)×(X - P)，坐标取
+第Ui与Vi个分量。总是从字典序较小的端点开始计算，再按方向取反，使共用同一条边的
+两个三角形得到的值恰好互为相反数，不受舍入误差影响
+【参数】
+    - const double* P（输入参数）：边的起点
+    - const double* Q（输入参数）：边的终点
+    - double U（输入参数）：点的第一个坐标
+    - double V（输入参数）：点的第二个坐标
+    - std::size_t Ui（输入参数）：第一个坐标的分量序号
+    - std::size_t Vi（输入参数）：第二个坐标的分量序号
+【返回值】 double：为正时点在边的左侧
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+static double EdgeSide(const double* P, const double* Q, double U, double V,
+    std::size_t Ui, std::size_t Vi) {
+    bool Swapped = Q[Ui] < P[Ui] || (Q[Ui] == P[Ui] && Q[Vi] < P[Vi]);
+    if (Swapped) {
+        std::swap(P, Q);
+    }
+    double Side = (Q[Ui] - P[Ui]) * (V - P[Vi]) - (Q[Vi] - P[Vi]) * (U - P[Ui]);
+    return Swapped ? -Side : Side;
+}
+
+/*******************************************************************************
+【函数名称】 ComputeBounds
+【函数功能】 求结点所含三角形的包围盒
+【参数】
+    - const std::vector<FaceTree::Triangle>& Triangles（输入参数）：三角形
+    - FaceTree::Node& Node（输入输出参数）：结点，First与Count为三角形的范围
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+static void ComputeBounds(const std::vector<FaceTree::Triangle>& Triangles,
+    FaceTree::Node& Node) {
+    for (std::size_t i = 0; i < 3; i++) {
+        Node.Min[i] = Triangles[Node.First].Min[i];
+        Node.Max[i] = Triangles[Node.First].Max[i];
+    }
+    for (std::size_t t = Node.First; t < Node.First + Node.Count; t++) {
+        for (std::size_t i = 0; i < 3; i++) {
+            Node.Min[i] = std::min(Node.Min[i], Triangles[t].Min[i]);
+            Node.Max[i] = std::max(Node.Max[i], Triangles[t].Max[i]);
+        }
+    }
+}
+
+/*******************************************************************************
+【函数名称】 FaceTree
+【函数功能】 构造函数，复制各面的坐标并自顶向下建树。待划分的结点放在栈中，每次
+把结点的三角形按包围盒中心在最长轴上的中位数分为两半（std::nth_element），
+中心全部重合时直接作为叶结点
+【参数】
+    - const Model<3>& Model（输入参数）：模型
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+FaceTree::FaceTree(const Model<3>& Model) {
+    const auto& Faces = Model.Faces;
+    m_Triangles.resize(Faces.size());
+    for (std::size_t f = 0; f < Faces.size(); f++) {
+        Triangle& Current = m_Triangles[f];
+        const Point<3>* Points[3] = {
+            Faces[f]->First.get(), Faces[f]->Second.get(),
+            Faces[f]->Third.get() };
+        for (std::size_t k = 0; k < 3; k++) {
+            for (std::size_t i = 0; i < 3; i++) {
+                Current.Vertices[k][i] = Points[k]->GetCoordinate(i);
+            }
+        }
+        for (std::size_t i = 0; i < 3; i++) {
+            Current.Min[i] = std::min({ Current.Vertices[0][i],
+                Current.Vertices[1][i], Current.Vertices[2][i] });
+            Current.Max[i] = std::max({ Current.Vertices[0][i],
+                Current.Vertices[1][i], Current.Vertices[2][i] });
+        }
+        Current.Face = f;
+    }
+    if (m_Triangles.empty()) {
+        return;
+    }
+    m_Nodes.reserve(2 * (m_Triangles.size() / LeafSize) + 1);
+    m_Nodes.push_back(Node{ {}, {}, 0, m_Triangles.size() });
+    ComputeBounds(m_Triangles, m_Nodes[0]);
+    std::vector<std::size_t> Stack(1, 0);
+    while (!Stack.empty()) {
+        std::size_t Current = Stack.back();
+        Stack.pop_back();
+        const std::size_t First = m_Nodes[Current].First;
+        const std::size_t Count = m_Nodes[Current].Count;
+        if (Count <= LeafSize) {
+            continue;
+        }
+        //包围盒中心的范围，坐标均取两倍以免除法
+        double Low[3];
+        double High[3];
+        for (std::size_t i = 0; i < 3; i++) {
+            Low[i] = High[i] = m_Triangles[First].Min[i]
+                + m_Triangles[First].Max[i];
+        }
+        for (std::size_t t = First; t < First + Count; t++) {
+            for (std::size_t i = 0; i < 3; i++) {
+                double Center = m_Triangles[t].Min[i] + m_Triangles[t].Max[i];
+                Low[i] = std::min(Low[i], Center);
+                High[i] = std::max(High[i], Center);
+            }
+        }
+        std::size_t Axis = 0;
+        for (std::size_t i = 1; i < 3; i++) {
+            if (High[i] - Low[i] > High[Axis] - Low[Axis]) {
+                Axis = i;
+            }
+        }
+        if (High[Axis] == Low[Axis]) {
+            continue;
+        }
+        std::size_t Middle = First + Count / 2;
+        std::nth_element(m_Triangles.begin() + First,
+            m_Triangles.begin() + Middle, m_Triangles.begin() + First + Count,
+            [Axis](const Triangle& Left, const Triangle& Right) {
+                return Left.Min[Axis] + Left.Max[Axis]
+                    < Right.Min[Axis] + Right.Max[Axis];
+            });
+        std::size_t Child = m_Nodes.size();
+        m_Nodes.push_back(Node{ {}, {}, First, Middle - First });
+        m_Nodes.push_back(Node{ {}, {}, Middle, First + Count - Middle });
+        ComputeBounds(m_Triangles, m_Nodes[Child]);
+        ComputeBounds(m_Triangles, m_Nodes[Child + 1]);
+        m_Nodes[Current].First = Child;
+        m_Nodes[Current].Count = 0;
+        Stack.push_back(Child);
+        Stack.push_back(Child + 1);
+    }
+}
+
+/*******************************************************************************
+【函数名称】 FindOverlapping
+【函数功能】 从根结点出发，只进入包围盒与长方体相交的结点，收集叶结点中包围盒与
+长方体相交的三角形
+【参数】
+    - const double* Min（输入参数）：长方体各坐标的下界
+    - const double* Max（输入参数）：长方体各坐标的上界
+    - std::vector<std::size_t>* ResultPtr（输出参数）：追加三角形在Triangles
+    中的序号
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+void FaceTree::FindOverlapping(const double* Min, const double* Max,
+    std::vector<std::size_t>* ResultPtr) const {
+    auto Overlaps = [Min, Max](const double* BoxMin, const double* BoxMax) {
+        for (std::size_t i = 0; i < 3; i++) {
+            if (BoxMin[i] > Max[i] || BoxMax[i] < Min[i]) {
+                return false;
+            }
+        }
+        return true;
+    };
+    if (m_Nodes.empty() || !Overlaps(m_Nodes[0].Min, m_Nodes[0].Max)) {
+        return;
+    }
+    std::size_t Stack[64];
+    std::size_t Top = 0;
+    Stack[Top++] = 0;
+    while (Top > 0) {
+        const Node& Current = m_Nodes[Stack[--Top]];
+        if (Current.Count != 0) {
+            for (std::size_t t = Current.First;
+                t < Current.First + Current.Count; t++) {
+                if (Overlaps(m_Triangles[t].Min, m_Triangles[t].Max)) {
+                    ResultPtr->push_back(t);
+                }
+            }
+            continue;
+        }
+        for (std::size_t c = Current.First; c < Current.First + 2; c++) {
+            if (Overlaps(m_Nodes[c].Min, m_Nodes[c].Max)) {
+                Stack[Top++] = c;
+            }
+        }
+    }//中位数二分的树高不超过log2(面数)，64层的栈足够
+}
+
+/*******************************************************************************
+【函数名称】 FindCrossings
+【函数功能】 把三角形投影到与直线垂直的平面上，判断直线的投影点是否在三角形内，
+在则由重心坐标求交点沿直线的坐标。点恰好在边上时，只有当该边（按投影后的逆时针
+方向）的方向满足固定规则时才算在内：共用一条边的两个三角形中，同向的两个恰好有
+一个计入，反向（轮廓边）的两个同时计入或同时不计，它们的Direction相反，对环绕数的
+贡献抵消。点在顶点上时同理。投影退化为线段的三角形与直线平行，不计交点
+【参数】
+    - std::size_t Axis（输入参数）：直线平行的坐标轴，0~2
+    - const double* Origin（输入参数）：直线上的一点，第Axis个分量不使用
+    - std::vector<Crossing>* ResultPtr（输出参数）：追加交点
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+void FaceTree::FindCrossings(std::size_t Axis, const double* Origin,
+    std::vector<Crossing>* ResultPtr) const {
+    const std::size_t Ui = (Axis + 1) % 3;
+    const std::size_t Vi = (Axis + 2) % 3;
+    const double U = Origin[Ui];
+    const double V = Origin[Vi];
+    auto Contains = [Ui, Vi, U, V](const double* Min, const double* Max) {
+        return Min[Ui] <= U && U <= Max[Ui] && Min[Vi] <= V && V <= Max[Vi];
+    };
+    if (m_Nodes.empty() || !Contains(m_Nodes[0].Min, m_Nodes[0].Max)) {
+        return;
+    }
+    auto Test = [&](const Triangle& Current) {
+        const double* A = Current.Vertices[0];
+        const double* B = Current.Vertices[1];
+        const double* C = Current.Vertices[2];
+        double Determinant = (B[Ui] - A[Ui]) * (C[Vi] - A[Vi])
+            - (B[Vi] - A[Vi]) * (C[Ui] - A[Ui]);
+        if (Determinant == 0) {
+            return;
+        }
+        const double Sign = Determinant > 0 ? 1 : -1;
+        const double* Ends[3][2] = { { B, C }, { C, A }, { A, B } };
+        double Weights[3];
+        for (std::size_t k = 0; k < 3; k++) {
+            Weights[k] = Sign * EdgeSide(Ends[k][0], Ends[k][1], U, V, Ui, Vi);
+            if (Weights[k] < 0) {
+                return;
+            }
+            if (Weights[k] == 0) {
+                double DeltaU = Sign * (Ends[k][1][Ui] - Ends[k][0][Ui]);
+                double DeltaV = Sign * (Ends[k][1][Vi] - Ends[k][0][Vi]);
+                if (!(DeltaV > 0 || (DeltaV == 0 && DeltaU < 0))) {
+                    return;
+                }
+            }//在边上时按边的方向决定取舍
+        }
+        double Total = Weights[0] + Weights[1] + Weights[2];
+        ResultPtr->push_back(Crossing{ (Weights[0] * A[Axis]
+            + Weights[1] * B[Axis] + Weights[2] * C[Axis]) / Total,
+            Determinant > 0 ? 1 : -1 });
+    };
+    std::size_t Stack[64];
+    std::size_t Top = 0;
+    Stack[Top++] = 0;
+    while (Top > 0) {
+        const Node& Current = m_Nodes[Stack[--Top]];
+        if (Current.Count != 0) {
+            for (std::size_t t = Current.First;
+                t < Current.First + Current.Count; t++) {
+                if (Contains(m_Triangles[t].Min, m_Triangles[t].Max)) {
+                    Test(m_Triangles[t]);
+                }
+            }
+            continue;
+        }
+        for (std::size_t c = Current.First; c < Current.First + 2; c++) {
+            if (Contains(m_Nodes[c].Min, m_Nodes[c].Max)) {
+                Stack[Top++] = c;
+            }
+        }
+    }
+}
+
+/*******************************************************************************
+【函数名称】 FindAlongSegment
+【函数功能】 从根结点出发，用分离轴（slab）方法求线段在各坐标轴上进出包围盒的参数，
+三个区间与[0, 1]有公共部分时线段穿过包围盒；只进入线段穿过的结点，收集叶结点中线段
+穿过其包围盒的三角形。包围盒外扩一点再求交，舍入误差只会多收集而不会漏掉三角形
+【参数】
+    - const double* Start（输入参数）：线段的起点
+    - const double* End（输入参数）：线段的终点
+    - std::vector<std::size_t>* ResultPtr（输出参数）：追加三角形在Triangles
+    中的序号
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+void FaceTree::FindAlongSegment(const double* Start, const double* End,
+    std::vector<std::size_t>* ResultPtr) const {
+    if (m_Nodes.empty()) {
+        return;
+    }
+    double Scale = 0;
+    double Inverse[3];
+    for (std::size_t i = 0; i < 3; i++) {
+        Scale = std::max({ Scale, std::fabs(m_Nodes[0].Min[i]),
+            std::fabs(m_Nodes[0].Max[i]), std::fabs(Start[i]),
+            std::fabs(End[i]) });
+        Inverse[i] = End[i] != Start[i] ? 1 / (End[i] - Start[i]) : 0;
+    }
+    const double Slack = Scale * SegmentSlack;
+    auto Crosses = [&](const double* Min, const double* Max) {
+        double Near = 0;
+        double Far = 1;
+        for (std::size_t i = 0; i < 3; i++) {
+            double Low = Min[i] - Slack;
+            double High = Max[i] + Slack;
+            if (Inverse[i] == 0) {
+                if (Start[i] < Low || Start[i] > High) {
+                    return false;
+                }
+                continue;
+            }//线段与该轴垂直
+            double Enter = (Low - Start[i]) * Inverse[i];
+            double Leave = (High - Start[i]) * Inverse[i];
+            if (Enter > Leave) {
+                std::swap(Enter, Leave);
+            }
+            Near = std::max(Near, Enter);
+            Far = std::min(Far, Leave);
+            if (Near > Far) {
+                return false;
+            }
+        }
+        return true;
+    };
+    if (!Crosses(m_Nodes[0].Min, m_Nodes[0].Max)) {
+        return;
+    }
+    std::size_t Stack[64];
+    std::size_t Top = 0;
+    Stack[Top++] = 0;
+    while (Top > 0) {
+        const Node& Current = m_Nodes[Stack[--Top]];
+        if (Current.Count != 0) {
+            for (std::size_t t = Current.First;
+                t < Current.First + Current.Count; t++) {
+                if (Crosses(m_Triangles[t].Min, m_Triangles[t].Max)) {
+                    ResultPtr->push_back(t);
+                }
+            }
+            continue;
+        }
+        for (std::size_t c = Current.First; c < Current.First + 2; c++) {
+            if (Crosses(m_Nodes[c].Min, m_Nodes[c].Max)) {
+                Stack[Top++] = c;
+            }
+        }
+    }
+}
+
+/*******************************************************************************
+【函数名称】 SquaredDistance
+【函数功能】 求三角形上离点最近的点（按点投影到三角形平面后所在的顶点、边或内部
+区域分别计算），返回距离的平方
+【参数】
+    - const Triangle& Triangle（输入参数）：三角形
+    - const double* Point（输入参数）：点的坐标
+【返回值】 double：距离的平方
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+double FaceTree::SquaredDistance(const Triangle& Triangle,
+    const double* Point) {
+    const double* A = Triangle.Vertices[0];
+    const double* B = Triangle.Vertices[1];
+    const double* C = Triangle.Vertices[2];
+    double Ab[3];
+    double Ac[3];
+    double Ap[3];
+    for (std::size_t i = 0; i < 3; i++) {
+        Ab[i] = B[i] - A[i];
+        Ac[i] = C[i] - A[i];
+        Ap[i] = Point[i] - A[i];
+    }
+    auto Dot = [](const double* X, const double* Y) {
+        return X[0] * Y[0] + X[1] * Y[1] + X[2] * Y[2];
+    };
+    //最近点为A + S·AB + T·AC
+    auto Distance = [&](double S, double T) {
+        double Sum = 0;
+        for (std::size_t i = 0; i < 3; i++) {
+            double Delta = Ap[i] - S * Ab[i] - T * Ac[i];
+            Sum += Delta * Delta;
+        }
+        return Sum;
+    };
+    double D1 = Dot(Ab, Ap);
+    double D2 = Dot(Ac, Ap);
+    if (D1 <= 0 && D2 <= 0) {
+        return Distance(0, 0);
+    }//顶点A
+    double AbAb = Dot(Ab, Ab);
+    double AbAc = Dot(Ab, Ac);
+    double AcAc = Dot(Ac, Ac);
+    double D3 = D1 - AbAb;//AB·BP
+    double D4 = D2 - AbAc;//AC·BP
+    if (D3 >= 0 && D4 <= D3) {
+        return Distance(1, 0);
+    }//顶点B
+    double D5 = D1 - AbAc;//AB·CP
+    double D6 = D2 - AcAc;//AC·CP
+    if (D6 >= 0 && D5 <= D6) {
+        return Distance(0, 1);
+    }//顶点C
+    double Vc = D1 * D4 - D3 * D2;
+    if (Vc <= 0 && D1 >= 0 && D3 <= 0) {
+        return Distance(D1 / (D1 - D3), 0);
+    }//边AB
+    double Vb = D5 * D2 - D1 * D6;
+    if (Vb <= 0 && D2 >= 0 && D6 <= 0) {
+        return Distance(0, D2 / (D2 - D6));
+    }//边AC
+    double Va = D3 * D6 - D5 * D4;
+    if (Va <= 0 && D4 - D3 >= 0 && D5 - D6 >= 0) {
+        double W = (D4 - D3) / ((D4 - D3) + (D5 - D6));
+        return Distance(1 - W, W);
+    }//边BC
+    double Denominator = Va + Vb + Vc;
+    if (Denominator <= 0) {
+        return std::min({ Distance(0, 0), Distance(1, 0), Distance(0, 1) });
+    }//退化的三角形
+    return Distance(Vb / Denominator, Vc / Denominator);
+}
@@ -0,0 +1,106 @@
+/*******************************************************************************
+【文件名】 FaceTree.hpp
+【功能模块和目的】 定义FaceTree类，按模型各面的包围盒建立层次包围盒树（BVH），
+加速区域查询、平行于坐标轴的直线求交与点到面的距离计算
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 增添了按线段查询三角形的接口
+*******************************************************************************/
+#ifndef FACE_TREE_HPP
+#define FACE_TREE_HPP
+
+#include <cstddef>
+#include <vector>
+#include "../Models/Model.hpp"
+
+/*******************************************************************************
+【类名】 FaceTree
+【功能】 面的层次包围盒树。构造时复制各面的顶点坐标，自顶向下按面包围盒中心在最长
+轴上的中位数二分，直到结点中的面不超过LeafSize个。子结点在Nodes中相邻存放，面按
+叶结点的顺序重排，因此查询时的访存基本连续
+【接口说明】
+    - struct Triangle
+        三角形：顶点坐标Vertices[3][3]、包围盒Min[3]与Max[3]、在模型中的序号Face
+    - struct Node
+        结点：包围盒Min[3]与Max[3]；Count不为0时为叶结点，包含Triangles中从First
+        开始的Count个三角形，否则两个子结点为Nodes[First]与Nodes[First + 1]
+    - struct Crossing
+        直线与三角形的交点：沿直线方向的坐标Position，三角形法向在该方向上的分量
+        为正时Direction为1，否则为-1
+    - static constexpr std::size_t LeafSize
+        叶结点最多包含的三角形数
+    - FaceTree(const Model<3>& Model)
+        构造函数，对模型的所有面建树
+    - const std::vector<Triangle>& Triangles
+        按叶结点顺序排列的三角形
+    - const std::vector<Node>& Nodes
+        结点，Nodes[0]为根结点；模型没有面时为空
+    - void FindOverlapping(const double* Min, const double* Max,
+        std::vector<std::size_t>* ResultPtr) const
+        把包围盒与给定长方体相交的三角形在Triangles中的序号追加到结果中
+    - void FindCrossings(std::size_t Axis, const double* Origin,
+        std::vector<Crossing>* ResultPtr) const
+        求过Origin、平行于第Axis个坐标轴的直线与各三角形的交点，追加到结果中，
+        不排序。交点恰好落在边或顶点上时按固定规则只归入相邻三角形之一，因此
+        在封闭网格上逐个累加Direction得到的环绕数是准确的
+    - void FindAlongSegment(const double* Start, const double* End,
+        std::vector<std::size_t>* ResultPtr) const
+        把包围盒与线段相交的三角形在Triangles中的序号追加到结果中
+    - static double SquaredDistance(const Triangle& Triangle,
+        const double* Point)
+        点到三角形的距离的平方
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 增添了FindAlongSegment
+*******************************************************************************/
+class FaceTree {
+    public:
+        struct Triangle {
+            double Vertices[3][3];
+            double Min[3];
+            double Max[3];
+            std::size_t Face;
+        };
+
+        struct Node {
+            double Min[3];
+            double Max[3];
+            std::size_t First;
+            std::size_t Count;
+        };
+
+        struct Crossing {
+            double Position;
+            int Direction;
+        };
+
+        static constexpr std::size_t LeafSize = 4;
+
+        explicit FaceTree(const Model<3>& Model);
+        FaceTree(const FaceTree& Other) = delete;
+        FaceTree& operator=(const FaceTree& Other) = delete;
+
+        const std::vector<Triangle>& Triangles { m_Triangles };
+        const std::vector<Node>& Nodes { m_Nodes };
+
+        //查找包围盒与长方体相交的三角形
+        void FindOverlapping(const double* Min, const double* Max,
+            std::vector<std::size_t>* ResultPtr) const;
+        //求平行于坐标轴的直线与三角形的交点
+        void FindCrossings(std::size_t Axis, const double* Origin,
+            std::vector<Crossing>* ResultPtr) const;
+        //查找包围盒与线段相交的三角形
+        void FindAlongSegment(const double* Start, const double* End,
+            std::vector<std::size_t>* ResultPtr) const;
+        //点到三角形的距离的平方
+        static double SquaredDistance(const Triangle& Triangle,
+            const double* Point);
+
+    private:
+        std::vector<Triangle> m_Triangles;
+        std::vector<Node> m_Nodes;
+};
+
+#endif // FACE_TREE_HPP
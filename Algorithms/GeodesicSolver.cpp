@@ -0,0 +1,395 @@
+/*******************************************************************************
+【文件名】 GeodesicSolver.cpp
+【功能模块和目的】 实现GeodesicSolver类，在邻接表上用带索引的二叉堆做Dijkstra与A*
+搜索
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include "GeodesicSolver.hpp"
+#include "RadixSorter.hpp"
+#include "../Errors.hpp"
+#include "../Models/IndexedModel.hpp"
+#include "../Models/Line.hpp"
+
+/*******************************************************************************
+【类名】 IndexedHeap
+【功能】 带位置索引的最小二叉堆，元素为顶点序号，每个顶点至多出现一次；
+m_Slots记录每个顶点在堆数组中的位置，使减小键值只需从该位置上浮
+【接口说明】
+    - IndexedHeap(std::size_t VertexCount)
+        构造函数，顶点序号小于VertexCount
+    - bool IsEmpty() const
+        堆是否为空
+    - void Push(std::size_t Vertex, double Key)
+        插入顶点，已在堆中时把键值改为Key（只能减小）
+    - std::size_t Pop()
+        取出键值最小的顶点
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+class IndexedHeap {
+    public:
+        /***********************************************************************
+        【函数名称】 IndexedHeap
+        【函数功能】 构造函数，所有顶点都不在堆中
+        【参数】
+            - std::size_t VertexCount（输入参数）：顶点数
+        【返回值】 无
+        Created by 朱昊东 on 2026/10/18
+        【更改记录】 无
+        ***********************************************************************/
+        explicit IndexedHeap(std::size_t VertexCount):
+            m_Slots(VertexCount, NotInHeap) {}
+
+        /***********************************************************************
+        【函数名称】 IsEmpty
+        【函数功能】 判断堆是否为空
+        【参数】 无
+        【返回值】 bool：堆是否为空
+        Created by 朱昊东 on 2026/10/18
+        【更改记录】 无
+        ***********************************************************************/
+        bool IsEmpty() const {
+            return m_Vertices.empty();
+        }
+
+        /***********************************************************************
+        【函数名称】 Push
+        【函数功能】 插入顶点或减小其键值，之后上浮到合适的位置
+        【参数】
+            - std::size_t Vertex（输入参数）：顶点序号
+            - double Key（输入参数）：键值
+        【返回值】 无
+        Created by 朱昊东 on 2026/10/18
+        【更改记录】 无
+        ***********************************************************************/
+        void Push(std::size_t Vertex, double Key) {
+            std::size_t Slot = m_Slots[Vertex];
+            if (Slot == NotInHeap) {
+                Slot = m_Vertices.size();
+                m_Vertices.push_back(Vertex);
+                m_Keys.push_back(Key);
+                m_Slots[Vertex] = Slot;
+            }
+            else {
+                m_Keys[Slot] = Key;
+            }
+            while (Slot > 0 && m_Keys[(Slot - 1) / 2] > m_Keys[Slot]) {
+                Exchange(Slot, (Slot - 1) / 2);
+                Slot = (Slot - 1) / 2;
+            }
+        }
+
+        /***********************************************************************
+        【函数名称】 Pop
+        【函数功能】 取出堆顶，把最后一项移到堆顶后下沉
+        【参数】 无
+        【返回值】 std::size_t：键值最小的顶点，堆为空时行为未定义
+        Created by 朱昊东 on 2026/10/18
+        【更改记录】 无
+        ***********************************************************************/
+        std::size_t Pop() {
+            std::size_t Top = m_Vertices[0];
+            Exchange(0, m_Vertices.size() - 1);
+            m_Vertices.pop_back();
+            m_Keys.pop_back();
+            m_Slots[Top] = NotInHeap;
+            std::size_t Slot = 0;
+            for (;;) {
+                std::size_t Smallest = Slot;
+                for (std::size_t Child = 2 * Slot + 1;
+                    Child <= 2 * Slot + 2 && Child < m_Vertices.size();
+                    Child++) {
+                    if (m_Keys[Child] < m_Keys[Smallest]) {
+                        Smallest = Child;
+                    }
+                }
+                if (Smallest == Slot) {
+                    return Top;
+                }
+                Exchange(Slot, Smallest);
+                Slot = Smallest;
+            }
+        }
+
+    private:
+        //不在堆中的顶点的位置
+        static constexpr std::size_t NotInHeap = static_cast<std::size_t>(-1);
+
+        /***********************************************************************
+        【函数名称】 Exchange
+        【函数功能】 交换堆数组中的两项并更新它们的位置
+        【参数】
+            - std::size_t First（输入参数）：第一项的位置
+            - std::size_t Second（输入参数）：第二项的位置
+        【返回值】 无
+        Created by 朱昊东 on 2026/10/18
+        【更改记录】 无
+        ***********************************************************************/
+        void Exchange(std::size_t First, std::size_t Second) {
+            std::swap(m_Vertices[First], m_Vertices[Second]);
+            std::swap(m_Keys[First], m_Keys[Second]);
+            m_Slots[m_Vertices[First]] = First;
+            m_Slots[m_Vertices[Second]] = Second;
+        }
+
+        std::vector<std::size_t> m_Vertices;
+        std::vector<double> m_Keys;
+        std::vector<std::size_t> m_Slots;
+};
+
+/*******************************************************************************
+【函数名称】 GeodesicSolver
+【函数功能】 构造函数。焊接重合的点后取出坐标，把面的各条半边的键基数排序，
+相同的键合并为一条边，按各点的度数建立邻接表并记下边长；已有的线的键排序保存
+【参数】
+    - const Model<3>& Model（输入参数）：模型，点数不超过2^32
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+GeodesicSolver::GeodesicSolver(const Model<3>& Model) {
+    IndexedModel<3> Indexed(Model, true);
+    m_Points = Indexed.Points;
+    const std::size_t Count = m_Points.size();
+    m_Positions.resize(Count * 3);
+    for (std::size_t v = 0; v < Count; v++) {
+        for (std::size_t i = 0; i < 3; i++) {
+            m_Positions[3 * v + i] = m_Points[v]->GetCoordinate(i);
+        }
+    }
+    auto KeyOf = [](std::uint64_t From, std::uint64_t To) {
+        return std::min(From, To) << 32 | std::max(From, To);
+    };
+
+    const std::vector<std::size_t>& Faces = Indexed.FaceIndices;
+    std::vector<RadixSorter::Item> Items(Faces.size());
+    for (std::size_t h = 0; h < Faces.size(); h++) {
+        Items[h] = RadixSorter::Item{
+            KeyOf(Faces[h], Faces[h - h % 3 + (h + 1) % 3]), h };
+    }
+    RadixSorter().Sort(Items);
+    std::vector<std::uint64_t> EdgeKeys;
+    for (std::size_t i = 0; i < Items.size(); i++) {
+        if (i == 0 || Items[i].Key != Items[i - 1].Key) {
+            EdgeKeys.push_back(Items[i].Key);
+        }
+    }
+
+    m_Offsets.assign(Count + 1, 0);
+    for (std::uint64_t Key: EdgeKeys) {
+        m_Offsets[(Key >> 32) + 1]++;
+        m_Offsets[(Key & 0xffffffffULL) + 1]++;
+    }
+    for (std::size_t v = 0; v < Count; v++) {
+        m_Offsets[v + 1] += m_Offsets[v];
+    }
+    m_Neighbors.resize(2 * EdgeKeys.size());
+    m_Weights.resize(2 * EdgeKeys.size());
+    std::vector<std::size_t> Cursor(m_Offsets.begin(), m_Offsets.end() - 1);
+    for (std::uint64_t Key: EdgeKeys) {
+        std::size_t Small = static_cast<std::size_t>(Key >> 32);
+        std::size_t Large = static_cast<std::size_t>(Key & 0xffffffffULL);
+        const double* From = &m_Positions[3 * Small];
+        const double* To = &m_Positions[3 * Large];
+        double Length = std::sqrt(std::pow(From[0] - To[0], 2)
+            + std::pow(From[1] - To[1], 2) + std::pow(From[2] - To[2], 2));
+        m_Weights[Cursor[Small]] = Length;
+        m_Neighbors[Cursor[Small]++] = Large;
+        m_Weights[Cursor[Large]] = Length;
+        m_Neighbors[Cursor[Large]++] = Small;
+    }
+
+    const std::vector<std::size_t>& Lines = Indexed.LineIndices;
+    for (std::size_t l = 0; l + 1 < Lines.size(); l += 2) {
+        m_LineKeys.push_back(KeyOf(Lines[l], Lines[l + 1]));
+    }
+    std::sort(m_LineKeys.begin(), m_LineKeys.end());
+}
+
+/*******************************************************************************
+【函数名称】 GetVertexCount
+【函数功能】 返回顶点数
+【参数】 无
+【返回值】 std::size_t：顶点数
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+std::size_t GeodesicSolver::GetVertexCount() const {
+    return m_Points.size();
+}
+
+/*******************************************************************************
+【函数名称】 NearestVertex
+【函数功能】 遍历所有顶点，找出离给定位置最近的一个
+【参数】
+    - const double* Position（输入参数）：x、y、z坐标
+【返回值】 std::size_t：顶点序号，没有顶点时为NoVertex
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+std::size_t GeodesicSolver::NearestVertex(const double* Position) const {
+    std::size_t Nearest = NoVertex;
+    double Best = std::numeric_limits<double>::infinity();
+    for (std::size_t v = 0; v < m_Points.size(); v++) {
+        double Squared = 0;
+        for (std::size_t i = 0; i < 3; i++) {
+            double Delta = m_Positions[3 * v + i] - Position[i];
+            Squared += Delta * Delta;
+        }
+        if (Squared < Best) {
+            Best = Squared;
+            Nearest = v;
+        }
+    }
+    return Nearest;
+}
+
+/*******************************************************************************
+【函数名称】 DistancesFrom
+【函数功能】 用Dijkstra算法求各顶点到Source的最短距离
+【参数】
+    - std::size_t Source（输入参数）：起点
+【返回值】 std::vector<double>：各顶点的距离，不可达时为无穷大
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+std::vector<double> GeodesicSolver::DistancesFrom(std::size_t Source) const {
+    std::vector<double> Distances;
+    std::vector<std::size_t> Previous;
+    Search(Source, NoVertex, &Distances, &Previous);
+    return Distances;
+}
+
+/*******************************************************************************
+【函数名称】 FindPath
+【函数功能】 用A*算法求最短路径，再沿前驱从终点回溯到起点
+【参数】
+    - std::size_t Source（输入参数）：起点
+    - std::size_t Target（输入参数）：终点
+【返回值】 GeodesicPath：最短路径
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+GeodesicPath GeodesicSolver::FindPath(std::size_t Source,
+    std::size_t Target) const {
+    auto Start = std::chrono::steady_clock::now();
+    if (Target >= m_Points.size()) {
+        throw ExceptionIndexOutOfBounds(Target);
+    }
+    GeodesicPath Path{};
+    std::vector<double> Distances;
+    std::vector<std::size_t> Previous;
+    Path.SettledVertices = Search(Source, Target, &Distances, &Previous);
+    Path.Length = Distances[Target];
+    if (Path.Length < std::numeric_limits<double>::infinity()) {
+        for (std::size_t v = Target; v != NoVertex; v = Previous[v]) {
+            Path.Vertices.push_back(v);
+        }
+        std::reverse(Path.Vertices.begin(), Path.Vertices.end());
+    }
+    Path.Seconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - Start).count();
+    return Path;
+}
+
+/*******************************************************************************
+【函数名称】 AddPathLines
+【函数功能】 把路径上相邻两个顶点之间的每一段作为线加入模型，线直接引用模型中的
+点对象，与面共享顶点；与构造时已有的线重合的段被跳过
+【参数】
+    - const GeodesicPath& Path（输入参数）：FindPath求得的路径
+    - Model<3>& Model（输入输出参数）：构造本对象时的模型
+【返回值】 std::size_t：加入的线数
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+std::size_t GeodesicSolver::AddPathLines(const GeodesicPath& Path,
+    Model<3>& Model) const {
+    std::size_t Added = 0;
+    for (std::size_t i = 0; i + 1 < Path.Vertices.size(); i++) {
+        std::uint64_t From = Path.Vertices[i];
+        std::uint64_t To = Path.Vertices[i + 1];
+        std::uint64_t Key = std::min(From, To) << 32 | std::max(From, To);
+        if (std::binary_search(m_LineKeys.begin(), m_LineKeys.end(), Key)) {
+            continue;
+        }
+        Model.AddLineUnchecked(Line<3>(m_Points[From], m_Points[To]));
+        Added++;
+    }//最短路径不重复经过顶点，各段互不相同
+    return Added;
+}
+
+/*******************************************************************************
+【函数名称】 Search
+【函数功能】 从Source出发搜索：每次取出键值最小的顶点并确定其距离，松弛其未确定的
+邻点。Target为NoVertex时键值为距离（Dijkstra），搜索全部可达的顶点；否则键值再加上
+到Target的直线距离（A*），Target被确定时停止
+【参数】
+    - std::size_t Source（输入参数）：起点
+    - std::size_t Target（输入参数）：终点或NoVertex
+    - std::vector<double>* DistancesPtr（输出参数）：各顶点的距离
+    - std::vector<std::size_t>* PreviousPtr（输出参数）：各顶点在最短路径上的
+    前驱，起点与未到达的顶点为NoVertex
+【返回值】 std::size_t：确定了距离的顶点数
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+std::size_t GeodesicSolver::Search(std::size_t Source, std::size_t Target,
+    std::vector<double>* DistancesPtr,
+    std::vector<std::size_t>* PreviousPtr) const {
+    const std::size_t Count = m_Points.size();
+    if (Source >= Count) {
+        throw ExceptionIndexOutOfBounds(Source);
+    }
+    std::vector<double>& Distances = *DistancesPtr;
+    std::vector<std::size_t>& Previous = *PreviousPtr;
+    Distances.assign(Count, std::numeric_limits<double>::infinity());
+    Previous.assign(Count, NoVertex);
+    auto Heuristic = [&](std::size_t Vertex) {
+        if (Target == NoVertex) {
+            return 0.0;
+        }
+        double Squared = 0;
+        for (std::size_t i = 0; i < 3; i++) {
+            double Delta = m_Positions[3 * Vertex + i]
+                - m_Positions[3 * Target + i];
+            Squared += Delta * Delta;
+        }
+        return std::sqrt(Squared);
+    };
+    std::vector<char> IsSettled(Count, 0);
+    IndexedHeap Heap(Count);
+    Distances[Source] = 0;
+    Heap.Push(Source, Heuristic(Source));
+    std::size_t Settled = 0;
+    while (!Heap.IsEmpty()) {
+        std::size_t Vertex = Heap.Pop();
+        IsSettled[Vertex] = 1;
+        Settled++;
+        if (Vertex == Target) {
+            break;
+        }
+        for (std::size_t k = m_Offsets[Vertex]; k < m_Offsets[Vertex + 1];
+            k++) {
+            std::size_t Neighbor = m_Neighbors[k];
+            if (IsSettled[Neighbor] != 0) {
+                continue;
+            }
+            double Distance = Distances[Vertex] + m_Weights[k];
+            if (Distance < Distances[Neighbor]) {
+                Distances[Neighbor] = Distance;
+                Previous[Neighbor] = Vertex;
+                Heap.Push(Neighbor, Distance + Heuristic(Neighbor));
+            }
+        }
+    }
+    return Settled;
+}
@@ -0,0 +1,107 @@
+/*******************************************************************************
+【文件名】 GeodesicSolver.hpp
+【功能模块和目的】 定义GeodesicSolver类与GeodesicPath结构体，沿网格的边求点之间的
+表面最短路径与单源距离场
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+#ifndef GEODESIC_SOLVER_HPP
+#define GEODESIC_SOLVER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "../Models/Model.hpp"
+#include "../Models/Point.hpp"
+
+/*******************************************************************************
+【结构体名】 GeodesicPath
+【功能】 结构体，表示一条沿网格边的最短路径
+【接口说明】
+    - std::vector<std::size_t> Vertices
+        从起点到终点依次经过的顶点序号（焊接后），不可达时为空
+    - double Length
+        路径长度，不可达时为无穷大
+    - std::size_t SettledVertices
+        搜索中确定了距离的顶点数
+    - double Seconds
+        搜索的耗时（秒）
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+struct GeodesicPath {
+    std::vector<std::size_t> Vertices;
+    double Length;
+    std::size_t SettledVertices;
+    double Seconds;
+};
+
+/*******************************************************************************
+【类名】 GeodesicSolver
+【功能】 网格边上的最短路径求解器。构造时焊接重合的点，把各面的边基数排序去重后
+建立带边长的邻接表（CSR），之后的每次查询只在这些数组上进行：
+    1. 单源距离场用Dijkstra算法，优先队列为带位置索引的二叉堆，顶点已在堆中时
+    原地减小键值，堆中每个顶点至多一项
+    2. 两点之间的路径用A*算法，以到终点的直线距离为启发值；边长不小于直线距离，
+    启发值是一致的，每个顶点仍只确定一次，终点出堆即停止
+求得的是沿边的最短路径，是表面测地距离的上界，网格越细越接近。
+线不参与建图，已有的线不会成为捷径
+【接口说明】
+    - GeodesicSolver(const Model<3>& Model)
+        构造函数，为模型的面建立邻接表
+    - const std::vector<double>& Positions
+        各顶点的x、y、z坐标
+    - std::size_t GetVertexCount() const
+        顶点数
+    - std::size_t NearestVertex(const double* Position) const
+        离给定位置最近的顶点序号，没有顶点时返回NoVertex
+    - std::vector<double> DistancesFrom(std::size_t Source) const
+        各顶点到Source的最短距离，不可达时为无穷大
+    - GeodesicPath FindPath(std::size_t Source, std::size_t Target) const
+        求两个顶点之间的最短路径
+    - std::size_t AddPathLines(const GeodesicPath& Path, Model<3>& Model) const
+        把路径的各段作为线加入构造时的模型，与已有的线重合的段被跳过
+    - static constexpr std::size_t NoVertex
+        表示不存在的顶点
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+class GeodesicSolver {
+    public:
+        static constexpr std::size_t NoVertex = static_cast<std::size_t>(-1);
+
+        explicit GeodesicSolver(const Model<3>& Model);
+        GeodesicSolver(const GeodesicSolver& Other) = delete;
+        GeodesicSolver& operator=(const GeodesicSolver& Other) = delete;
+
+        const std::vector<double>& Positions { m_Positions };
+
+        //顶点数
+        std::size_t GetVertexCount() const;
+        //最近的顶点
+        std::size_t NearestVertex(const double* Position) const;
+        //单源距离场
+        std::vector<double> DistancesFrom(std::size_t Source) const;
+        //两点之间的最短路径
+        GeodesicPath FindPath(std::size_t Source, std::size_t Target) const;
+        //把路径加入模型
+        std::size_t AddPathLines(const GeodesicPath& Path,
+            Model<3>& Model) const;
+
+    private:
+        //Dijkstra或A*搜索
+        std::size_t Search(std::size_t Source, std::size_t Target,
+            std::vector<double>* DistancesPtr,
+            std::vector<std::size_t>* PreviousPtr) const;
+
+        std::vector<std::shared_ptr<Point<3>>> m_Points;
+        std::vector<double> m_Positions;
+        std::vector<std::size_t> m_Offsets;
+        std::vector<std::size_t> m_Neighbors;
+        std::vector<double> m_Weights;
+        //已有的线的键（高32位为小序号，低32位为大序号），升序
+        std::vector<std::uint64_t> m_LineKeys;
+};
+
+#endif // GEODESIC_SOLVER_HPP
@@ -0,0 +1,673 @@
+/*******************************************************************************
+【文件名】 IntersectionFinder.cpp
+【功能模块和目的】 实现IntersectionFinder类，包围盒树粗筛与精确的三角形相交判定
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 增添了线与面的相交检测，并行收集改为对结果类型通用
+*******************************************************************************/
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "IntersectionFinder.hpp"
+#include "Predicates.hpp"
+
+using FacePairs = std::vector<std::pair<std::size_t, std::size_t>>;
+
+//每个线程至少处理的查询（面或线）数
+static const std::size_t MinQueriesPerWorker = 1 << 12;
+
+/*******************************************************************************
+【函数名称】 Orient
+【函数功能】 Predicates::Orient3D的符号
+【参数】
+    - const double* A（输入参数）：第一个点
+    - const double* B（输入参数）：第二个点
+    - const double* C（输入参数）：第三个点
+    - const double* D（输入参数）：第四个点
+【返回值】 int：1、-1或0
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+static int Orient(const double* A, const double* B, const double* C,
+    const double* D) {
+    double Value = Predicates::Orient3D(A, B, C, D);
+    return (Value > 0) - (Value < 0);
+}
+
+/*******************************************************************************
+【函数名称】 Orient2D
+【函数功能】 Predicates::Orient2D的符号
+【参数】
+    - const double* A（输入参数）：第一个点
+    - const double* B（输入参数）：第二个点
+    - const double* C（输入参数）：第三个点
+    - std::size_t Axis（输入参数）：投影时舍去的坐标轴
+【返回值】 int：1、-1或0
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+static int Orient2D(const double* A, const double* B, const double* C,
+    std::size_t Axis) {
+    double Value = Predicates::Orient2D(A, B, C, (Axis + 1) % 3,
+        (Axis + 2) % 3);
+    return (Value > 0) - (Value < 0);
+}
+
+/*******************************************************************************
+【函数名称】 DominantAxis
+【函数功能】 求三角形法向绝对值最大的分量，沿该轴投影时三角形不会退化
+【参数】
+    - const FaceTree::Triangle& Triangle（输入参数）：三角形
+【返回值】 std::size_t：坐标轴
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+static std::size_t DominantAxis(const FaceTree::Triangle& Triangle) {
+    const auto& V = Triangle.Vertices;
+    double Normal[3];
+    for (std::size_t i = 0; i < 3; i++) {
+        std::size_t j = (i + 1) % 3;
+        std::size_t k = (i + 2) % 3;
+        Normal[i] = (V[1][j] - V[0][j]) * (V[2][k] - V[0][k])
+            - (V[1][k] - V[0][k]) * (V[2][j] - V[0][j]);
+    }
+    std::size_t Axis = 0;
+    for (std::size_t i = 1; i < 3; i++) {
+        if (std::fabs(Normal[i]) > std::fabs(Normal[Axis])) {
+            Axis = i;
+        }
+    }
+    return Axis;
+}
+
+/*******************************************************************************
+【函数名称】 IsDegenerate
+【函数功能】 判断三角形的面积是否精确为0，即三个坐标平面上的投影都共线
+【参数】
+    - const FaceTree::Triangle& Triangle（输入参数）：三角形
+【返回值】 bool：是否退化
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+static bool IsDegenerate(const FaceTree::Triangle& Triangle) {
+    const auto& V = Triangle.Vertices;
+    for (std::size_t Axis = 0; Axis < 3; Axis++) {
+        if (Orient2D(V[0], V[1], V[2], Axis) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*******************************************************************************
+【函数名称】 SegmentsMeet
+【函数功能】 判断投影后共面的两条闭线段是否有公共点：两条线段互相跨立，或某个端点
+在另一条线段上
+【参数】
+    - const double* P（输入参数）：第一条线段的起点
+    - const double* Q（输入参数）：第一条线段的终点
+    - const double* A（输入参数）：第二条线段的起点
+    - const double* B（输入参数）：第二条线段的终点
+    - std::size_t Axis（输入参数）：投影时舍去的坐标轴
+【返回值】 bool：是否有公共点
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+static bool SegmentsMeet(const double* P, const double* Q, const double* A,
+    const double* B, std::size_t Axis) {
+    //已知X与线段共线，判断X是否在线段的范围内
+    auto OnSegment = [Axis](const double* Start, const double* End,
+        const double* X) {
+        for (std::size_t i = 0; i < 3; i++) {
+            if (i != Axis && (X[i] < std::min(Start[i], End[i])
+                || X[i] > std::max(Start[i], End[i]))) {
+                return false;
+            }
+        }
+        return true;
+    };
+    int SideA = Orient2D(P, Q, A, Axis);
+    int SideB = Orient2D(P, Q, B, Axis);
+    int SideP = Orient2D(A, B, P, Axis);
+    int SideQ = Orient2D(A, B, Q, Axis);
+    if (SideA * SideB < 0 && SideP * SideQ < 0) {
+        return true;
+    }
+    return (SideA == 0 && OnSegment(P, Q, A))
+        || (SideB == 0 && OnSegment(P, Q, B))
+        || (SideP == 0 && OnSegment(A, B, P))
+        || (SideQ == 0 && OnSegment(A, B, Q));
+}
+
+/*******************************************************************************
+【函数名称】 ContainsPoint
+【函数功能】 判断投影后点是否在闭三角形内（含边界）
+【参数】
+    - const FaceTree::Triangle& Triangle（输入参数）：三角形
+    - const double* X（输入参数）：点
+    - std::size_t Axis（输入参数）：投影时舍去的坐标轴
+【返回值】 bool：是否在三角形内
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+static bool ContainsPoint(const FaceTree::Triangle& Triangle, const double* X,
+    std::size_t Axis) {
+    const auto& V = Triangle.Vertices;
+    int Sides[3] = { Orient2D(V[0], V[1], X, Axis),
+        Orient2D(V[1], V[2], X, Axis), Orient2D(V[2], V[0], X, Axis) };
+    bool HasPositive = Sides[0] > 0 || Sides[1] > 0 || Sides[2] > 0;
+    bool HasNegative = Sides[0] < 0 || Sides[1] < 0 || Sides[2] < 0;
+    return !(HasPositive && HasNegative);
+}
+
+/*******************************************************************************
+【函数名称】 IntersectCoplanar
+【函数功能】 判断共面的两个三角形是否相交：投影到法向的主轴平面上，有边相交或
+一个三角形的顶点在另一个三角形内即相交
+【参数】
+    - const FaceTree::Triangle& First（输入参数）：第一个三角形
+    - const FaceTree::Triangle& Second（输入参数）：第二个三角形
+【返回值】 bool：是否相交
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+static bool IntersectCoplanar(const FaceTree::Triangle& First,
+    const FaceTree::Triangle& Second) {
+    const std::size_t Axis = DominantAxis(First);
+    const auto& U = First.Vertices;
+    const auto& V = Second.Vertices;
+    for (std::size_t i = 0; i < 3; i++) {
+        for (std::size_t j = 0; j < 3; j++) {
+            if (SegmentsMeet(U[i], U[(i + 1) % 3], V[j], V[(j + 1) % 3],
+                Axis)) {
+                return true;
+            }
+        }
+    }
+    return ContainsPoint(Second, U[0], Axis)
+        || ContainsPoint(First, V[0], Axis);
+}
+
+/*******************************************************************************
+【函数名称】 CheckInterval
+【函数功能】 Guigue-Devillers判定的最后一步：顶点已排列为p1、p2各自单独位于另一
+三角形平面的正侧，此时两个三角形与两平面交线的交集区间重叠当且仅当两个方向判定
+都不为正
+【参数】
+    - const double* P1, Q1, R1（输入参数）：第一个三角形的顶点
+    - const double* P2, Q2, R2（输入参数）：第二个三角形的顶点
+【返回值】 bool：是否相交
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+static bool CheckInterval(const double* P1, const double* Q1,
+    const double* R1, const double* P2, const double* Q2, const double* R2) {
+    if (Orient(Q2, P2, P1, Q1) > 0) {
+        return false;
+    }
+    return Orient(R2, P2, R1, P1) <= 0;
+}
+
+/*******************************************************************************
+【函数名称】 ArrangeSecond
+【函数功能】 Guigue-Devillers判定的第二次排列：按第二个三角形各顶点相对第一个三角形
+平面的方向，轮换（必要时翻转）其顶点，使p2单独位于一侧，再检查区间；三个方向都为
+0时两个三角形共面
+【参数】
+    - const double* P1, Q1, R1（输入参数）：排列好的第一个三角形的顶点
+    - const double* P2, Q2, R2（输入参数）：第二个三角形的顶点
+    - int Dp2, Dq2, Dr2（输入参数）：第二个三角形各顶点的方向
+    - const FaceTree::Triangle& First（输入参数）：原第一个三角形，用于共面判定
+    - const FaceTree::Triangle& Second（输入参数）：原第二个三角形，用于共面判定
+【返回值】 bool：是否相交
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+static bool ArrangeSecond(const double* P1, const double* Q1,
+    const double* R1, const double* P2, const double* Q2, const double* R2,
+    int Dp2, int Dq2, int Dr2, const FaceTree::Triangle& First,
+    const FaceTree::Triangle& Second) {
+    if (Dp2 > 0) {
+        if (Dq2 > 0) {
+            return CheckInterval(P1, R1, Q1, R2, P2, Q2);
+        }
+        if (Dr2 > 0) {
+            return CheckInterval(P1, R1, Q1, Q2, R2, P2);
+        }
+        return CheckInterval(P1, Q1, R1, P2, Q2, R2);
+    }
+    if (Dp2 < 0) {
+        if (Dq2 < 0) {
+            return CheckInterval(P1, Q1, R1, R2, P2, Q2);
+        }
+        if (Dr2 < 0) {
+            return CheckInterval(P1, Q1, R1, Q2, R2, P2);
+        }
+        return CheckInterval(P1, R1, Q1, P2, Q2, R2);
+    }
+    if (Dq2 < 0) {
+        return Dr2 >= 0 ? CheckInterval(P1, R1, Q1, Q2, R2, P2)
+            : CheckInterval(P1, Q1, R1, P2, Q2, R2);
+    }
+    if (Dq2 > 0) {
+        return Dr2 > 0 ? CheckInterval(P1, R1, Q1, P2, Q2, R2)
+            : CheckInterval(P1, Q1, R1, Q2, R2, P2);
+    }
+    if (Dr2 > 0) {
+        return CheckInterval(P1, Q1, R1, R2, P2, Q2);
+    }
+    if (Dr2 < 0) {
+        return CheckInterval(P1, R1, Q1, R2, P2, Q2);
+    }
+    return IntersectCoplanar(First, Second);
+}
+
+/*******************************************************************************
+【函数名称】 SegmentHitsTriangle
+【函数功能】 判断闭线段与闭三角形是否有公共点：两端点严格位于三角形平面同侧时不
+相交；都在平面上时在平面内判断；否则直线穿过平面，交点在三角形内当且仅当线段与
+三条边构成的三个四面体方向一致（允许为0）
+【参数】
+    - const double* P（输入参数）：线段的起点
+    - const double* Q（输入参数）：线段的终点
+    - const FaceTree::Triangle& Triangle（输入参数）：三角形
+【返回值】 bool：是否有公共点
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+static bool SegmentHitsTriangle(const double* P, const double* Q,
+    const FaceTree::Triangle& Triangle) {
+    const auto& V = Triangle.Vertices;
+    int SideP = Orient(V[0], V[1], V[2], P);
+    int SideQ = Orient(V[0], V[1], V[2], Q);
+    if (SideP * SideQ > 0) {
+        return false;
+    }
+    if (SideP == 0 && SideQ == 0) {
+        std::size_t Axis = DominantAxis(Triangle);
+        for (std::size_t k = 0; k < 3; k++) {
+            if (SegmentsMeet(P, Q, V[k], V[(k + 1) % 3], Axis)) {
+                return true;
+            }
+        }
+        return ContainsPoint(Triangle, P, Axis);
+    }
+    int Sides[3] = { Orient(P, Q, V[0], V[1]), Orient(P, Q, V[1], V[2]),
+        Orient(P, Q, V[2], V[0]) };
+    bool HasPositive = Sides[0] > 0 || Sides[1] > 0 || Sides[2] > 0;
+    bool HasNegative = Sides[0] < 0 || Sides[1] < 0 || Sides[2] < 0;
+    return !(HasPositive && HasNegative);
+}
+
+/*******************************************************************************
+【函数名称】 PierceTriangle
+【函数功能】 判断线段是否穿过三角形并求交点的参数：两端点严格位于平面同侧或都在
+平面上时不算穿过；否则交点在三角形内（含边界）当且仅当线段与三条边构成的三个
+四面体方向一致（允许为0）。参数由两端点到平面的有向体积按比例求得，端点在平面上时
+精确为0或1
+【参数】
+    - const double* P（输入参数）：线段的起点
+    - const double* Q（输入参数）：线段的终点
+    - const FaceTree::Triangle& Triangle（输入参数）：三角形，不能退化
+    - double* ParameterPtr（输出参数）：穿过时为交点的参数，在[0, 1]内
+【返回值】 bool：是否穿过
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+static bool PierceTriangle(const double* P, const double* Q,
+    const FaceTree::Triangle& Triangle, double* ParameterPtr) {
+    const auto& V = Triangle.Vertices;
+    double VolumeP = Predicates::Orient3D(V[0], V[1], V[2], P);
+    double VolumeQ = Predicates::Orient3D(V[0], V[1], V[2], Q);
+    if ((VolumeP > 0 && VolumeQ > 0) || (VolumeP < 0 && VolumeQ < 0)
+        || (VolumeP == 0 && VolumeQ == 0)) {
+        return false;
+    }
+    int Sides[3] = { Orient(P, Q, V[0], V[1]), Orient(P, Q, V[1], V[2]),
+        Orient(P, Q, V[2], V[0]) };
+    bool HasPositive = Sides[0] > 0 || Sides[1] > 0 || Sides[2] > 0;
+    bool HasNegative = Sides[0] < 0 || Sides[1] < 0 || Sides[2] < 0;
+    if (HasPositive && HasNegative) {
+        return false;
+    }
+    if (VolumeP == 0) {
+        *ParameterPtr = 0;
+    }
+    else if (VolumeQ == 0) {
+        *ParameterPtr = 1;
+    }
+    else {
+        *ParameterPtr = std::min(1.0, std::max(0.0,
+            VolumeP / (VolumeP - VolumeQ)));
+    }//两端点在平面两侧，体积异号，分母不为0
+    return true;
+}
+
+/*******************************************************************************
+【函数名称】 IntersectNeighbors
+【函数功能】 判断同一模型中的两个面是否穿插。两面共用顶点时按共用情况判断：
+共用三个顶点为重复面；共用一条边时，第三个顶点共面且位于公共边同侧才是折叠重叠；
+共用一个顶点时，两面的交集是从公共顶点出发的线段，它的另一端必然落在某个面的对边
+上，因此只需检查两条对边是否碰到另一个面。不共用顶点时即为一般的相交判定
+【参数】
+    - const FaceTree::Triangle& First（输入参数）：第一个三角形
+    - const FaceTree::Triangle& Second（输入参数）：第二个三角形
+【返回值】 bool：是否穿插
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+static bool IntersectNeighbors(const FaceTree::Triangle& First,
+    const FaceTree::Triangle& Second) {
+    const auto& U = First.Vertices;
+    const auto& V = Second.Vertices;
+    auto IsSame = [](const double* X, const double* Y) {
+        return X[0] == Y[0] && X[1] == Y[1] && X[2] == Y[2];
+    };
+    std::size_t SharedCount = 0;
+    std::size_t SharedU[3];
+    std::size_t SharedV[3];
+    for (std::size_t i = 0; i < 3; i++) {
+        for (std::size_t j = 0; j < 3; j++) {
+            if (IsSame(U[i], V[j])) {
+                SharedU[SharedCount] = i;
+                SharedV[SharedCount] = j;
+                SharedCount++;
+                break;
+            }
+        }
+    }
+    if (SharedCount == 0) {
+        return IntersectionFinder::Intersect(First, Second);
+    }
+    if (SharedCount == 3) {
+        return true;
+    }
+    //各三角形中不共用的顶点，共用一个顶点时为对边的两个端点
+    auto Others = [](const std::size_t* Shared, std::size_t Count,
+        std::size_t* Result) {
+        std::size_t n = 0;
+        for (std::size_t k = 0; k < 3; k++) {
+            if (std::find(Shared, Shared + Count, k) == Shared + Count) {
+                Result[n++] = k;
+            }
+        }
+    };
+    std::size_t OtherU[2];
+    std::size_t OtherV[2];
+    Others(SharedU, SharedCount, OtherU);
+    Others(SharedV, SharedCount, OtherV);
+    if (SharedCount == 2) {
+        const double* A = U[SharedU[0]];
+        const double* B = U[SharedU[1]];
+        const double* C = U[OtherU[0]];
+        const double* D = V[OtherV[0]];
+        if (Orient(A, B, C, D) != 0) {
+            return false;
+        }
+        std::size_t Axis = DominantAxis(First);
+        return Orient2D(A, B, C, Axis) == Orient2D(A, B, D, Axis);
+    }
+    return SegmentHitsTriangle(U[OtherU[0]], U[OtherU[1]], Second)
+        || SegmentHitsTriangle(V[OtherV[0]], V[OtherV[1]], First);
+}
+
+/*******************************************************************************
+【函数名称】 Collect
+【函数功能】 把Count个查询分段交给多个线程，每个线程把Visit找到的结果收集到自己的
+数组中，最后按线程顺序合并
+【参数】
+    - std::size_t Count（输入参数）：查询数
+    - std::size_t WorkerCount（输入参数）：线程数上限
+    - const Visitor& Visit（输入参数）：Visit(i, Entries)处理第i个查询，把结果追加
+    到Entries中
+【返回值】 std::vector<Entry>：所有结果，按查询的顺序排列
+Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 由CollectPairs改为对结果类型通用，排序交给调用者
+*******************************************************************************/
+template <typename Entry, typename Visitor>
+static std::vector<Entry> Collect(std::size_t Count, std::size_t WorkerCount,
+    const Visitor& Visit) {
+    std::size_t Workers = std::max<std::size_t>(1,
+        std::min(WorkerCount, Count / MinQueriesPerWorker));
+    std::vector<std::vector<Entry>> Partial(Workers);
+    auto Work = [&](std::size_t w) {
+        for (std::size_t i = Count * w / Workers;
+            i < Count * (w + 1) / Workers; i++) {
+            Visit(i, Partial[w]);
+        }
+    };
+    std::vector<std::thread> Threads;
+    for (std::size_t w = 1; w < Workers; w++) {
+        Threads.emplace_back(Work, w);
+    }
+    Work(0);
+    for (auto& Thread: Threads) {
+        Thread.join();
+    }
+    std::vector<Entry> Entries;
+    for (const auto& Part: Partial) {
+        Entries.insert(Entries.end(), Part.begin(), Part.end());
+    }
+    return Entries;
+}
+
+/*******************************************************************************
+【函数名称】 IntersectionFinder
+【函数功能】 构造函数
+【参数】
+    - std::size_t WorkerCount（输入参数）：线程数，为0时取硬件线程数
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+IntersectionFinder::IntersectionFinder(std::size_t WorkerCount):
+    m_WorkerCount(WorkerCount != 0 ? WorkerCount
+        : std::max<std::size_t>(1, std::thread::hardware_concurrency())) {}
+
+/*******************************************************************************
+【函数名称】 FindSelf
+【函数功能】 按树中的顺序遍历各面（相邻的查询在空间上也相邻），查找包围盒与之相交、
+且在树中排在其后的面，逐对判断是否穿插
+【参数】
+    - const Model<3>& Model（输入参数）：模型
+【返回值】 std::vector<std::pair<std::size_t, std::size_t>>：穿插的面对
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+FacePairs IntersectionFinder::FindSelf(const Model<3>& Model) const {
+    FaceTree Tree(Model);
+    const auto& Triangles = Tree.Triangles;
+    std::vector<char> Degenerate(Triangles.size());
+    for (std::size_t t = 0; t < Triangles.size(); t++) {
+        Degenerate[t] = IsDegenerate(Triangles[t]);
+    }
+    FacePairs Pairs = Collect<std::pair<std::size_t, std::size_t>>(
+        Triangles.size(), m_WorkerCount,
+        [&](std::size_t t, FacePairs& Found) {
+            if (Degenerate[t]) {
+                return;
+            }
+            std::vector<std::size_t> Candidates;
+            Tree.FindOverlapping(Triangles[t].Min, Triangles[t].Max,
+                &Candidates);
+            for (std::size_t c: Candidates) {
+                if (c <= t || Degenerate[c]
+                    || !IntersectNeighbors(Triangles[t], Triangles[c])) {
+                    continue;
+                }
+                Found.emplace_back(
+                    std::min(Triangles[t].Face, Triangles[c].Face),
+                    std::max(Triangles[t].Face, Triangles[c].Face));
+            }
+        });
+    std::sort(Pairs.begin(), Pairs.end());
+    return Pairs;
+}
+
+/*******************************************************************************
+【函数名称】 FindBetween
+【函数功能】 对第二个模型建树，第一个模型的各面并行查询包围盒相交的面并逐对判断；
+两个模型之间不存在相邻关系，共用顶点的接触也算相交
+【参数】
+    - const Model<3>& First（输入参数）：第一个模型
+    - const Model<3>& Second（输入参数）：第二个模型
+【返回值】 std::vector<std::pair<std::size_t, std::size_t>>：相交的面对
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+FacePairs IntersectionFinder::FindBetween(const Model<3>& First,
+    const Model<3>& Second) const {
+    FaceTree Queries(First);
+    FaceTree Tree(Second);
+    const auto& Triangles = Tree.Triangles;
+    std::vector<char> Degenerate(Triangles.size());
+    for (std::size_t t = 0; t < Triangles.size(); t++) {
+        Degenerate[t] = IsDegenerate(Triangles[t]);
+    }
+    FacePairs Pairs = Collect<std::pair<std::size_t, std::size_t>>(
+        Queries.Triangles.size(), m_WorkerCount,
+        [&](std::size_t q, FacePairs& Found) {
+            const auto& Query = Queries.Triangles[q];
+            if (IsDegenerate(Query)) {
+                return;
+            }
+            std::vector<std::size_t> Candidates;
+            Tree.FindOverlapping(Query.Min, Query.Max, &Candidates);
+            for (std::size_t c: Candidates) {
+                if (!Degenerate[c] && Intersect(Query, Triangles[c])) {
+                    Found.emplace_back(Query.Face, Triangles[c].Face);
+                }
+            }
+        });
+    std::sort(Pairs.begin(), Pairs.end());
+    return Pairs;
+}
+
+/*******************************************************************************
+【函数名称】 FindLineHits
+【函数功能】 对模型的面建树，各条线并行查询包围盒被线段穿过的面，逐个求交点；
+退化的面不参与检测
+【参数】
+    - const Model<3>& Model（输入参数）：模型
+【返回值】 std::vector<LineHit>：交点，按线的序号、参数、面的序号排列
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+std::vector<IntersectionFinder::LineHit> IntersectionFinder::FindLineHits(
+    const Model<3>& Model) const {
+    const auto& Lines = Model.Lines;
+    FaceTree Tree(Model);
+    const auto& Triangles = Tree.Triangles;
+    std::vector<char> Degenerate(Triangles.size());
+    for (std::size_t t = 0; t < Triangles.size(); t++) {
+        Degenerate[t] = IsDegenerate(Triangles[t]);
+    }
+    std::vector<LineHit> Hits = Collect<LineHit>(Lines.size(), m_WorkerCount,
+        [&](std::size_t l, std::vector<LineHit>& Found) {
+            double Ends[2][3];
+            for (std::size_t i = 0; i < 3; i++) {
+                Ends[0][i] = Lines[l]->First->GetCoordinate(i);
+                Ends[1][i] = Lines[l]->Second->GetCoordinate(i);
+            }
+            std::vector<std::size_t> Candidates;
+            Tree.FindAlongSegment(Ends[0], Ends[1], &Candidates);
+            for (std::size_t c: Candidates) {
+                double Parameter;
+                if (!Degenerate[c] && PierceTriangle(Ends[0], Ends[1],
+                    Triangles[c], &Parameter)) {
+                    Found.push_back(LineHit{ l, Triangles[c].Face,
+                        Parameter });
+                }
+            }
+        });
+    std::sort(Hits.begin(), Hits.end(),
+        [](const LineHit& Left, const LineHit& Right) {
+            if (Left.Line != Right.Line) {
+                return Left.Line < Right.Line;
+            }
+            if (Left.Parameter != Right.Parameter) {
+                return Left.Parameter < Right.Parameter;
+            }
+            return Left.Face < Right.Face;
+        });
+    return Hits;
+}
+
+/*******************************************************************************
+【函数名称】 Intersect
+【函数功能】 Guigue-Devillers判定：先求各三角形顶点相对另一三角形平面的方向，某个
+三角形全部严格在另一平面同侧时不相交；否则轮换顶点使p1单独位于一侧，交给
+ArrangeSecond排列第二个三角形并检查两个三角形在平面交线上的区间是否重叠
+【参数】
+    - const FaceTree::Triangle& First（输入参数）：第一个三角形，不能退化
+    - const FaceTree::Triangle& Second（输入参数）：第二个三角形，不能退化
+【返回值】 bool：是否相交
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+bool IntersectionFinder::Intersect(const FaceTree::Triangle& First,
+    const FaceTree::Triangle& Second) {
+    const double* P1 = First.Vertices[0];
+    const double* Q1 = First.Vertices[1];
+    const double* R1 = First.Vertices[2];
+    const double* P2 = Second.Vertices[0];
+    const double* Q2 = Second.Vertices[1];
+    const double* R2 = Second.Vertices[2];
+    int Dp1 = Orient(P1, P2, Q2, R2);
+    int Dq1 = Orient(Q1, P2, Q2, R2);
+    int Dr1 = Orient(R1, P2, Q2, R2);
+    if (Dp1 * Dq1 > 0 && Dp1 * Dr1 > 0) {
+        return false;
+    }
+    int Dp2 = Orient(P2, P1, Q1, R1);
+    int Dq2 = Orient(Q2, P1, Q1, R1);
+    int Dr2 = Orient(R2, P1, Q1, R1);
+    if (Dp2 * Dq2 > 0 && Dp2 * Dr2 > 0) {
+        return false;
+    }
+    auto Arrange = [&](const double* P, const double* Q, const double* R,
+        bool Flip) {
+        return Flip
+            ? ArrangeSecond(P, Q, R, P2, R2, Q2, Dp2, Dr2, Dq2, First, Second)
+            : ArrangeSecond(P, Q, R, P2, Q2, R2, Dp2, Dq2, Dr2, First, Second);
+    };
+    if (Dp1 > 0) {
+        if (Dq1 > 0) {
+            return Arrange(R1, P1, Q1, true);
+        }
+        if (Dr1 > 0) {
+            return Arrange(Q1, R1, P1, true);
+        }
+        return Arrange(P1, Q1, R1, false);
+    }
+    if (Dp1 < 0) {
+        if (Dq1 < 0) {
+            return Arrange(R1, P1, Q1, false);
+        }
+        if (Dr1 < 0) {
+            return Arrange(Q1, R1, P1, false);
+        }
+        return Arrange(P1, Q1, R1, true);
+    }
+    if (Dq1 < 0) {
+        return Dr1 >= 0 ? Arrange(Q1, R1, P1, true)
+            : Arrange(P1, Q1, R1, false);
+    }
+    if (Dq1 > 0) {
+        return Dr1 > 0 ? Arrange(P1, Q1, R1, true)
+            : Arrange(Q1, R1, P1, false);
+    }
+    if (Dr1 > 0) {
+        return Arrange(R1, P1, Q1, false);
+    }
+    if (Dr1 < 0) {
+        return Arrange(R1, P1, Q1, true);
+    }
+    return IntersectCoplanar(First, Second);
+}
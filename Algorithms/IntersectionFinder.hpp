@@ -0,0 +1,91 @@
+/*******************************************************************************
+【文件名】 IntersectionFinder.hpp
+【功能模块和目的】 定义IntersectionFinder类，检测模型的自相交、两个模型之间的
+相交面对以及模型中的线穿过的面
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 增添了模型中线与面的相交检测
+*******************************************************************************/
+#ifndef INTERSECTION_FINDER_HPP
+#define INTERSECTION_FINDER_HPP
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include "FaceTree.hpp"
+#include "../Models/Model.hpp"
+
+/*******************************************************************************
+【类名】 IntersectionFinder
+【功能】 相交检测器。粗筛阶段对面建立FaceTree，每个面只与包围盒和它相交的面比较；
+细判阶段用Guigue-Devillers三角形相交判定，所有方向判定都由Predicates精确计算，
+共面、共边、顶点落在另一面上等退化情况的结论都是确定的，接触也算相交。
+检测自相交时，共用顶点（坐标完全相同）的面是网格中正常相邻的面，按共用情况单独
+判断：共用一条边时只有两面共面且折叠重叠才算相交；共用一个顶点时，只有一个面的
+对边碰到另一个面才算相交；三个顶点都相同的重复面算相交。面积为0的退化面不参与检测。
+检测线与面时，对每条线查找包围盒被线段穿过的面，线段穿过面所在平面且交点在面上
+（含边界）才算相交；线段整个落在面所在平面内时没有确定的交点，不算穿过。
+各面或各线分段交给多个线程，各自收集结果后合并
+【接口说明】
+    - struct LineHit
+        线与面的交点：线的序号Line、面的序号Face（都从0开始），交点的参数
+        Parameter，交点为起点 + Parameter * (终点 - 起点)，在[0, 1]内
+    - IntersectionFinder(std::size_t WorkerCount = 0)
+        构造函数，WorkerCount为0时取硬件线程数
+    - const std::size_t& WorkerCount
+        线程数
+    - std::vector<std::pair<std::size_t, std::size_t>> FindSelf(
+        const Model<3>& Model) const
+        求模型中互相穿插的面对，每对面的序号从0开始、前小后大，按序排列
+    - std::vector<std::pair<std::size_t, std::size_t>> FindBetween(
+        const Model<3>& First, const Model<3>& Second) const
+        求两个模型间相交的面对，每对为（First中的面序号，Second中的面序号），
+        按序排列
+    - std::vector<LineHit> FindLineHits(const Model<3>& Model) const
+        求模型中各条线穿过的面，按线的序号、参数、面的序号排列
+    - static bool Intersect(const FaceTree::Triangle& First,
+        const FaceTree::Triangle& Second)
+        判断两个（闭）三角形是否有公共点
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 增添了LineHit与FindLineHits
+*******************************************************************************/
+class IntersectionFinder {
+    public:
+        /***********************************************************************
+        【结构体名】 LineHit
+        【功能】 线段与面的一个交点
+        Created by 朱昊东 on 2026/10/18
+        【更改记录】 无
+        ***********************************************************************/
+        struct LineHit {
+            std::size_t Line;
+            std::size_t Face;
+            double Parameter;
+        };
+
+        explicit IntersectionFinder(std::size_t WorkerCount = 0);
+        IntersectionFinder(const IntersectionFinder& Other) = delete;
+        IntersectionFinder& operator=(const IntersectionFinder& Other) = delete;
+
+        const std::size_t& WorkerCount { m_WorkerCount };
+
+        //求模型的自相交面对
+        std::vector<std::pair<std::size_t, std::size_t>> FindSelf(
+            const Model<3>& Model) const;
+        //求两个模型间的相交面对
+        std::vector<std::pair<std::size_t, std::size_t>> FindBetween(
+            const Model<3>& First, const Model<3>& Second) const;
+        //求模型中各条线穿过的面
+        std::vector<LineHit> FindLineHits(const Model<3>& Model) const;
+        //判断两个三角形是否相交
+        static bool Intersect(const FaceTree::Triangle& First,
+            const FaceTree::Triangle& Second);
+
+    private:
+        std::size_t m_WorkerCount;
+};
+
+#endif // INTERSECTION_FINDER_HPP
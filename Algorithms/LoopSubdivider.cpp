@@ -0,0 +1,342 @@
+/*******************************************************************************
+【文件名】 LoopSubdivider.cpp
+【功能模块和目的】 实现LoopSubdivider类，基于排序建立邻接并并行计算新点与新面
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+#include "LoopSubdivider.hpp"
+#include "RadixSorter.hpp"
+#include "../Models/IndexedModel.hpp"
+
+//每个线程至少处理的点、边或面数
+static const std::size_t MinItemsPerWorker = 1 << 12;
+//边只有一侧的面时对顶点的占位值
+static const std::size_t NoVertex = static_cast<std::size_t>(-1);
+
+/*******************************************************************************
+【结构体名】 Adjacency
+【功能】 结构体，表示一级细分所需的邻接关系：
+EdgeKeys为各条边的键（高32位为小序号，低32位为大序号），按升序排列；EdgeOf为每条
+半边（面f的第k条边为从第k个点到第k + 1个点，序号3f + k）所属的边；Opposite为每条边
+两侧面的对顶点，各2个，不足时为NoVertex；FaceCounts为每条边所属的面数；
+第v个点相连的边为NeighborEdges中[Offsets[v], Offsets[v + 1])的部分
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+struct Adjacency {
+    std::vector<std::uint64_t> EdgeKeys;
+    std::vector<std::size_t> EdgeOf;
+    std::vector<std::size_t> Opposite;
+    std::vector<std::size_t> FaceCounts;
+    std::vector<std::size_t> Offsets;
+    std::vector<std::size_t> NeighborEdges;
+};
+
+/*******************************************************************************
+【函数名称】 ForEachRange
+【函数功能】 把[0, Count)均分为若干段，交给多个线程调用Run(First, Last)，调用线程
+处理第一段；数量较少时只用调用线程
+【参数】
+    - std::size_t Count（输入参数）：项数
+    - std::size_t WorkerCount（输入参数）：线程数上限
+    - const Body& Run（输入参数）：处理一段的函数
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+template <typename Body>
+static void ForEachRange(std::size_t Count, std::size_t WorkerCount,
+    const Body& Run) {
+    std::size_t Workers = std::max<std::size_t>(1,
+        std::min(WorkerCount, Count / MinItemsPerWorker));
+    std::vector<std::thread> Threads;
+    for (std::size_t w = 1; w < Workers; w++) {
+        Threads.emplace_back(Run, Count * w / Workers,
+            Count * (w + 1) / Workers);
+    }
+    Run(0, Count / Workers);
+    for (auto& Thread: Threads) {
+        Thread.join();
+    }
+}
+
+/*******************************************************************************
+【函数名称】 BuildAdjacency
+【函数功能】 把各半边的键基数排序，相同的键合并为一条边并记下对顶点与面数，再统计
+各点的度数，按前缀和建立点到边的邻接表
+【参数】
+    - const std::vector<std::size_t>& Faces（输入参数）：各面的点序号
+    - std::size_t PointCount（输入参数）：点数，不超过2^32
+    - std::size_t WorkerCount（输入参数）：排序使用的线程数
+    - Adjacency* AdjacencyPtr（输出参数）：邻接关系
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+static void BuildAdjacency(const std::vector<std::size_t>& Faces,
+    std::size_t PointCount, std::size_t WorkerCount,
+    Adjacency* AdjacencyPtr) {
+    Adjacency& Result = *AdjacencyPtr;
+    const std::size_t HalfEdgeCount = Faces.size();
+    std::vector<RadixSorter::Item> Items(HalfEdgeCount);
+    for (std::size_t h = 0; h < HalfEdgeCount; h++) {
+        std::uint64_t From = Faces[h];
+        std::uint64_t To = Faces[h - h % 3 + (h + 1) % 3];
+        Items[h] = RadixSorter::Item{ std::min(From, To) << 32
+            | std::max(From, To), h };
+    }
+    RadixSorter(WorkerCount).Sort(Items);
+
+    Result.EdgeKeys.clear();
+    Result.Opposite.clear();
+    Result.FaceCounts.clear();
+    Result.EdgeOf.assign(HalfEdgeCount, 0);
+    for (std::size_t i = 0; i < HalfEdgeCount; i++) {
+        if (i == 0 || Items[i].Key != Items[i - 1].Key) {
+            Result.EdgeKeys.push_back(Items[i].Key);
+            Result.Opposite.push_back(NoVertex);
+            Result.Opposite.push_back(NoVertex);
+            Result.FaceCounts.push_back(0);
+        }
+        const std::size_t Edge = Result.EdgeKeys.size() - 1;
+        const std::size_t h = Items[i].Index;
+        if (Result.FaceCounts[Edge] < 2) {
+            Result.Opposite[2 * Edge + Result.FaceCounts[Edge]]
+                = Faces[h - h % 3 + (h + 2) % 3];
+        }
+        Result.FaceCounts[Edge]++;
+        Result.EdgeOf[h] = Edge;
+    }
+
+    const std::size_t EdgeCount = Result.EdgeKeys.size();
+    Result.Offsets.assign(PointCount + 1, 0);
+    for (std::uint64_t Key: Result.EdgeKeys) {
+        Result.Offsets[(Key >> 32) + 1]++;
+        Result.Offsets[(Key & 0xffffffffULL) + 1]++;
+    }
+    for (std::size_t v = 0; v < PointCount; v++) {
+        Result.Offsets[v + 1] += Result.Offsets[v];
+    }
+    Result.NeighborEdges.resize(2 * EdgeCount);
+    std::vector<std::size_t> Cursor(Result.Offsets.begin(),
+        Result.Offsets.end() - 1);
+    for (std::size_t e = 0; e < EdgeCount; e++) {
+        Result.NeighborEdges[Cursor[Result.EdgeKeys[e] >> 32]++] = e;
+        Result.NeighborEdges[Cursor[Result.EdgeKeys[e] & 0xffffffffULL]++] = e;
+    }
+}
+
+/*******************************************************************************
+【函数名称】 SubdivideOnce
+【函数功能】 细分一级：建立邻接后并行计算旧点的新位置与边点，写入新的坐标数组；
+并行把每个面分为四个；线在中点处分为两条，不与边重合的线的中点追加在最后
+【参数】
+    - std::vector<double>& Positions（输入输出参数）：各点的坐标
+    - std::vector<std::size_t>& Faces（输入输出参数）：各面的点序号
+    - std::vector<std::size_t>& Lines（输入输出参数）：各线的点序号
+    - std::size_t WorkerCount（输入参数）：线程数
+【返回值】 std::size_t：细分前的边界边数
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+static std::size_t SubdivideOnce(std::vector<double>& Positions,
+    std::vector<std::size_t>& Faces, std::vector<std::size_t>& Lines,
+    std::size_t WorkerCount) {
+    const std::size_t PointCount = Positions.size() / 3;
+    const std::size_t FaceCount = Faces.size() / 3;
+    Adjacency Mesh;
+    BuildAdjacency(Faces, PointCount, WorkerCount, &Mesh);
+    const std::size_t EdgeCount = Mesh.EdgeKeys.size();
+    auto Other = [&Mesh](std::size_t Edge, std::size_t Vertex) {
+        std::size_t Low = static_cast<std::size_t>(Mesh.EdgeKeys[Edge] >> 32);
+        std::size_t High = static_cast<std::size_t>(
+            Mesh.EdgeKeys[Edge] & 0xffffffffULL);
+        return Low == Vertex ? High : Low;
+    };
+
+    std::vector<double> Refined((PointCount + EdgeCount) * 3);
+    ForEachRange(PointCount, WorkerCount,
+        [&](std::size_t First, std::size_t Last) {
+            for (std::size_t v = First; v < Last; v++) {
+                const double* Old = &Positions[3 * v];
+                double* New = &Refined[3 * v];
+                const std::size_t Begin = Mesh.Offsets[v];
+                const std::size_t End = Mesh.Offsets[v + 1];
+                const std::size_t Valence = End - Begin;
+                double Sum[3] = { 0, 0, 0 };
+                double BoundarySum[3] = { 0, 0, 0 };
+                std::size_t BoundaryCount = 0;
+                for (std::size_t n = Begin; n < End; n++) {
+                    const std::size_t Edge = Mesh.NeighborEdges[n];
+                    const double* Neighbor = &Positions[3 * Other(Edge, v)];
+                    for (std::size_t i = 0; i < 3; i++) {
+                        Sum[i] += Neighbor[i];
+                    }
+                    if (Mesh.FaceCounts[Edge] != 2) {
+                        for (std::size_t i = 0; i < 3; i++) {
+                            BoundarySum[i] += Neighbor[i];
+                        }
+                        BoundaryCount++;
+                    }
+                }
+                if (BoundaryCount == 2) {
+                    for (std::size_t i = 0; i < 3; i++) {
+                        New[i] = 0.75 * Old[i] + 0.125 * BoundarySum[i];
+                    }
+                }
+                else if (BoundaryCount == 0 && Valence > 0) {
+                    const double Pi = std::acos(-1.0);
+                    double Term = 0.375 + 0.25 * std::cos(2 * Pi / Valence);
+                    double Beta = (0.625 - Term * Term) / Valence;
+                    for (std::size_t i = 0; i < 3; i++) {
+                        New[i] = (1 - Valence * Beta) * Old[i] + Beta * Sum[i];
+                    }
+                }
+                else {
+                    for (std::size_t i = 0; i < 3; i++) {
+                        New[i] = Old[i];
+                    }
+                }//角点、非流形点与不属于任何面的点保持不动
+            }
+        });
+    ForEachRange(EdgeCount, WorkerCount,
+        [&](std::size_t First, std::size_t Last) {
+            for (std::size_t e = First; e < Last; e++) {
+                const double* A = &Positions[3 * (Mesh.EdgeKeys[e] >> 32)];
+                const double* B = &Positions[3
+                    * (Mesh.EdgeKeys[e] & 0xffffffffULL)];
+                double* New = &Refined[3 * (PointCount + e)];
+                if (Mesh.FaceCounts[e] == 2) {
+                    const double* C = &Positions[3 * Mesh.Opposite[2 * e]];
+                    const double* D = &Positions[3 * Mesh.Opposite[2 * e + 1]];
+                    for (std::size_t i = 0; i < 3; i++) {
+                        New[i] = 0.375 * (A[i] + B[i])
+                            + 0.125 * (C[i] + D[i]);
+                    }
+                }
+                else {
+                    for (std::size_t i = 0; i < 3; i++) {
+                        New[i] = 0.5 * (A[i] + B[i]);
+                    }
+                }
+            }
+        });
+
+    std::vector<std::size_t> RefinedFaces(FaceCount * 12);
+    ForEachRange(FaceCount, WorkerCount,
+        [&](std::size_t First, std::size_t Last) {
+            for (std::size_t f = First; f < Last; f++) {
+                const std::size_t A = Faces[3 * f];
+                const std::size_t B = Faces[3 * f + 1];
+                const std::size_t C = Faces[3 * f + 2];
+                const std::size_t Ab = PointCount + Mesh.EdgeOf[3 * f];
+                const std::size_t Bc = PointCount + Mesh.EdgeOf[3 * f + 1];
+                const std::size_t Ca = PointCount + Mesh.EdgeOf[3 * f + 2];
+                const std::size_t Children[12] = { A, Ab, Ca, Ab, B, Bc,
+                    Ca, Bc, C, Ab, Bc, Ca };
+                std::copy(Children, Children + 12, &RefinedFaces[12 * f]);
+            }
+        });
+
+    std::vector<std::size_t> RefinedLines;
+    RefinedLines.reserve(Lines.size() * 2);
+    for (std::size_t l = 0; l + 1 < Lines.size(); l += 2) {
+        const std::uint64_t Low = std::min(Lines[l], Lines[l + 1]);
+        const std::uint64_t High = std::max(Lines[l], Lines[l + 1]);
+        auto It = std::lower_bound(Mesh.EdgeKeys.begin(), Mesh.EdgeKeys.end(),
+            Low << 32 | High);
+        std::size_t Middle;
+        if (It != Mesh.EdgeKeys.end() && *It == (Low << 32 | High)) {
+            Middle = PointCount + static_cast<std::size_t>(
+                It - Mesh.EdgeKeys.begin());
+        }
+        else {
+            Middle = Refined.size() / 3;
+            for (std::size_t i = 0; i < 3; i++) {
+                Refined.push_back(0.5 * (Refined[3 * Lines[l] + i]
+                    + Refined[3 * Lines[l + 1] + i]));
+            }
+        }//不与边重合的线取两端新位置的中点
+        const std::size_t Halves[4] = { Lines[l], Middle, Middle,
+            Lines[l + 1] };
+        RefinedLines.insert(RefinedLines.end(), Halves, Halves + 4);
+    }
+
+    Positions.swap(Refined);
+    Faces.swap(RefinedFaces);
+    Lines.swap(RefinedLines);
+    return static_cast<std::size_t>(std::count_if(Mesh.FaceCounts.begin(),
+        Mesh.FaceCounts.end(), [](std::size_t Count) {
+            return Count != 2;
+        }));
+}
+
+/*******************************************************************************
+【函数名称】 LoopSubdivider
+【函数功能】 构造函数
+【参数】
+    - std::size_t WorkerCount（输入参数）：线程数，为0时取硬件线程数
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+LoopSubdivider::LoopSubdivider(std::size_t WorkerCount):
+    m_WorkerCount(WorkerCount != 0 ? WorkerCount
+        : std::max<std::size_t>(1, std::thread::hardware_concurrency())) {}
+
+/*******************************************************************************
+【函数名称】 Subdivide
+【函数功能】 焊接重合的点后取出坐标与点序号，逐级细分，最后一次性构造结果模型
+【参数】
+    - const Model<3>& Source（输入参数）：模型
+    - std::size_t Levels（输入参数）：细分的级数，为0时只焊接
+    - Model<3>& Result（输出参数）：细分后的模型
+【返回值】 SubdivisionReport：细分结果
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+SubdivisionReport LoopSubdivider::Subdivide(const Model<3>& Source,
+    std::size_t Levels, Model<3>& Result) const {
+    auto Start = std::chrono::steady_clock::now();
+    SubdivisionReport Report{};
+    Report.Levels = Levels;
+    std::vector<double> Positions;
+    std::vector<std::size_t> Faces;
+    std::vector<std::size_t> Lines;
+    {
+        IndexedModel<3> Indexed(Source, true);
+        Positions.resize(Indexed.Points.size() * 3);
+        for (std::size_t p = 0; p < Indexed.Points.size(); p++) {
+            for (std::size_t i = 0; i < 3; i++) {
+                Positions[3 * p + i] = Indexed.Points[p]->GetCoordinate(i);
+            }
+        }
+        Faces = Indexed.FaceIndices;
+        Lines = Indexed.LineIndices;
+    }//索引视图持有原模型的点，用完即释放
+    Report.FacesBefore = Faces.size() / 3;
+    Report.PointsBefore = Positions.size() / 3;
+    for (std::size_t Level = 0; Level < Levels; Level++) {
+        std::size_t Boundary = SubdivideOnce(Positions, Faces, Lines,
+            m_WorkerCount);
+        if (Level == 0) {
+            Report.BoundaryEdges = Boundary;
+        }
+    }
+    Report.FacesAfter = Faces.size() / 3;
+    Report.PointsAfter = Positions.size() / 3;
+    std::string Name = Source.Name;
+    Result.Assign(Positions, Lines, Faces);
+    Result.SetName(Name);
+    Report.Seconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - Start).count();
+    return Report;
+}
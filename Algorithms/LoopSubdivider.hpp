@@ -0,0 +1,88 @@
+/*******************************************************************************
+【文件名】 LoopSubdivider.hpp
+【功能模块和目的】 定义LoopSubdivider类与SubdivisionReport结构体，用Loop细分规则
+把三角形网格逐级加密并使其光滑
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+#ifndef LOOP_SUBDIVIDER_HPP
+#define LOOP_SUBDIVIDER_HPP
+
+#include <cstddef>
+#include "../Models/Model.hpp"
+
+/*******************************************************************************
+【结构体名】 SubdivisionReport
+【功能】 结构体，表示一次细分的结果
+【接口说明】
+    - std::size_t Levels
+        细分的级数
+    - std::size_t FacesBefore
+        细分前（焊接后）的面数
+    - std::size_t FacesAfter
+        细分后的面数
+    - std::size_t PointsBefore
+        细分前（焊接后）的点数
+    - std::size_t PointsAfter
+        细分后的点数
+    - std::size_t BoundaryEdges
+        细分前的边界边数（只属于一个面或属于两个以上面的边）
+    - double Seconds
+        细分的耗时（秒）
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+struct SubdivisionReport {
+    std::size_t Levels;
+    std::size_t FacesBefore;
+    std::size_t FacesAfter;
+    std::size_t PointsBefore;
+    std::size_t PointsAfter;
+    std::size_t BoundaryEdges;
+    double Seconds;
+};
+
+/*******************************************************************************
+【类名】 LoopSubdivider
+【功能】 Loop细分器。先焊接重合的点得到索引形式的网格，之后每一级只在坐标数组与
+点序号数组上进行：
+    1. 邻接：把各面的三条半边按（小序号，大序号）基数排序，相邻的相同键合并为一条
+    边，记下每条半边所属的边与每条边两侧的对顶点；再按边建立各点的邻接表（CSR）
+    2. 新点：各线程分段计算每条边的边点与每个旧点的新位置，直接写入预先分配好的
+    坐标数组，旧点在前、边点在后
+    3. 新面：每个面分为四个，各线程直接写入预先分配好的序号数组，朝向不变
+内部边取3/8·(a + b) + 1/8·(c + d)；内部点按Loop的权重
+β = (5/8 - (3/8 + cos(2π/n)/4)^2) / n与n个邻点平均；边界边取中点，恰有两条边界边的
+边界点取3/4·v + 1/8·(b1 + b2)，其余（角点、非流形点）保持不动。
+线在中点处一分为二：线与网格的边重合时用该边的边点，否则取两端新位置的中点。
+所有级完成后才用Model::Assign一次构造结果模型，不为每个对象单独分配内存。
+每级面数变为4倍，点数约为4倍
+【接口说明】
+    - LoopSubdivider(std::size_t WorkerCount = 0)
+        构造函数，WorkerCount为0时取硬件线程数
+    - const std::size_t& WorkerCount
+        线程数
+    - SubdivisionReport Subdivide(const Model<3>& Source, std::size_t Levels,
+        Model<3>& Result) const
+        把Source细分Levels级，结果替换Result的线和面，名称取Source的名称；
+        Source与Result可以是同一个模型
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+class LoopSubdivider {
+    public:
+        explicit LoopSubdivider(std::size_t WorkerCount = 0);
+        LoopSubdivider(const LoopSubdivider& Other) = delete;
+        LoopSubdivider& operator=(const LoopSubdivider& Other) = delete;
+
+        const std::size_t& WorkerCount { m_WorkerCount };
+
+        //细分模型
+        SubdivisionReport Subdivide(const Model<3>& Source, std::size_t Levels,
+            Model<3>& Result) const;
+
+    private:
+        std::size_t m_WorkerCount;
+};
+
+#endif // LOOP_SUBDIVIDER_HPP
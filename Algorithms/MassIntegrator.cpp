@@ -0,0 +1,171 @@
+/*******************************************************************************
+【文件名】 MassIntegrator.cpp
+【功能模块和目的】 实现MassIntegrator类，单次并行遍历计算质量属性
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <thread>
+#include <vector>
+#include "MassIntegrator.hpp"
+
+//每个线程至少处理的面数
+static const std::size_t MinFacesPerWorker = 1 << 14;
+
+//累计量在数组中的位置
+enum SumIndex {
+    AREA = 0,
+    AREA_MOMENT = 1,//3个
+    VOLUME = 4,
+    VOLUME_MOMENT = 5,//3个
+    SECOND_MOMENT = 8,//xx、yy、zz、xy、yz、zx共6个
+    SUM_COUNT = 14
+};
+
+/*******************************************************************************
+【函数名称】 AccumulateFace
+【函数功能】 把一个面及其与参考点构成的四面体的贡献累加到Sums中。设a、b、c为相对
+参考点的顶点坐标，d = a·(b×c)为四面体有向体积的6倍，则体积为d/6，一阶矩为
+d/24·(a+b+c)，二阶矩为d/120·(aaᵀ+bbᵀ+ccᵀ+ssᵀ)，其中s = a+b+c
+【参数】
+    - const Face<3>& F（输入参数）：面
+    - const double* Reference（输入参数）：参考点坐标
+    - double* Sums（输入输出参数）：SUM_COUNT个累计量
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+static void AccumulateFace(const Face<3>& F, const double* Reference,
+    double* Sums) {
+    double A[3];
+    double B[3];
+    double C[3];
+    double S[3];
+    for (std::size_t i = 0; i < 3; i++) {
+        A[i] = F.First->GetCoordinate(i) - Reference[i];
+        B[i] = F.Second->GetCoordinate(i) - Reference[i];
+        C[i] = F.Third->GetCoordinate(i) - Reference[i];
+        S[i] = A[i] + B[i] + C[i];
+    }
+    double U[3] = { B[0] - A[0], B[1] - A[1], B[2] - A[2] };
+    double V[3] = { C[0] - A[0], C[1] - A[1], C[2] - A[2] };
+    double Normal[3] = {
+        U[1] * V[2] - U[2] * V[1],
+        U[2] * V[0] - U[0] * V[2],
+        U[0] * V[1] - U[1] * V[0] };
+    double Area = std::sqrt(Normal[0] * Normal[0]
+        + Normal[1] * Normal[1] + Normal[2] * Normal[2]) / 2;
+    //a·(b×c) = a·((b-a)×(c-a))
+    double D = A[0] * Normal[0] + A[1] * Normal[1] + A[2] * Normal[2];
+    Sums[AREA] += Area;
+    Sums[VOLUME] += D / 6;
+    for (std::size_t i = 0; i < 3; i++) {
+        Sums[AREA_MOMENT + i] += Area * S[i] / 3;
+        Sums[VOLUME_MOMENT + i] += D * S[i] / 24;
+    }
+    for (std::size_t k = 0; k < 6; k++) {
+        std::size_t i = k < 3 ? k : k - 3;
+        std::size_t j = k < 3 ? k : (k - 2) % 3;
+        Sums[SECOND_MOMENT + k] += D / 120 * (A[i] * A[j] + B[i] * B[j]
+            + C[i] * C[j] + S[i] * S[j]);
+    }//k为0到2时是对角项，3到5时依次是xy、yz、zx
+}
+
+/*******************************************************************************
+【函数名称】 MassIntegrator
+【函数功能】 构造函数
+【参数】
+    - std::size_t WorkerCount（输入参数）：线程数，为0时取硬件线程数
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+MassIntegrator::MassIntegrator(std::size_t WorkerCount):
+    m_WorkerCount(WorkerCount != 0 ? WorkerCount
+        : std::max<std::size_t>(1, std::thread::hardware_concurrency())) {}
+
+/*******************************************************************************
+【函数名称】 Integrate
+【函数功能】 多线程累计各段面的面积、体积及其矩，相加后求出质心，并用平行轴定理
+把二阶矩移到体积质心，再换算为惯性张量
+【参数】
+    - const Model<3>& Model（输入参数）：模型
+【返回值】 MassProperties：质量属性，没有面时全为0
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+MassProperties MassIntegrator::Integrate(const Model<3>& Model) const {
+    MassProperties Properties = {};
+    const auto& Faces = Model.Faces;
+    const std::size_t FaceCount = Faces.size();
+    if (FaceCount == 0) {
+        return Properties;
+    }
+    double Reference[3];
+    for (std::size_t i = 0; i < 3; i++) {
+        Reference[i] = Faces[0]->First->GetCoordinate(i);
+    }
+
+    std::size_t Workers = std::max<std::size_t>(1,
+        std::min(m_WorkerCount, FaceCount / MinFacesPerWorker));
+    std::vector<double> Partial(Workers * SUM_COUNT, 0);
+    auto Work = [&](std::size_t w, std::size_t First, std::size_t Last) {
+        double Sums[SUM_COUNT] = {};
+        for (std::size_t f = First; f < Last; f++) {
+            AccumulateFace(*Faces[f], Reference, Sums);
+        }
+        std::copy(Sums, Sums + SUM_COUNT, &Partial[w * SUM_COUNT]);
+    };//先在局部数组中累加，避免线程间伪共享
+    std::vector<std::thread> Threads;
+    for (std::size_t w = 1; w < Workers; w++) {
+        Threads.emplace_back(Work, w, FaceCount * w / Workers,
+            FaceCount * (w + 1) / Workers);
+    }
+    Work(0, 0, FaceCount / Workers);
+    for (auto& Thread: Threads) {
+        Thread.join();
+    }
+    double Sums[SUM_COUNT] = {};
+    for (std::size_t w = 0; w < Workers; w++) {
+        for (std::size_t k = 0; k < SUM_COUNT; k++) {
+            Sums[k] += Partial[w * SUM_COUNT + k];
+        }
+    }
+
+    Properties.SurfaceArea = Sums[AREA];
+    Properties.SignedVolume = Sums[VOLUME];
+    double Offset[3] = {};//体积质心相对参考点的位置
+    for (std::size_t i = 0; i < 3; i++) {
+        Properties.SurfaceCentroid[i] = Reference[i] + (Sums[AREA] > 0
+            ? Sums[AREA_MOMENT + i] / Sums[AREA] : 0);
+        if (Sums[VOLUME] != 0) {
+            Offset[i] = Sums[VOLUME_MOMENT + i] / Sums[VOLUME];
+            Properties.VolumeCentroid[i] = Reference[i] + Offset[i];
+        }
+        else {
+            Properties.VolumeCentroid[i] = Properties.SurfaceCentroid[i];
+        }
+    }
+    if (Sums[VOLUME] == 0) {
+        return Properties;
+    }
+    //关于质心的二阶矩，朝内的网格各项同时为负，乘以体积的符号后与朝向无关
+    double Sign = Sums[VOLUME] > 0 ? 1 : -1;
+    double Second[3][3];
+    for (std::size_t k = 0; k < 6; k++) {
+        std::size_t i = k < 3 ? k : k - 3;
+        std::size_t j = k < 3 ? k : (k - 2) % 3;
+        Second[i][j] = Sign * (Sums[SECOND_MOMENT + k]
+            - Sums[VOLUME] * Offset[i] * Offset[j]);
+        Second[j][i] = Second[i][j];
+    }
+    double Trace = Second[0][0] + Second[1][1] + Second[2][2];
+    for (std::size_t i = 0; i < 3; i++) {
+        for (std::size_t j = 0; j < 3; j++) {
+            Properties.Inertia[i][j] = (i == j ? Trace : 0) - Second[i][j];
+        }
+    }
+    return Properties;
+}
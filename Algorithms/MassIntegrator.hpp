@@ -0,0 +1,71 @@
+/*******************************************************************************
+【文件名】 MassIntegrator.hpp
+【功能模块和目的】 定义MassIntegrator类与MassProperties结构体，一次遍历所有面求出
+封闭网格的体积、质心与惯性张量
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+#ifndef MASS_INTEGRATOR_HPP
+#define MASS_INTEGRATOR_HPP
+
+#include <cstddef>
+#include "../Models/Model.hpp"
+
+/*******************************************************************************
+【结构体名】 MassProperties
+【功能】 结构体，表示模型的质量属性（密度为1）
+【接口说明】
+    - double SurfaceArea
+        面的总面积
+    - double SignedVolume
+        有向体积，面的法向（按右手定则）朝外时为正
+    - double SurfaceCentroid[3]
+        按面积加权的质心
+    - double VolumeCentroid[3]
+        按体积加权的质心，体积为0时同SurfaceCentroid
+    - double Inertia[3][3]
+        关于体积质心的惯性张量，与面的朝向无关；体积为0时全为0
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+struct MassProperties {
+    double SurfaceArea;
+    double SignedVolume;
+    double SurfaceCentroid[3];
+    double VolumeCentroid[3];
+    double Inertia[3][3];
+};
+
+/*******************************************************************************
+【类名】 MassIntegrator
+【功能】 质量属性积分器。由散度定理，封闭曲面所围的体积积分等于以某个参考点为顶点、
+以各个面为底的有向四面体的积分之和，每个面只需一次叉积和若干乘加即可累计体积、
+一阶矩与二阶矩；面积和面积矩也在同一次遍历中累计。多个线程各自累计一段面的14个
+和，最后相加，再用平行轴定理把二阶矩移到质心。参考点取第一个面的第一个点，以减小
+远离原点的模型的舍入误差。只对封闭且朝向一致的网格有物理意义
+【接口说明】
+    - MassIntegrator(std::size_t WorkerCount = 0)
+        构造函数，WorkerCount为0时取硬件线程数
+    - const std::size_t& WorkerCount
+        线程数
+    - MassProperties Integrate(const Model<3>& Model) const
+        计算模型所有面的质量属性，线被忽略
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+class MassIntegrator {
+    public:
+        explicit MassIntegrator(std::size_t WorkerCount = 0);
+        MassIntegrator(const MassIntegrator& Other) = delete;
+        MassIntegrator& operator=(const MassIntegrator& Other) = delete;
+
+        const std::size_t& WorkerCount { m_WorkerCount };
+
+        //计算模型的质量属性
+        MassProperties Integrate(const Model<3>& Model) const;
+
+    private:
+        std::size_t m_WorkerCount;
+};
+
+#endif // MASS_INTEGRATOR_HPP
@@ -0,0 +1,455 @@
+/*******************************************************************************
+【文件名】 MeshSimplifier.cpp
+【功能模块和目的】 实现MeshSimplifier类，二次误差边折叠简化
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <queue>
+#include <utility>
+#include <vector>
+#include "MeshSimplifier.hpp"
+#include "../Models/Face.hpp"
+#include "../Models/IndexedModel.hpp"
+#include "../Models/Line.hpp"
+#include "../Models/Point.hpp"
+
+using Vector3 = std::array<double, 3>;
+
+//边界约束平面相对于普通面平面的权重，使开放边界基本保持不动
+static const double BoundaryWeight = 1000.0;
+
+static Vector3 Subtract(const Vector3& A, const Vector3& B) {
+    return { A[0] - B[0], A[1] - B[1], A[2] - B[2] };
+}
+
+static Vector3 Cross(const Vector3& A, const Vector3& B) {
+    return {
+        A[1] * B[2] - A[2] * B[1],
+        A[2] * B[0] - A[0] * B[2],
+        A[0] * B[1] - A[1] * B[0]
+    };
+}
+
+static double Dot(const Vector3& A, const Vector3& B) {
+    return A[0] * B[0] + A[1] * B[1] + A[2] * B[2];
+}
+
+/*******************************************************************************
+【结构体名】 Quadric
+【功能】 点的误差二次型，即一组平面距离平方和的系数，按
+a², ab, ac, ad, b², bc, bd, c², cd, d²的顺序存放对称4×4矩阵的上三角
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+struct Quadric {
+    double Q[10] = {};
+
+    //加入平面n·x + D = 0（n为单位向量），以Weight加权
+    void AddPlane(const Vector3& Normal, double D, double Weight) {
+        const double& A = Normal[0];
+        const double& B = Normal[1];
+        const double& C = Normal[2];
+        Q[0] += Weight * A * A;
+        Q[1] += Weight * A * B;
+        Q[2] += Weight * A * C;
+        Q[3] += Weight * A * D;
+        Q[4] += Weight * B * B;
+        Q[5] += Weight * B * C;
+        Q[6] += Weight * B * D;
+        Q[7] += Weight * C * C;
+        Q[8] += Weight * C * D;
+        Q[9] += Weight * D * D;
+    }
+
+    Quadric operator+(const Quadric& Other) const {
+        Quadric Sum;
+        for (std::size_t i = 0; i < 10; i++) {
+            Sum.Q[i] = Q[i] + Other.Q[i];
+        }
+        return Sum;
+    }
+
+    //点P处的误差
+    double Evaluate(const Vector3& P) const {
+        const double& X = P[0];
+        const double& Y = P[1];
+        const double& Z = P[2];
+        double Error = Q[0] * X * X + 2 * Q[1] * X * Y + 2 * Q[2] * X * Z
+            + 2 * Q[3] * X + Q[4] * Y * Y + 2 * Q[5] * Y * Z + 2 * Q[6] * Y
+            + Q[7] * Z * Z + 2 * Q[8] * Z + Q[9];
+        return std::max(0.0, Error);//消除舍入误差造成的负值
+    }
+
+    //求误差最小的点，矩阵接近奇异时返回false
+    bool Minimize(Vector3* P) const {
+        double A[3][3] = {
+            { Q[0], Q[1], Q[2] },
+            { Q[1], Q[4], Q[5] },
+            { Q[2], Q[5], Q[7] }
+        };
+        Vector3 B = { -Q[3], -Q[6], -Q[8] };
+        double Det = A[0][0] * (A[1][1] * A[2][2] - A[1][2] * A[2][1])
+            - A[0][1] * (A[1][0] * A[2][2] - A[1][2] * A[2][0])
+            + A[0][2] * (A[1][0] * A[2][1] - A[1][1] * A[2][0]);
+        double Scale = std::max({ std::fabs(Q[0]), std::fabs(Q[4]),
+            std::fabs(Q[7]) });
+        if (!(std::fabs(Det) > 1e-10 * Scale * Scale * Scale)) {
+            return false;
+        }
+        for (std::size_t Column = 0; Column < 3; Column++) {
+            double M[3][3];
+            for (std::size_t i = 0; i < 3; i++) {
+                for (std::size_t j = 0; j < 3; j++) {
+                    M[i][j] = (j == Column) ? B[i] : A[i][j];
+                }
+            }
+            (*P)[Column] = (M[0][0] * (M[1][1] * M[2][2] - M[1][2] * M[2][1])
+                - M[0][1] * (M[1][0] * M[2][2] - M[1][2] * M[2][0])
+                + M[0][2] * (M[1][0] * M[2][1] - M[1][1] * M[2][0])) / Det;
+        }//克莱姆法则
+        return true;
+    }
+};
+
+/*******************************************************************************
+【结构体名】 EdgeEntry
+【功能】 堆中的候选边。端点的版本号与记录时不同说明该项已过期
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+struct EdgeEntry {
+    double Cost;
+    std::size_t U;
+    std::size_t V;
+    std::uint32_t StampU;
+    std::uint32_t StampV;
+
+    bool operator>(const EdgeEntry& Other) const {
+        return Cost > Other.Cost;
+    }
+};
+
+/*******************************************************************************
+【函数名称】 ChooseTarget
+【函数功能】 为折叠后的点选择位置：二次型可逆时取其极小点，否则在两个端点与中点
+中取误差最小者
+【参数】
+    - const Quadric& Sum（输入参数）：两个端点二次型之和
+    - const Vector3& P1（输入参数）：第一个端点
+    - const Vector3& P2（输入参数）：第二个端点
+【返回值】 Vector3：折叠后的位置
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+static Vector3 ChooseTarget(const Quadric& Sum, const Vector3& P1,
+    const Vector3& P2) {
+    Vector3 Target;
+    if (Sum.Minimize(&Target)) {
+        return Target;
+    }
+    Vector3 Middle = {
+        (P1[0] + P2[0]) / 2, (P1[1] + P2[1]) / 2, (P1[2] + P2[2]) / 2 };
+    Target = Middle;
+    double Best = Sum.Evaluate(Middle);
+    for (const Vector3* Candidate: { &P1, &P2 }) {
+        double Error = Sum.Evaluate(*Candidate);
+        if (Error < Best) {
+            Best = Error;
+            Target = *Candidate;
+        }
+    }
+    return Target;
+}
+
+/*******************************************************************************
+【函数名称】 MeshSimplifier
+【函数功能】 构造函数
+【参数】
+    - std::size_t TargetFaceCount（输入参数）：目标面数
+    - double MaxError（输入参数）：允许的最大二次误差，默认不限
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+MeshSimplifier::MeshSimplifier(std::size_t TargetFaceCount, double MaxError):
+    m_TargetFaceCount(TargetFaceCount), m_MaxError(MaxError) {}
+
+/*******************************************************************************
+【函数名称】 Simplify
+【函数功能】 简化模型的面。先焊接重合的点建立索引，累积每个点的二次型并把所有边
+放入小根堆；反复折叠误差最小的有效边，直到面数不超过目标或误差超过上限；
+最后用剩余的点和面替换模型内容，面的相对顺序与朝向保持不变
+【参数】
+    - Model<3>& Model（输入输出参数）：模型
+【返回值】 SimplifyReport：简化结果
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+SimplifyReport MeshSimplifier::Simplify(Model<3>& Model) const {
+    IndexedModel<3> Indexed(Model, true);
+    const std::size_t PointCount = Indexed.Points.size();
+    const std::size_t FaceCount = Indexed.FaceIndices.size() / 3;
+
+    std::vector<Vector3> Positions(PointCount);
+    for (std::size_t i = 0; i < PointCount; i++) {
+        for (std::size_t k = 0; k < 3; k++) {
+            Positions[i][k] = Indexed.Points[i]->GetCoordinate(k);
+        }
+    }
+    std::vector<std::array<std::size_t, 3>> Faces(FaceCount);
+    std::vector<std::vector<std::size_t>> PointFaces(PointCount);
+    std::vector<Quadric> Quadrics(PointCount);
+    std::vector<std::pair<std::pair<std::size_t, std::size_t>, std::size_t>>
+        EdgeFaces;
+    EdgeFaces.reserve(FaceCount * 3);
+    for (std::size_t f = 0; f < FaceCount; f++) {
+        for (std::size_t k = 0; k < 3; k++) {
+            Faces[f][k] = Indexed.FaceIndices[f * 3 + k];
+            PointFaces[Faces[f][k]].push_back(f);
+        }
+        const Vector3& P0 = Positions[Faces[f][0]];
+        Vector3 Normal = Cross(Subtract(Positions[Faces[f][1]], P0),
+            Subtract(Positions[Faces[f][2]], P0));
+        double Length = std::sqrt(Dot(Normal, Normal));
+        if (Length > 0) {
+            for (double& Component: Normal) {
+                Component /= Length;
+            }
+            double D = -Dot(Normal, P0);
+            for (std::size_t k = 0; k < 3; k++) {
+                Quadrics[Faces[f][k]].AddPlane(Normal, D, Length / 2);
+            }//以面积加权
+        }
+        for (std::size_t k = 0; k < 3; k++) {
+            std::size_t A = Faces[f][k];
+            std::size_t B = Faces[f][(k + 1) % 3];
+            EdgeFaces.push_back({ { std::min(A, B), std::max(A, B) }, f });
+        }
+    }
+    std::sort(EdgeFaces.begin(), EdgeFaces.end());
+
+    std::vector<std::uint32_t> Stamps(PointCount, 0);
+    std::vector<EdgeEntry> Entries;
+    auto MakeEntry = [&](std::size_t U, std::size_t V) {
+        Quadric Sum = Quadrics[U] + Quadrics[V];
+        Vector3 Target = ChooseTarget(Sum, Positions[U], Positions[V]);
+        return EdgeEntry{ Sum.Evaluate(Target), U, V, Stamps[U], Stamps[V] };
+    };
+    for (std::size_t i = 0; i < EdgeFaces.size(); ) {
+        std::size_t j = i;
+        while (j < EdgeFaces.size() && EdgeFaces[j].first == EdgeFaces[i].first) {
+            j++;
+        }
+        std::size_t U = EdgeFaces[i].first.first;
+        std::size_t V = EdgeFaces[i].first.second;
+        if (j - i == 1) {
+            const auto& Face = Faces[EdgeFaces[i].second];
+            const Vector3& P0 = Positions[Face[0]];
+            Vector3 Normal = Cross(Subtract(Positions[Face[1]], P0),
+                Subtract(Positions[Face[2]], P0));
+            Vector3 Edge = Subtract(Positions[V], Positions[U]);
+            Vector3 Side = Cross(Edge, Normal);
+            double Length = std::sqrt(Dot(Side, Side));
+            if (Length > 0) {
+                for (double& Component: Side) {
+                    Component /= Length;
+                }
+                double D = -Dot(Side, Positions[U]);
+                double Weight = BoundaryWeight * Dot(Edge, Edge);
+                Quadrics[U].AddPlane(Side, D, Weight);
+                Quadrics[V].AddPlane(Side, D, Weight);
+            }
+        }//只属于一个面的边是边界，加入过该边且垂直于面的约束平面
+        i = j;
+    }
+    for (std::size_t i = 0; i < EdgeFaces.size(); i++) {
+        if (i == 0 || EdgeFaces[i].first != EdgeFaces[i - 1].first) {
+            Entries.push_back(MakeEntry(
+                EdgeFaces[i].first.first, EdgeFaces[i].first.second));
+        }
+    }//边界二次型全部加入后再计算误差
+    EdgeFaces.clear();
+    EdgeFaces.shrink_to_fit();
+    std::priority_queue<EdgeEntry, std::vector<EdgeEntry>,
+        std::greater<EdgeEntry>> Heap(std::greater<EdgeEntry>(),
+        std::move(Entries));
+
+    std::vector<bool> FaceAlive(FaceCount, true);
+    std::vector<bool> PointAlive(PointCount, true);
+    std::vector<std::size_t> Parent(PointCount);
+    std::iota(Parent.begin(), Parent.end(), 0);
+    auto Prune = [&](std::size_t P) {
+        auto& List = PointFaces[P];
+        List.erase(std::remove_if(List.begin(), List.end(),
+            [&](std::size_t f) { return !FaceAlive[f]; }), List.end());
+    };
+    auto CollectNeighbors = [&](std::size_t P,
+        std::vector<std::size_t>* Neighbors) {
+        Neighbors->clear();
+        for (std::size_t f: PointFaces[P]) {
+            for (std::size_t Q: Faces[f]) {
+                if (Q != P) {
+                    Neighbors->push_back(Q);
+                }
+            }
+        }
+        std::sort(Neighbors->begin(), Neighbors->end());
+        Neighbors->erase(std::unique(Neighbors->begin(), Neighbors->end()),
+            Neighbors->end());
+    };
+    auto Contains = [&](std::size_t f, std::size_t P) {
+        return Faces[f][0] == P || Faces[f][1] == P || Faces[f][2] == P;
+    };
+    //把端点移到Target后，不与两端点同时相邻的面是否翻转或退化
+    auto IsFlipped = [&](std::size_t P, std::size_t Other,
+        const Vector3& Target) {
+        for (std::size_t f: PointFaces[P]) {
+            if (Contains(f, Other)) {
+                continue;
+            }
+            Vector3 Before[3];
+            Vector3 After[3];
+            for (std::size_t k = 0; k < 3; k++) {
+                Before[k] = Positions[Faces[f][k]];
+                After[k] = (Faces[f][k] == P) ? Target : Before[k];
+            }
+            Vector3 Old = Cross(Subtract(Before[1], Before[0]),
+                Subtract(Before[2], Before[0]));
+            Vector3 New = Cross(Subtract(After[1], After[0]),
+                Subtract(After[2], After[0]));
+            if (Dot(New, New) == 0 || Dot(Old, New) <= 0) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    SimplifyReport Report = {};
+    Report.FacesBefore = FaceCount;
+    Report.PointsBefore = PointCount;
+    std::size_t AliveFaces = FaceCount;
+    std::vector<std::size_t> NeighborsU;
+    std::vector<std::size_t> NeighborsV;
+    std::vector<std::size_t> Common;
+    while (AliveFaces > m_TargetFaceCount && !Heap.empty()) {
+        EdgeEntry Entry = Heap.top();
+        Heap.pop();
+        std::size_t U = Entry.U;
+        std::size_t V = Entry.V;
+        if (!PointAlive[U] || !PointAlive[V]
+            || Entry.StampU != Stamps[U] || Entry.StampV != Stamps[V]) {
+            continue;
+        }//过期的候选边
+        if (Entry.Cost > m_MaxError) {
+            break;
+        }
+        Prune(U);
+        Prune(V);
+        std::size_t SharedFaces = 0;
+        for (std::size_t f: PointFaces[U]) {
+            if (Contains(f, V)) {
+                SharedFaces++;
+            }
+        }
+        CollectNeighbors(U, &NeighborsU);
+        CollectNeighbors(V, &NeighborsV);
+        Common.clear();
+        std::set_intersection(NeighborsU.begin(), NeighborsU.end(),
+            NeighborsV.begin(), NeighborsV.end(), std::back_inserter(Common));
+        if (SharedFaces == 0 || Common.size() != SharedFaces) {
+            continue;
+        }//连接条件：公共邻点只能是公共面的第三个顶点，否则折叠会改变拓扑
+        Quadric Sum = Quadrics[U] + Quadrics[V];
+        Vector3 Target = ChooseTarget(Sum, Positions[U], Positions[V]);
+        if (IsFlipped(U, V, Target) || IsFlipped(V, U, Target)) {
+            continue;
+        }
+        for (std::size_t f: PointFaces[U]) {
+            if (Contains(f, V)) {
+                FaceAlive[f] = false;
+                AliveFaces--;
+            }
+        }
+        for (std::size_t f: PointFaces[V]) {
+            if (!FaceAlive[f]) {
+                continue;
+            }
+            for (std::size_t& Q: Faces[f]) {
+                if (Q == V) {
+                    Q = U;
+                }
+            }
+            PointFaces[U].push_back(f);
+        }
+        std::vector<std::size_t>().swap(PointFaces[V]);
+        Positions[U] = Target;
+        Quadrics[U] = Sum;
+        PointAlive[V] = false;
+        Parent[V] = U;
+        Stamps[U]++;
+        Stamps[V]++;
+        Report.Collapses++;
+        Report.MaxError = std::max(Report.MaxError, Entry.Cost);
+        Prune(U);
+        CollectNeighbors(U, &NeighborsU);
+        for (std::size_t W: NeighborsU) {
+            Heap.push(MakeEntry(U, W));
+        }//新点周围的边误差已改变
+    }
+
+    auto Find = [&](std::size_t P) {
+        std::size_t Root = P;
+        while (Parent[Root] != Root) {
+            Root = Parent[Root];
+        }
+        while (Parent[P] != Root) {
+            std::size_t Next = Parent[P];
+            Parent[P] = Root;
+            P = Next;
+        }//路径压缩
+        return Root;
+    };
+    std::vector<std::shared_ptr<Point<3>>> NewPoints(PointCount);
+    auto GetPoint = [&](std::size_t P) {
+        if (!NewPoints[P]) {
+            NewPoints[P] = std::make_shared<Point<3>>(Positions[P].data());
+            Report.PointsAfter++;
+        }
+        return NewPoints[P];
+    };
+    ::Model<3> Simplified(Model.Name);
+    for (std::size_t i = 0; i + 1 < Indexed.LineIndices.size(); i += 2) {
+        std::size_t First = Find(Indexed.LineIndices[i]);
+        std::size_t Second = Find(Indexed.LineIndices[i + 1]);
+        if (First == Second) {
+            continue;
+        }
+        std::shared_ptr<Point<3>> Points[] = { GetPoint(First),
+            GetPoint(Second) };
+        if (Line<3>::IsValid(Points)) {
+            Simplified.AddLineUnchecked(Line<3>(Points));
+        }
+    }//线的端点随所在的点一起移动
+    for (std::size_t f = 0; f < FaceCount; f++) {
+        if (!FaceAlive[f]) {
+            continue;
+        }
+        std::shared_ptr<Point<3>> Points[] = { GetPoint(Faces[f][0]),
+            GetPoint(Faces[f][1]), GetPoint(Faces[f][2]) };
+        if (Face<3>::IsValid(Points)) {
+            Simplified.AddFaceUnchecked(Face<3>(Points));
+        }
+    }
+    Report.FacesAfter = Simplified.Faces.size();
+    Model.Swap(Simplified);
+    return Report;
+}
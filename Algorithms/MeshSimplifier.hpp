@@ -0,0 +1,79 @@
+/*******************************************************************************
+【文件名】 MeshSimplifier.hpp
+【功能模块和目的】 定义MeshSimplifier类与SimplifyReport结构体，用二次误差度量的边折叠
+简化三维模型的面，生成层次细节模型
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+#ifndef MESH_SIMPLIFIER_HPP
+#define MESH_SIMPLIFIER_HPP
+
+#include <cstddef>
+#include <limits>
+#include "../Models/Model.hpp"
+
+/*******************************************************************************
+【结构体名】 SimplifyReport
+【功能】 结构体，表示一次简化的结果
+【接口说明】
+    - std::size_t FacesBefore
+        简化前的面数
+    - std::size_t FacesAfter
+        简化后的面数
+    - std::size_t PointsBefore
+        简化前（焊接后）的点数
+    - std::size_t PointsAfter
+        简化后的点数
+    - std::size_t Collapses
+        执行的边折叠次数
+    - double MaxError
+        已执行的折叠中最大的二次误差
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+struct SimplifyReport {
+    std::size_t FacesBefore;
+    std::size_t FacesAfter;
+    std::size_t PointsBefore;
+    std::size_t PointsAfter;
+    std::size_t Collapses;
+    double MaxError;
+};
+
+/*******************************************************************************
+【类名】 MeshSimplifier
+【功能】 二次误差（Garland-Heckbert）边折叠简化器。每个点累积相邻面所在平面的
+二次型，边界边额外加入垂直于面的约束平面；所有边按折叠误差放入小根堆，每次折叠误差
+最小的边，把两个端点合并到使二次误差最小的位置，再更新新点周围的边。改变拓扑（不满足
+连接条件）或使相邻面翻转的折叠会被跳过。整体为O(n log n)
+【接口说明】
+    - MeshSimplifier(std::size_t TargetFaceCount, double MaxError)
+        构造函数，面数降到TargetFaceCount或下一次折叠的误差超过MaxError时停止
+    - const std::size_t& TargetFaceCount
+        目标面数
+    - const double& MaxError
+        允许的最大二次误差（到相关平面距离的平方和）
+    - SimplifyReport Simplify(Model<3>& Model) const
+        简化模型的面；重合的点先被焊接，线的端点随之移动，退化的线被删除
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+class MeshSimplifier {
+    public:
+        explicit MeshSimplifier(std::size_t TargetFaceCount,
+            double MaxError = std::numeric_limits<double>::infinity());
+        MeshSimplifier(const MeshSimplifier& Other) = delete;
+        MeshSimplifier& operator=(const MeshSimplifier& Other) = delete;
+
+        const std::size_t& TargetFaceCount { m_TargetFaceCount };
+        const double& MaxError { m_MaxError };
+
+        //简化模型
+        SimplifyReport Simplify(Model<3>& Model) const;
+
+    private:
+        std::size_t m_TargetFaceCount;
+        double m_MaxError;
+};
+
+#endif // MESH_SIMPLIFIER_HPP
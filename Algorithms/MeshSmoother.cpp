@@ -0,0 +1,246 @@
+/*******************************************************************************
+【文件名】 MeshSmoother.cpp
+【功能模块和目的】 实现MeshSmoother类，基于排序建立点的邻接表并在两组坐标数组之间
+并行迭代
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include "MeshSmoother.hpp"
+#include "RadixSorter.hpp"
+#include "../Models/IndexedModel.hpp"
+
+//每个线程至少处理的点数
+static const std::size_t MinItemsPerWorker = 1 << 12;
+
+/*******************************************************************************
+【结构体名】 VertexGraph
+【功能】 结构体，表示点的邻接关系：第v个点的邻点为Neighbors中
+[Offsets[v], Offsets[v + 1])的部分，各邻点只出现一次；Pinned[v]非0时该点不动
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+struct VertexGraph {
+    std::vector<std::size_t> Offsets;
+    std::vector<std::size_t> Neighbors;
+    std::vector<char> Pinned;
+};
+
+/*******************************************************************************
+【函数名称】 ForEachRange
+【函数功能】 把[0, Count)均分为若干段，交给多个线程调用Run(First, Last)，调用线程
+处理第一段；数量较少时只用调用线程
+【参数】
+    - std::size_t Count（输入参数）：项数
+    - std::size_t WorkerCount（输入参数）：线程数上限
+    - const Body& Run（输入参数）：处理一段的函数
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+template <typename Body>
+static void ForEachRange(std::size_t Count, std::size_t WorkerCount,
+    const Body& Run) {
+    std::size_t Workers = std::max<std::size_t>(1,
+        std::min(WorkerCount, Count / MinItemsPerWorker));
+    std::vector<std::thread> Threads;
+    for (std::size_t w = 1; w < Workers; w++) {
+        Threads.emplace_back(Run, Count * w / Workers,
+            Count * (w + 1) / Workers);
+    }
+    Run(0, Count / Workers);
+    for (auto& Thread: Threads) {
+        Thread.join();
+    }
+}
+
+/*******************************************************************************
+【函数名称】 BuildGraph
+【函数功能】 把面的各条半边与各条线的键（高32位为小序号，低32位为大序号）基数排序，
+相同的键合并为一条边并统计其所属的面数；面数为1或大于2的边的两端固定。再按各点的
+度数建立邻接表，只有一个邻点的点也固定
+【参数】
+    - const IndexedModel<3>& Indexed（输入参数）：焊接后的索引视图
+    - std::size_t WorkerCount（输入参数）：排序使用的线程数
+    - VertexGraph* GraphPtr（输出参数）：邻接关系
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+static void BuildGraph(const IndexedModel<3>& Indexed,
+    std::size_t WorkerCount, VertexGraph* GraphPtr) {
+    VertexGraph& Graph = *GraphPtr;
+    const std::vector<std::size_t>& Faces = Indexed.FaceIndices;
+    const std::vector<std::size_t>& Lines = Indexed.LineIndices;
+    const std::size_t PointCount = Indexed.Points.size();
+    const std::size_t HalfEdgeCount = Faces.size();
+    auto KeyOf = [](std::uint64_t From, std::uint64_t To) {
+        return std::min(From, To) << 32 | std::max(From, To);
+    };
+    std::vector<RadixSorter::Item> Items;
+    Items.reserve(HalfEdgeCount + Lines.size() / 2);
+    for (std::size_t h = 0; h < HalfEdgeCount; h++) {
+        Items.push_back(RadixSorter::Item{
+            KeyOf(Faces[h], Faces[h - h % 3 + (h + 1) % 3]), h });
+    }
+    for (std::size_t l = 0; l + 1 < Lines.size(); l += 2) {
+        Items.push_back(RadixSorter::Item{
+            KeyOf(Lines[l], Lines[l + 1]), HalfEdgeCount + l });
+    }//序号不小于半边数的项来自线
+    RadixSorter(WorkerCount).Sort(Items);
+
+    std::vector<std::uint64_t> EdgeKeys;
+    Graph.Pinned.assign(PointCount, 0);
+    std::size_t FaceCount = 0;
+    for (std::size_t i = 0; i <= Items.size(); i++) {
+        if (i > 0 && (i == Items.size() || Items[i].Key != Items[i - 1].Key)) {
+            if (FaceCount != 0 && FaceCount != 2) {
+                Graph.Pinned[EdgeKeys.back() >> 32] = 1;
+                Graph.Pinned[EdgeKeys.back() & 0xffffffffULL] = 1;
+            }
+            FaceCount = 0;
+        }//上一条边的所有半边与线都已统计
+        if (i == Items.size()) {
+            break;
+        }
+        if (i == 0 || Items[i].Key != Items[i - 1].Key) {
+            EdgeKeys.push_back(Items[i].Key);
+        }
+        FaceCount += Items[i].Index < HalfEdgeCount;
+    }
+
+    Graph.Offsets.assign(PointCount + 1, 0);
+    for (std::uint64_t Key: EdgeKeys) {
+        Graph.Offsets[(Key >> 32) + 1]++;
+        Graph.Offsets[(Key & 0xffffffffULL) + 1]++;
+    }
+    for (std::size_t v = 0; v < PointCount; v++) {
+        if (Graph.Offsets[v + 1] == 1) {
+            Graph.Pinned[v] = 1;
+        }
+        Graph.Offsets[v + 1] += Graph.Offsets[v];
+    }
+    Graph.Neighbors.resize(2 * EdgeKeys.size());
+    std::vector<std::size_t> Cursor(Graph.Offsets.begin(),
+        Graph.Offsets.end() - 1);
+    for (std::uint64_t Key: EdgeKeys) {
+        std::size_t Small = static_cast<std::size_t>(Key >> 32);
+        std::size_t Large = static_cast<std::size_t>(Key & 0xffffffffULL);
+        Graph.Neighbors[Cursor[Small]++] = Large;
+        Graph.Neighbors[Cursor[Large]++] = Small;
+    }
+}
+
+/*******************************************************************************
+【函数名称】 MeshSmoother
+【函数功能】 构造函数
+【参数】
+    - std::size_t WorkerCount（输入参数）：线程数，为0时取硬件线程数
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+MeshSmoother::MeshSmoother(std::size_t WorkerCount):
+    m_WorkerCount(WorkerCount != 0 ? WorkerCount
+        : std::max<std::size_t>(1, std::thread::hardware_concurrency())) {}
+
+/*******************************************************************************
+【函数名称】 Smooth
+【函数功能】 焊接重合的点后建立邻接表，把坐标按分量取出到三个数组中，交替以
+Lambda与Mu各做Iterations步平滑：v' = v + 系数·(邻点的平均 - v)。
+完成后把坐标写回模型中的点对象，重合的点对象被移到同一位置
+【参数】
+    - Model<3>& Model（输入输出参数）：模型
+    - std::size_t Iterations（输入参数）：迭代次数
+    - double Lambda（输入参数）：收缩步的系数，应在0与1之间
+    - double Mu（输入参数）：膨胀步的系数，应小于-Lambda
+【返回值】 SmoothingReport：光顺结果
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+SmoothingReport MeshSmoother::Smooth(Model<3>& Model, std::size_t Iterations,
+    double Lambda, double Mu) const {
+    auto Start = std::chrono::steady_clock::now();
+    SmoothingReport Report{};
+    Report.Iterations = Iterations;
+    IndexedModel<3> Indexed(Model, true);
+    const std::size_t PointCount = Indexed.Points.size();
+    VertexGraph Graph;
+    BuildGraph(Indexed, m_WorkerCount, &Graph);
+    Report.PointCount = PointCount;
+    Report.PinnedPoints = static_cast<std::size_t>(
+        std::count(Graph.Pinned.begin(), Graph.Pinned.end(), 1));
+
+    std::vector<double> X(PointCount);
+    std::vector<double> Y(PointCount);
+    std::vector<double> Z(PointCount);
+    for (std::size_t v = 0; v < PointCount; v++) {
+        X[v] = Indexed.Points[v]->GetCoordinate(0);
+        Y[v] = Indexed.Points[v]->GetCoordinate(1);
+        Z[v] = Indexed.Points[v]->GetCoordinate(2);
+    }
+    std::vector<double> NextX(PointCount);
+    std::vector<double> NextY(PointCount);
+    std::vector<double> NextZ(PointCount);
+    auto Step = [&](double Factor) {
+        ForEachRange(PointCount, m_WorkerCount,
+            [&](std::size_t First, std::size_t Last) {
+                for (std::size_t v = First; v < Last; v++) {
+                    const std::size_t Begin = Graph.Offsets[v];
+                    const std::size_t End = Graph.Offsets[v + 1];
+                    if (Graph.Pinned[v] != 0 || Begin == End) {
+                        NextX[v] = X[v];
+                        NextY[v] = Y[v];
+                        NextZ[v] = Z[v];
+                        continue;
+                    }
+                    double SumX = 0;
+                    double SumY = 0;
+                    double SumZ = 0;
+                    for (std::size_t k = Begin; k < End; k++) {
+                        const std::size_t n = Graph.Neighbors[k];
+                        SumX += X[n];
+                        SumY += Y[n];
+                        SumZ += Z[n];
+                    }
+                    const double Weight = Factor / (End - Begin);
+                    NextX[v] = X[v] + (SumX * Weight - Factor * X[v]);
+                    NextY[v] = Y[v] + (SumY * Weight - Factor * Y[v]);
+                    NextZ[v] = Z[v] + (SumZ * Weight - Factor * Z[v]);
+                }
+            });//只读当前数组、只写本段的下一数组，线程之间不冲突
+        X.swap(NextX);
+        Y.swap(NextY);
+        Z.swap(NextZ);
+    };
+    for (std::size_t i = 0; i < Iterations; i++) {
+        Step(Lambda);
+        Step(Mu);
+    }
+
+    std::vector<double> Positions(PointCount * 3);
+    for (std::size_t v = 0; v < PointCount; v++) {
+        Positions[3 * v] = X[v];
+        Positions[3 * v + 1] = Y[v];
+        Positions[3 * v + 2] = Z[v];
+        double Distance = std::sqrt(
+            std::pow(X[v] - Indexed.Points[v]->GetCoordinate(0), 2)
+            + std::pow(Y[v] - Indexed.Points[v]->GetCoordinate(1), 2)
+            + std::pow(Z[v] - Indexed.Points[v]->GetCoordinate(2), 2));
+        Report.MaxDisplacement = std::max(Report.MaxDisplacement, Distance);
+    }
+    Model.MovePoints([&](const Point<3>* P) -> const double* {
+        std::size_t Index = Indexed.IndexOf(P);
+        return Index == IndexedModel<3>::NotFound ? nullptr
+            : &Positions[3 * Index];
+    });
+    Report.Seconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - Start).count();
+    return Report;
+}
@@ -0,0 +1,74 @@
+/*******************************************************************************
+【文件名】 MeshSmoother.hpp
+【功能模块和目的】 定义MeshSmoother类与SmoothingReport结构体，用Taubin方法去除
+扫描得到的网格上的噪声而基本不使模型收缩
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+#ifndef MESH_SMOOTHER_HPP
+#define MESH_SMOOTHER_HPP
+
+#include <cstddef>
+#include "../Models/Model.hpp"
+
+/*******************************************************************************
+【结构体名】 SmoothingReport
+【功能】 结构体，表示一次光顺的结果
+【接口说明】
+    - std::size_t Iterations
+        迭代次数（每次含一步收缩与一步膨胀）
+    - std::size_t PointCount
+        焊接后的点数
+    - std::size_t PinnedPoints
+        固定不动的点数（边界点、非流形点与孤立的端点）
+    - double MaxDisplacement
+        点移动的最大距离
+    - double Seconds
+        光顺的耗时（秒）
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+struct SmoothingReport {
+    std::size_t Iterations;
+    std::size_t PointCount;
+    std::size_t PinnedPoints;
+    double MaxDisplacement;
+    double Seconds;
+};
+
+/*******************************************************************************
+【类名】 MeshSmoother
+【功能】 Taubin光顺器。先焊接重合的点得到点的序号，把线和面的边基数排序去重后
+一次建立点的邻接表（CSR），之后的迭代只在按x、y、z分开存放的两组坐标数组之间
+交替进行：各线程分段读取当前数组、写入另一数组，每步结束后交换。
+每次迭代先以λ > 0做一步均匀权重的拉普拉斯平滑，再以μ < -λ做一步反向的平滑，
+抵消单纯拉普拉斯平滑带来的收缩。只属于一个面或属于两个以上面的边的端点，以及只有
+一个邻点的点保持不动。最后原地修改模型中的点对象，共享同一点的线和面仍然相连
+【接口说明】
+    - MeshSmoother(std::size_t WorkerCount = 0)
+        构造函数，WorkerCount为0时取硬件线程数
+    - const std::size_t& WorkerCount
+        线程数
+    - SmoothingReport Smooth(Model<3>& Model, std::size_t Iterations,
+        double Lambda = 0.5, double Mu = -0.53) const
+        对模型迭代Iterations次，点数不超过2^32
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+class MeshSmoother {
+    public:
+        explicit MeshSmoother(std::size_t WorkerCount = 0);
+        MeshSmoother(const MeshSmoother& Other) = delete;
+        MeshSmoother& operator=(const MeshSmoother& Other) = delete;
+
+        const std::size_t& WorkerCount { m_WorkerCount };
+
+        //光顺模型
+        SmoothingReport Smooth(Model<3>& Model, std::size_t Iterations,
+            double Lambda = 0.5, double Mu = -0.53) const;
+
+    private:
+        std::size_t m_WorkerCount;
+};
+
+#endif // MESH_SMOOTHER_HPP
@@ -0,0 +1,153 @@
+/*******************************************************************************
+【文件名】 MortonReorderer.cpp
+【功能模块和目的】 实现MortonReorderer类，Morton码计算与模型的空间重排
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+#include "MortonReorderer.hpp"
+#include "RadixSorter.hpp"
+
+//每维量化的位数，3维共63位
+static const std::uint32_t BitsPerAxis = 21;
+
+/*******************************************************************************
+【函数名称】 SpreadBits
+【函数功能】 把21位整数的各位分散到结果的第0、3、6……位
+【参数】
+    - std::uint64_t Value（输入参数）：21位整数
+【返回值】 std::uint64_t：分散后的整数
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+static std::uint64_t SpreadBits(std::uint64_t Value) {
+    Value &= 0x1fffff;
+    Value = (Value | Value << 32) & 0x1f00000000ffffULL;
+    Value = (Value | Value << 16) & 0x1f0000ff0000ffULL;
+    Value = (Value | Value << 8) & 0x100f00f00f00f00fULL;
+    Value = (Value | Value << 4) & 0x10c30c30c30c30c3ULL;
+    Value = (Value | Value << 2) & 0x1249249249249249ULL;
+    return Value;
+}
+
+/*******************************************************************************
+【函数名称】 MortonReorderer
+【函数功能】 构造函数
+【参数】
+    - std::size_t WorkerCount（输入参数）：排序使用的线程数，为0时取硬件线程数
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+MortonReorderer::MortonReorderer(std::size_t WorkerCount):
+    m_WorkerCount(WorkerCount) {}
+
+/*******************************************************************************
+【函数名称】 Encode
+【函数功能】 把[0, 1]内的三维坐标量化为每维21位并按x、y、z交错
+【参数】
+    - const double* Normalized（输入参数）：3个[0, 1]内的坐标，越界的被截断
+【返回值】 std::uint64_t：63位Morton码
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+std::uint64_t MortonReorderer::Encode(const double* Normalized) {
+    const double Scale = static_cast<double>((1u << BitsPerAxis) - 1);
+    std::uint64_t Code = 0;
+    for (std::size_t i = 0; i < 3; i++) {
+        double Value = Normalized[i] * Scale;
+        if (!(Value > 0)) {
+            Value = 0;
+        }//同时处理NaN
+        if (Value > Scale) {
+            Value = Scale;
+        }
+        Code |= SpreadBits(static_cast<std::uint64_t>(Value)) << i;
+    }
+    return Code;
+}
+
+/*******************************************************************************
+【函数名称】 Reorder
+【函数功能】 计算所有点的包围盒，按Morton码排序点、线的中点与面的重心，再按排序
+后的顺序把线、面和点分别搬到连续的内存中；线和面的序号不变
+【参数】
+    - Model<3>& Model（输入输出参数）：模型
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+void MortonReorderer::Reorder(Model<3>& Model) const {
+    std::vector<std::shared_ptr<Point<3>>> Points = Model.CollectPoints();
+    double Min[3];
+    double Extent[3];
+    std::fill(Min, Min + 3, std::numeric_limits<double>::max());
+    std::fill(Extent, Extent + 3, std::numeric_limits<double>::lowest());
+    for (const auto& P: Points) {
+        for (std::size_t i = 0; i < 3; i++) {
+            Min[i] = std::min(Min[i], P->GetCoordinate(i));
+            Extent[i] = std::max(Extent[i], P->GetCoordinate(i));
+        }
+    }
+    for (std::size_t i = 0; i < 3; i++) {
+        Extent[i] -= Min[i];
+    }
+    //把若干点的平均位置归一化到包围盒内后编码
+    auto EncodeMean = [&](const Point<3>* const* Means, std::size_t Count) {
+        double Normalized[3];
+        for (std::size_t i = 0; i < 3; i++) {
+            double Sum = 0;
+            for (std::size_t k = 0; k < Count; k++) {
+                Sum += Means[k]->GetCoordinate(i);
+            }
+            Normalized[i] = Extent[i] > 0
+                ? (Sum / Count - Min[i]) / Extent[i] : 0;
+        }
+        return Encode(Normalized);
+    };
+    RadixSorter Sorter(m_WorkerCount);
+    //按Items的键排序，返回排序后各项原来的位置
+    auto SortedOrder = [&Sorter](std::vector<RadixSorter::Item>& Items) {
+        Sorter.Sort(Items);
+        std::vector<std::size_t> Order(Items.size());
+        for (std::size_t i = 0; i < Items.size(); i++) {
+            Order[i] = Items[i].Index;
+        }
+        return Order;
+    };
+
+    std::vector<RadixSorter::Item> Items(Points.size());
+    for (std::size_t i = 0; i < Items.size(); i++) {
+        const Point<3>* Means[1] = { Points[i].get() };
+        Items[i].Key = EncodeMean(Means, 1);
+        Items[i].Index = i;
+    }
+    std::vector<std::shared_ptr<Point<3>>> Sorted;
+    Sorted.reserve(Points.size());
+    for (std::size_t Index: SortedOrder(Items)) {
+        Sorted.push_back(Points[Index]);
+    }
+    Items.assign(Model.Lines.size(), RadixSorter::Item());
+    for (std::size_t i = 0; i < Items.size(); i++) {
+        const auto& L = Model.Lines[i];
+        const Point<3>* Means[2] = { L->First.get(), L->Second.get() };
+        Items[i].Key = EncodeMean(Means, 2);
+        Items[i].Index = i;
+    }
+    std::vector<std::size_t> LineOrder = SortedOrder(Items);
+    Items.assign(Model.Faces.size(), RadixSorter::Item());
+    for (std::size_t i = 0; i < Items.size(); i++) {
+        const auto& F = Model.Faces[i];
+        const Point<3>* Means[3]
+            = { F->First.get(), F->Second.get(), F->Third.get() };
+        Items[i].Key = EncodeMean(Means, 3);
+        Items[i].Index = i;
+    }
+    std::vector<std::size_t> FaceOrder = SortedOrder(Items);
+    Model.Compact(LineOrder, FaceOrder, Sorted);
+}
@@ -0,0 +1,46 @@
+/*******************************************************************************
+【文件名】 MortonReorderer.hpp
+【功能模块和目的】 定义MortonReorderer类，按Morton码（Z序曲线）重排模型中点、线
+和面的存储，使空间上相邻的元素在内存中也相邻
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+#ifndef MORTON_REORDERER_HPP
+#define MORTON_REORDERER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include "../Models/Model.hpp"
+
+/*******************************************************************************
+【类名】 MortonReorderer
+【功能】 空间重排器。把包围盒内的坐标量化为每维21位的整数并交错为63位Morton码；
+点按自身、线按中点、面按重心的Morton码用并行基数排序排序，再把点、线、面按排序
+后的顺序分别搬到连续的内存中（见Model::Compact）。线和面的序号经模型中的映射
+保持不变，已取得的编号仍然有效
+【接口说明】
+    - MortonReorderer(std::size_t WorkerCount = 0)
+        构造函数，WorkerCount为排序使用的线程数，为0时取硬件线程数
+    - static std::uint64_t Encode(const double* Normalized)
+        把[0, 1]内的三维坐标编码为63位Morton码
+    - void Reorder(Model<3>& Model) const
+        重排模型中点、线和面的存储，线和面的编号不变
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+class MortonReorderer {
+    public:
+        explicit MortonReorderer(std::size_t WorkerCount = 0);
+        MortonReorderer(const MortonReorderer& Other) = delete;
+        MortonReorderer& operator=(const MortonReorderer& Other) = delete;
+
+        //编码63位Morton码
+        static std::uint64_t Encode(const double* Normalized);
+        //按Morton码重排模型
+        void Reorder(Model<3>& Model) const;
+
+    private:
+        std::size_t m_WorkerCount;
+};
+
+#endif // MORTON_REORDERER_HPP
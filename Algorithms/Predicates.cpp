@@ -0,0 +1,233 @@
+/*******************************************************************************
+【文件名】 Predicates.cpp
+【功能模块和目的】 实现Predicates类，浮点过滤加浮点展开式的精确回退
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+#include <cfloat>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+#include "Predicates.hpp"
+
+//双精度浮点数的舍入误差单位，即2^-53
+static const double Epsilon = DBL_EPSILON / 2;
+//Orient2D浮点结果可信的相对误差上界
+static const double Orient2DBound = (3 + 16 * Epsilon) * Epsilon;
+//Orient3D浮点结果可信的相对误差上界
+static const double Orient3DBound = (7 + 56 * Epsilon) * Epsilon;
+
+//浮点展开式：若干个互不重叠的double，按绝对值从小到大排列，其和为所表示的数
+using Expansion = std::vector<double>;
+
+/*******************************************************************************
+【函数名称】 Grow
+【函数功能】 把一个double精确地加到展开式上（Shewchuk的Grow-Expansion）：从小到大
+依次用Two-Sum把它与各分量相加，每步的舍入误差成为结果的一个分量
+【参数】
+    - const Expansion& Value（输入参数）：展开式
+    - double Addend（输入参数）：加数
+【返回值】 Expansion：和，仍是互不重叠、从小到大排列的展开式
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+static Expansion Grow(const Expansion& Value, double Addend) {
+    Expansion Sum;
+    Sum.reserve(Value.size() + 1);
+    double Carry = Addend;
+    for (double Component: Value) {
+        double Total = Carry + Component;
+        double Virtual = Total - Carry;
+        double Error = (Carry - (Total - Virtual)) + (Component - Virtual);
+        if (Error != 0) {
+            Sum.push_back(Error);
+        }
+        Carry = Total;
+    }
+    Sum.push_back(Carry);
+    return Sum;
+}
+
+/*******************************************************************************
+【函数名称】 Add
+【函数功能】 两个展开式精确相加
+【参数】
+    - const Expansion& Left（输入参数）：展开式
+    - const Expansion& Right（输入参数）：展开式
+【返回值】 Expansion：和
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+static Expansion Add(Expansion Left, const Expansion& Right) {
+    for (double Component: Right) {
+        Left = Grow(Left, Component);
+    }
+    return Left;
+}
+
+/*******************************************************************************
+【函数名称】 Multiply
+【函数功能】 两个展开式精确相乘：两两分量相乘，乘积的高位与低位（用fma求得的舍入
+误差）都精确地累加到结果中
+【参数】
+    - const Expansion& Left（输入参数）：展开式
+    - const Expansion& Right（输入参数）：展开式
+【返回值】 Expansion：积
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+static Expansion Multiply(const Expansion& Left, const Expansion& Right) {
+    Expansion Product;
+    for (double X: Left) {
+        for (double Y: Right) {
+            double High = X * Y;
+            double Low = std::fma(X, Y, -High);
+            if (Low != 0) {
+                Product = Grow(Product, Low);
+            }
+            Product = Grow(Product, High);
+        }
+    }
+    return Product;
+}
+
+/*******************************************************************************
+【函数名称】 Difference
+【函数功能】 两个double精确相减（Two-Diff），结果为至多两个分量的展开式
+【参数】
+    - double Left（输入参数）：被减数
+    - double Right（输入参数）：减数
+【返回值】 Expansion：差
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+static Expansion Difference(double Left, double Right) {
+    return Grow(Expansion(1, Left), -Right);
+}
+
+/*******************************************************************************
+【函数名称】 Negate
+【函数功能】 展开式取相反数
+【参数】
+    - Expansion Value（输入参数）：展开式
+【返回值】 Expansion：相反数
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+static Expansion Negate(Expansion Value) {
+    for (double& Component: Value) {
+        Component = -Component;
+    }
+    return Value;
+}
+
+/*******************************************************************************
+【函数名称】 Estimate
+【函数功能】 求展开式的近似值，符号与精确值相同：分量互不重叠，最大的非零分量
+决定符号
+【参数】
+    - const Expansion& Value（输入参数）：展开式
+【返回值】 double：近似值
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+static double Estimate(const Expansion& Value) {
+    double Sum = 0;
+    for (double Component: Value) {
+        Sum += Component;
+    }
+    if (Sum == 0) {
+        for (auto It = Value.rbegin(); It != Value.rend(); ++It) {
+            if (*It != 0) {
+                return *It;
+            }
+        }
+    }//各分量从小到大相加不会改变符号，这里只是保险
+    return Sum;
+}
+
+/*******************************************************************************
+【函数名称】 Orient2D
+【函数功能】 求det[A - C; B - C]。浮点结果的绝对值超过误差上界乘以各乘积绝对值之和
+时直接返回，否则用展开式精确计算
+【参数】
+    - const double* A（输入参数）：第一个点
+    - const double* B（输入参数）：第二个点
+    - const double* C（输入参数）：第三个点
+    - std::size_t Ui（输入参数）：第一个平面坐标的分量序号
+    - std::size_t Vi（输入参数）：第二个平面坐标的分量序号
+【返回值】 double：符号精确的行列式
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+double Predicates::Orient2D(const double* A, const double* B,
+    const double* C, std::size_t Ui, std::size_t Vi) {
+    double Left = (A[Ui] - C[Ui]) * (B[Vi] - C[Vi]);
+    double Right = (A[Vi] - C[Vi]) * (B[Ui] - C[Ui]);
+    double Determinant = Left - Right;
+    if (std::fabs(Determinant)
+        > Orient2DBound * (std::fabs(Left) + std::fabs(Right))) {
+        return Determinant;
+    }
+    Expansion Exact = Add(
+        Multiply(Difference(A[Ui], C[Ui]), Difference(B[Vi], C[Vi])),
+        Negate(Multiply(Difference(A[Vi], C[Vi]),
+            Difference(B[Ui], C[Ui]))));
+    return Estimate(Exact);
+}
+
+/*******************************************************************************
+【函数名称】 Orient3D
+【函数功能】 求det[A - D; B - D; C - D]，按第三行展开。浮点结果可信时直接返回，
+否则用展开式精确计算
+【参数】
+    - const double* A（输入参数）：第一个点
+    - const double* B（输入参数）：第二个点
+    - const double* C（输入参数）：第三个点
+    - const double* D（输入参数）：第四个点
+【返回值】 double：符号精确的行列式
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+double Predicates::Orient3D(const double* A, const double* B,
+    const double* C, const double* D) {
+    double Ad[3];
+    double Bd[3];
+    double Cd[3];
+    for (std::size_t i = 0; i < 3; i++) {
+        Ad[i] = A[i] - D[i];
+        Bd[i] = B[i] - D[i];
+        Cd[i] = C[i] - D[i];
+    }
+    double BxCy = Bd[0] * Cd[1];
+    double CxBy = Cd[0] * Bd[1];
+    double CxAy = Cd[0] * Ad[1];
+    double AxCy = Ad[0] * Cd[1];
+    double AxBy = Ad[0] * Bd[1];
+    double BxAy = Bd[0] * Ad[1];
+    double Determinant = Ad[2] * (BxCy - CxBy) + Bd[2] * (CxAy - AxCy)
+        + Cd[2] * (AxBy - BxAy);
+    double Permanent = (std::fabs(BxCy) + std::fabs(CxBy)) * std::fabs(Ad[2])
+        + (std::fabs(CxAy) + std::fabs(AxCy)) * std::fabs(Bd[2])
+        + (std::fabs(AxBy) + std::fabs(BxAy)) * std::fabs(Cd[2]);
+    if (std::fabs(Determinant) > Orient3DBound * Permanent) {
+        return Determinant;
+    }
+    Expansion ExactA[3];
+    Expansion ExactB[3];
+    Expansion ExactC[3];
+    for (std::size_t i = 0; i < 3; i++) {
+        ExactA[i] = Difference(A[i], D[i]);
+        ExactB[i] = Difference(B[i], D[i]);
+        ExactC[i] = Difference(C[i], D[i]);
+    }
+    //二阶子式P·Q的xy分量之差
+    auto Minor = [](const Expansion* P, const Expansion* Q) {
+        return Add(Multiply(P[0], Q[1]), Negate(Multiply(Q[0], P[1])));
+    };
+    Expansion Exact = Add(Add(
+        Multiply(ExactA[2], Minor(ExactB, ExactC)),
+        Multiply(ExactB[2], Minor(ExactC, ExactA))),
+        Multiply(ExactC[2], Minor(ExactA, ExactB)));
+    return Estimate(Exact);
+}
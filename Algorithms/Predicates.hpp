@@ -0,0 +1,41 @@
+/*******************************************************************************
+【文件名】 Predicates.hpp
+【功能模块和目的】 定义Predicates类，提供符号精确的二维、三维方向判定
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+#ifndef PREDICATES_HPP
+#define PREDICATES_HPP
+
+#include <cstddef>
+
+/*******************************************************************************
+【类名】 Predicates
+【功能】 几何谓词。先用浮点数计算行列式，并按Shewchuk给出的误差上界判断结果的符号
+是否可信；不可信时（点几乎共线、共面）改用无误差的浮点展开式（若干个互不重叠的
+double之和）精确计算。返回值的符号总是精确的，绝对值只在浮点结果可信时有意义
+【接口说明】
+    - static double Orient2D(const double* A, const double* B,
+        const double* C, std::size_t Ui, std::size_t Vi)
+        取各点的第Ui与Vi个分量作为平面坐标，A、B、C按逆时针排列时为正，
+        顺时针时为负，共线时为0
+    - static double Orient3D(const double* A, const double* B,
+        const double* C, const double* D)
+        行列式det[A - D; B - D; C - D]：从D看去A、B、C按顺时针排列时为正，
+        逆时针时为负，四点共面时为0
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+class Predicates {
+    public:
+        Predicates() = delete;
+
+        //二维方向判定
+        static double Orient2D(const double* A, const double* B,
+            const double* C, std::size_t Ui, std::size_t Vi);
+        //三维方向判定
+        static double Orient3D(const double* A, const double* B,
+            const double* C, const double* D);
+};
+
+#endif // PREDICATES_HPP
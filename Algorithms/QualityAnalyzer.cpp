@@ -0,0 +1,241 @@
+/*******************************************************************************
+【文件名】 QualityAnalyzer.cpp
+【功能模块和目的】 实现QualityAnalyzer类，分批按分量取出顶点坐标并行计算面的质量
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <thread>
+#include <vector>
+#include "QualityAnalyzer.hpp"
+
+//每个线程至少处理的面数
+static const std::size_t MinFacesPerWorker = 1 << 12;
+//每批按分量取出坐标的面数
+static const std::size_t BatchSize = 256;
+//形状质量不超过该值的面视为退化
+static const double DegenerateQuality = 1e-10;
+
+/*******************************************************************************
+【结构体名】 QualityTally
+【功能】 结构体，表示一个线程对一段面的累计结果，各项含义同QualityReport；
+ValidFaces为非退化的面数，SumAspectRatio为其长宽比之和
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+struct QualityTally {
+    std::size_t ValidFaces;
+    std::size_t DegenerateFaces;
+    std::size_t PoorFaces;
+    double MinAngle;
+    double MaxAngle;
+    double SumAspectRatio;
+    double MaxAspectRatio;
+    double MinShapeQuality;
+    std::vector<std::size_t> AngleHistogram;
+    std::vector<std::size_t> AspectHistogram;
+    std::vector<std::size_t> FlaggedFaces;
+};
+
+/*******************************************************************************
+【函数名称】 AnalyzeRange
+【函数功能】 分析[First, Last)中的面：每批先把三个顶点的坐标按分量取出到9个数组，
+在数组上计算三个内角（用atan2(|AB×AC|, 点积)，对狭长的面也准确）、长宽比与形状
+质量；再逐面累计直方图并标记退化或超出阈值的面
+【参数】
+    - const Model<3>& Model（输入参数）：模型
+    - std::size_t First（输入参数）：第一个面的序号
+    - std::size_t Last（输入参数）：最后一个面之后的序号
+    - const QualityThresholds& Thresholds（输入参数）：阈值
+    - const std::vector<double>& AspectBounds（输入参数）：长宽比直方图各格的上界
+    - QualityTally* TallyPtr（输出参数）：累计结果
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+static void AnalyzeRange(const Model<3>& Model, std::size_t First,
+    std::size_t Last, const QualityThresholds& Thresholds,
+    const std::vector<double>& AspectBounds, QualityTally* TallyPtr) {
+    QualityTally& Tally = *TallyPtr;
+    const double Pi = std::acos(-1.0);
+    const double Degrees = 180 / Pi;
+    const double Root3 = std::sqrt(3.0);
+    double Ax[BatchSize], Ay[BatchSize], Az[BatchSize];
+    double Bx[BatchSize], By[BatchSize], Bz[BatchSize];
+    double Cx[BatchSize], Cy[BatchSize], Cz[BatchSize];
+    double AngleA[BatchSize], AngleB[BatchSize], AngleC[BatchSize];
+    double Aspect[BatchSize], Quality[BatchSize];
+    for (std::size_t Begin = First; Begin < Last; Begin += BatchSize) {
+        const std::size_t Count = std::min(BatchSize, Last - Begin);
+        for (std::size_t i = 0; i < Count; i++) {
+            const Face<3>& Face = *Model.Faces[Begin + i];
+            Ax[i] = Face.First->GetCoordinate(0);
+            Ay[i] = Face.First->GetCoordinate(1);
+            Az[i] = Face.First->GetCoordinate(2);
+            Bx[i] = Face.Second->GetCoordinate(0);
+            By[i] = Face.Second->GetCoordinate(1);
+            Bz[i] = Face.Second->GetCoordinate(2);
+            Cx[i] = Face.Third->GetCoordinate(0);
+            Cy[i] = Face.Third->GetCoordinate(1);
+            Cz[i] = Face.Third->GetCoordinate(2);
+        }
+        for (std::size_t i = 0; i < Count; i++) {
+            const double ABx = Bx[i] - Ax[i];
+            const double ABy = By[i] - Ay[i];
+            const double ABz = Bz[i] - Az[i];
+            const double ACx = Cx[i] - Ax[i];
+            const double ACy = Cy[i] - Ay[i];
+            const double ACz = Cz[i] - Az[i];
+            const double BCx = Cx[i] - Bx[i];
+            const double BCy = Cy[i] - By[i];
+            const double BCz = Cz[i] - Bz[i];
+            const double Nx = ABy * ACz - ABz * ACy;
+            const double Ny = ABz * ACx - ABx * ACz;
+            const double Nz = ABx * ACy - ABy * ACx;
+            const double TwiceArea = std::sqrt(Nx * Nx + Ny * Ny + Nz * Nz);
+            const double SquaredAB = ABx * ABx + ABy * ABy + ABz * ABz;
+            const double SquaredAC = ACx * ACx + ACy * ACy + ACz * ACz;
+            const double SquaredBC = BCx * BCx + BCy * BCy + BCz * BCz;
+            AngleA[i] = std::atan2(TwiceArea,
+                ABx * ACx + ABy * ACy + ABz * ACz) * Degrees;
+            AngleB[i] = std::atan2(TwiceArea,
+                -(ABx * BCx + ABy * BCy + ABz * BCz)) * Degrees;
+            AngleC[i] = std::atan2(TwiceArea,
+                ACx * BCx + ACy * BCy + ACz * BCz) * Degrees;
+            const double Longest = std::sqrt(
+                std::max(SquaredAB, std::max(SquaredAC, SquaredBC)));
+            const double Perimeter = std::sqrt(SquaredAB)
+                + std::sqrt(SquaredAC) + std::sqrt(SquaredBC);
+            Aspect[i] = Longest * Perimeter / (2 * Root3 * TwiceArea);
+            Quality[i] = 2 * Root3 * TwiceArea
+                / (SquaredAB + SquaredAC + SquaredBC);
+        }//面积为0时长宽比为无穷大，三点重合时形状质量为NaN
+
+        for (std::size_t i = 0; i < Count; i++) {
+            if (!(Quality[i] > DegenerateQuality)) {
+                Tally.DegenerateFaces++;
+                Tally.FlaggedFaces.push_back(Begin + i);
+                continue;
+            }
+            const double Angles[3] = { AngleA[i], AngleB[i], AngleC[i] };
+            double Smallest = 180;
+            double Largest = 0;
+            for (double Angle: Angles) {
+                Smallest = std::min(Smallest, Angle);
+                Largest = std::max(Largest, Angle);
+                std::size_t Bin = std::min(QualityAnalyzer::AngleBinCount - 1,
+                    static_cast<std::size_t>(Angle / 10));
+                Tally.AngleHistogram[Bin]++;
+            }
+            std::size_t AspectBin = static_cast<std::size_t>(
+                std::lower_bound(AspectBounds.begin(), AspectBounds.end() - 1,
+                    Aspect[i]) - AspectBounds.begin());
+            Tally.AspectHistogram[AspectBin]++;
+            Tally.ValidFaces++;
+            Tally.MinAngle = std::min(Tally.MinAngle, Smallest);
+            Tally.MaxAngle = std::max(Tally.MaxAngle, Largest);
+            Tally.SumAspectRatio += Aspect[i];
+            Tally.MaxAspectRatio = std::max(Tally.MaxAspectRatio, Aspect[i]);
+            Tally.MinShapeQuality = std::min(Tally.MinShapeQuality, Quality[i]);
+            if (Aspect[i] > Thresholds.MaxAspectRatio
+                || Smallest < Thresholds.MinAngle
+                || Largest > Thresholds.MaxAngle) {
+                Tally.PoorFaces++;
+                Tally.FlaggedFaces.push_back(Begin + i);
+            }
+        }
+    }
+}
+
+/*******************************************************************************
+【函数名称】 QualityAnalyzer
+【函数功能】 构造函数
+【参数】
+    - std::size_t WorkerCount（输入参数）：线程数，为0时取硬件线程数
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+QualityAnalyzer::QualityAnalyzer(std::size_t WorkerCount):
+    m_WorkerCount(WorkerCount != 0 ? WorkerCount
+        : std::max<std::size_t>(1, std::thread::hardware_concurrency())) {}
+
+/*******************************************************************************
+【函数名称】 Analyze
+【函数功能】 把面均分为若干段交给多个线程分析，再按段的顺序合并各线程的结果
+【参数】
+    - const Model<3>& Model（输入参数）：模型
+    - const QualityThresholds& Thresholds（输入参数）：判定劣质面的阈值
+【返回值】 QualityReport：分析结果
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+QualityReport QualityAnalyzer::Analyze(const Model<3>& Model,
+    const QualityThresholds& Thresholds) const {
+    auto Start = std::chrono::steady_clock::now();
+    QualityReport Report{};
+    Report.FaceCount = Model.Faces.size();
+    Report.AspectBounds = { 1.5, 2, 3, 5, 10, 100,
+        std::numeric_limits<double>::infinity() };
+    Report.AngleHistogram.assign(AngleBinCount, 0);
+    Report.AspectHistogram.assign(Report.AspectBounds.size(), 0);
+
+    const std::size_t Workers = std::max<std::size_t>(1,
+        std::min(m_WorkerCount, Report.FaceCount / MinFacesPerWorker));
+    std::vector<QualityTally> Tallies(Workers);//其余各项值初始化为0
+    auto Work = [&](std::size_t w) {
+        Tallies[w].MinAngle = 180;
+        Tallies[w].MinShapeQuality = 1;
+        Tallies[w].AngleHistogram.assign(AngleBinCount, 0);
+        Tallies[w].AspectHistogram.assign(Report.AspectBounds.size(), 0);
+        AnalyzeRange(Model, Report.FaceCount * w / Workers,
+            Report.FaceCount * (w + 1) / Workers, Thresholds,
+            Report.AspectBounds, &Tallies[w]);
+    };
+    std::vector<std::thread> Threads;
+    for (std::size_t w = 1; w < Workers; w++) {
+        Threads.emplace_back(Work, w);
+    }
+    Work(0);
+    for (auto& Thread: Threads) {
+        Thread.join();
+    }
+
+    std::size_t ValidFaces = 0;
+    double SumAspectRatio = 0;
+    Report.MinAngle = 180;
+    Report.MinShapeQuality = 1;
+    for (const QualityTally& Tally: Tallies) {
+        ValidFaces += Tally.ValidFaces;
+        Report.DegenerateFaces += Tally.DegenerateFaces;
+        Report.PoorFaces += Tally.PoorFaces;
+        Report.MinAngle = std::min(Report.MinAngle, Tally.MinAngle);
+        Report.MaxAngle = std::max(Report.MaxAngle, Tally.MaxAngle);
+        SumAspectRatio += Tally.SumAspectRatio;
+        Report.MaxAspectRatio = std::max(Report.MaxAspectRatio,
+            Tally.MaxAspectRatio);
+        Report.MinShapeQuality = std::min(Report.MinShapeQuality,
+            Tally.MinShapeQuality);
+        for (std::size_t b = 0; b < AngleBinCount; b++) {
+            Report.AngleHistogram[b] += Tally.AngleHistogram[b];
+        }
+        for (std::size_t b = 0; b < Report.AspectHistogram.size(); b++) {
+            Report.AspectHistogram[b] += Tally.AspectHistogram[b];
+        }
+        Report.FlaggedFaces.insert(Report.FlaggedFaces.end(),
+            Tally.FlaggedFaces.begin(), Tally.FlaggedFaces.end());
+    }//各段按顺序合并，标记的面序号仍为升序
+    if (ValidFaces > 0) {
+        Report.MeanAspectRatio = SumAspectRatio / ValidFaces;
+    } else {
+        Report.MinAngle = 0;
+        Report.MinShapeQuality = 0;
+    }
+    Report.Seconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - Start).count();
+    return Report;
+}
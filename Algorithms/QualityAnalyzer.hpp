@@ -0,0 +1,122 @@
+/*******************************************************************************
+【文件名】 QualityAnalyzer.hpp
+【功能模块和目的】 定义QualityAnalyzer类与QualityThresholds、QualityReport结构体，
+批量评价三角形面的形状，找出退化的面与狭长的面
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+#ifndef QUALITY_ANALYZER_HPP
+#define QUALITY_ANALYZER_HPP
+
+#include <cstddef>
+#include <vector>
+#include "../Models/Model.hpp"
+
+/*******************************************************************************
+【结构体名】 QualityThresholds
+【功能】 结构体，表示判定劣质面的阈值，满足其中任意一条的面被标记
+【接口说明】
+    - double MaxAspectRatio
+        长宽比的上限
+    - double MinAngle
+        最小内角的下限（度）
+    - double MaxAngle
+        最大内角的上限（度）
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+struct QualityThresholds {
+    double MaxAspectRatio;
+    double MinAngle;
+    double MaxAngle;
+};
+
+/*******************************************************************************
+【结构体名】 QualityReport
+【功能】 结构体，表示一次质量分析的结果。长宽比为最长边与内切圆直径之比除以
+等边三角形的值（√3），形状质量为4√3·面积与三边平方和之比，二者对等边三角形都为1；
+除DegenerateFaces与FlaggedFaces外，各项只统计非退化的面
+【接口说明】
+    - std::size_t FaceCount
+        面数
+    - std::size_t DegenerateFaces
+        退化的面数（有两点重合或三点近乎共线）
+    - std::size_t PoorFaces
+        超出阈值的非退化面数
+    - double MinAngle
+        最小内角（度）
+    - double MaxAngle
+        最大内角（度）
+    - double MeanAspectRatio
+        平均长宽比
+    - double MaxAspectRatio
+        最大长宽比
+    - double MinShapeQuality
+        最小形状质量
+    - std::vector<std::size_t> AngleHistogram
+        所有内角的直方图，每10度一格，共AngleBinCount格
+    - std::vector<double> AspectBounds
+        长宽比直方图各格的上界，最后一格为无穷大
+    - std::vector<std::size_t> AspectHistogram
+        长宽比的直方图，与AspectBounds一一对应
+    - std::vector<std::size_t> FlaggedFaces
+        退化或超出阈值的面的序号，升序
+    - double Seconds
+        分析的耗时（秒）
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+struct QualityReport {
+    std::size_t FaceCount;
+    std::size_t DegenerateFaces;
+    std::size_t PoorFaces;
+    double MinAngle;
+    double MaxAngle;
+    double MeanAspectRatio;
+    double MaxAspectRatio;
+    double MinShapeQuality;
+    std::vector<std::size_t> AngleHistogram;
+    std::vector<double> AspectBounds;
+    std::vector<std::size_t> AspectHistogram;
+    std::vector<std::size_t> FlaggedFaces;
+    double Seconds;
+};
+
+/*******************************************************************************
+【类名】 QualityAnalyzer
+【功能】 面质量分析器。各线程分段处理面，每次把一批面的顶点坐标按分量取出到
+连续的数组中，再在这些数组上逐项计算边长、面积、内角与长宽比，循环体中没有
+分支与间接访问，便于编译器向量化；各线程的直方图与标记分别累计，最后按段的顺序
+合并。Element::IsValid只拒绝完全重合的点，本类还能找出近乎共线的狭长面
+【接口说明】
+    - QualityAnalyzer(std::size_t WorkerCount = 0)
+        构造函数，WorkerCount为0时取硬件线程数
+    - const std::size_t& WorkerCount
+        线程数
+    - QualityReport Analyze(const Model<3>& Model,
+        const QualityThresholds& Thresholds) const
+        分析模型的所有面
+    - static constexpr std::size_t AngleBinCount
+        内角直方图的格数
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+class QualityAnalyzer {
+    public:
+        static constexpr std::size_t AngleBinCount = 18;
+
+        explicit QualityAnalyzer(std::size_t WorkerCount = 0);
+        QualityAnalyzer(const QualityAnalyzer& Other) = delete;
+        QualityAnalyzer& operator=(const QualityAnalyzer& Other) = delete;
+
+        const std::size_t& WorkerCount { m_WorkerCount };
+
+        //分析面的质量
+        QualityReport Analyze(const Model<3>& Model,
+            const QualityThresholds& Thresholds) const;
+
+    private:
+        std::size_t m_WorkerCount;
+};
+
+#endif // QUALITY_ANALYZER_HPP
@@ -0,0 +1,103 @@
+/*******************************************************************************
+【文件名】 RadixSorter.cpp
+【功能模块和目的】 实现RadixSorter类，并行基数排序
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include "RadixSorter.hpp"
+
+static const std::size_t DigitBits = 11;
+static const std::size_t BucketCount = std::size_t(1) << DigitBits;
+//每个线程至少处理的项数，项数太少时多线程得不偿失
+static const std::size_t MinItemsPerWorker = 1 << 16;
+
+/*******************************************************************************
+【函数名称】 RadixSorter
+【函数功能】 构造函数
+【参数】
+    - std::size_t WorkerCount（输入参数）：线程数，为0时取硬件线程数
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+RadixSorter::RadixSorter(std::size_t WorkerCount):
+    m_WorkerCount(WorkerCount != 0 ? WorkerCount
+        : std::max<std::size_t>(1, std::thread::hardware_concurrency())) {}
+
+/*******************************************************************************
+【函数名称】 Sort
+【函数功能】 按Key升序稳定排序，借助一个同样大小的辅助数组在两者间交替分发
+【参数】
+    - std::vector<Item>& Items（输入输出参数）：排序项
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+void RadixSorter::Sort(std::vector<Item>& Items) const {
+    const std::size_t Count = Items.size();
+    if (Count < 2) {
+        return;
+    }
+    const std::size_t Workers = std::max<std::size_t>(1,
+        std::min(m_WorkerCount, Count / MinItemsPerWorker));
+    auto RunParallel = [Workers, Count](const auto& Task) {
+        std::vector<std::thread> Threads;
+        for (std::size_t w = 1; w < Workers; w++) {
+            Threads.emplace_back(Task, w, Count * w / Workers,
+                Count * (w + 1) / Workers);
+        }
+        Task(0, 0, Count / Workers);//调用线程处理第一段
+        for (auto& Thread: Threads) {
+            Thread.join();
+        }
+    };
+
+    std::vector<Item> Buffer(Count);
+    std::vector<Item>* Source = &Items;
+    std::vector<Item>* Target = &Buffer;
+    //Counts[w * BucketCount + d]：先是线程w中数位为d的项数，后是其写入位置
+    std::vector<std::size_t> Counts(Workers * BucketCount);
+    for (std::size_t Shift = 0; Shift < 64; Shift += DigitBits) {
+        RunParallel([&](std::size_t w, std::size_t First, std::size_t Last) {
+            std::size_t* Local = &Counts[w * BucketCount];
+            std::fill(Local, Local + BucketCount, 0);
+            for (std::size_t i = First; i < Last; i++) {
+                Local[((*Source)[i].Key >> Shift) & (BucketCount - 1)]++;
+            }
+        });
+        std::size_t Sum = 0;
+        bool IsUniform = false;
+        for (std::size_t d = 0; d < BucketCount; d++) {
+            std::size_t BucketTotal = 0;
+            for (std::size_t w = 0; w < Workers; w++) {
+                std::size_t Local = Counts[w * BucketCount + d];
+                Counts[w * BucketCount + d] = Sum;
+                Sum += Local;
+                BucketTotal += Local;
+            }
+            if (BucketTotal == Count) {
+                IsUniform = true;
+            }
+        }
+        if (IsUniform) {
+            continue;
+        }//这一轮所有项落在同一个桶中，顺序不变
+        RunParallel([&](std::size_t w, std::size_t First, std::size_t Last) {
+            std::size_t* Local = &Counts[w * BucketCount];
+            for (std::size_t i = First; i < Last; i++) {
+                const Item& Current = (*Source)[i];
+                (*Target)[Local[(Current.Key >> Shift) & (BucketCount - 1)]++]
+                    = Current;
+            }
+        });
+        std::swap(Source, Target);
+    }
+    if (Source != &Items) {
+        Items.swap(Buffer);
+    }
+}
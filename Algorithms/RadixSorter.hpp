@@ -0,0 +1,57 @@
+/*******************************************************************************
+【文件名】 RadixSorter.hpp
+【功能模块和目的】 定义RadixSorter类，多线程的64位键基数排序，供空间重排等算法使用
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+#ifndef RADIX_SORTER_HPP
+#define RADIX_SORTER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/*******************************************************************************
+【类名】 RadixSorter
+【功能】 低位优先的并行基数排序。每轮按11位分桶：各线程统计自己那一段的桶计数，
+按"桶优先、线程其次"求前缀和得到各线程的写入位置，再并行地稳定分发；所有键在某一
+轮取值相同时跳过该轮。排序是稳定的，键相同的项保持原有顺序
+【接口说明】
+    - struct Item
+        排序项，Key为键，Index为调用者的序号
+    - RadixSorter(std::size_t WorkerCount = 0)
+        构造函数，WorkerCount为0时取硬件线程数
+    - const std::size_t& WorkerCount
+        线程数
+    - void Sort(std::vector<Item>& Items) const
+        按Key升序排序
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+class RadixSorter {
+    public:
+        /***********************************************************************
+        【结构体名】 Item
+        【功能】 排序项
+        Created by 朱昊东 on 2026/10/18
+        【更改记录】 无
+        ***********************************************************************/
+        struct Item {
+            std::uint64_t Key;
+            std::size_t Index;
+        };
+
+        explicit RadixSorter(std::size_t WorkerCount = 0);
+        RadixSorter(const RadixSorter& Other) = delete;
+        RadixSorter& operator=(const RadixSorter& Other) = delete;
+
+        const std::size_t& WorkerCount { m_WorkerCount };
+
+        //按Key升序稳定排序
+        void Sort(std::vector<Item>& Items) const;
+
+    private:
+        std::size_t m_WorkerCount;
+};
+
+#endif // RADIX_SORTER_HPP
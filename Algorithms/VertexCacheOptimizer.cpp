@@ -0,0 +1,255 @@
+/*******************************************************************************
+【文件名】 VertexCacheOptimizer.cpp
+【功能模块和目的】 实现VertexCacheOptimizer类，Forsyth顶点缓存优化与ACMR测量
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 增添了只测量、不重排模型的Measure
+*******************************************************************************/
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+#include "VertexCacheOptimizer.hpp"
+#include "../Models/IndexedModel.hpp"
+
+//Forsyth得分函数的参数
+static const double CacheDecayPower = 1.5;
+static const double LastFaceScore = 0.75;
+static const double ValenceBoostScale = 2.0;
+static const double ValenceBoostPower = 0.5;
+
+/*******************************************************************************
+【函数名称】 VertexCacheOptimizer
+【函数功能】 构造函数
+【参数】
+    - std::size_t CacheSize（输入参数）：模拟的缓存大小，至少为4
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+VertexCacheOptimizer::VertexCacheOptimizer(std::size_t CacheSize):
+    m_CacheSize(std::max<std::size_t>(4, CacheSize)) {}
+
+/*******************************************************************************
+【函数名称】 Optimize
+【函数功能】 按导出时的点序号（不焊接）计算新的面顺序并重排模型的面，
+线不受影响
+【参数】
+    - Model<3>& Model（输入输出参数）：模型
+【返回值】 CacheReport：重排前后的ACMR
+Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 计算顺序的部分移至Plan
+*******************************************************************************/
+CacheReport VertexCacheOptimizer::Optimize(Model<3>& Model) const {
+    CacheReport Report;
+    Model.ReorderFaces(Plan(Model, &Report));
+    return Report;
+}
+
+/*******************************************************************************
+【函数名称】 Measure
+【函数功能】 计算按优化后的顺序导出时的ACMR，模型不被修改
+【参数】
+    - const Model<3>& Model（输入参数）：模型
+【返回值】 CacheReport：当前顺序与优化后顺序的ACMR
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+CacheReport VertexCacheOptimizer::Measure(const Model<3>& Model) const {
+    CacheReport Report;
+    Plan(Model, &Report);
+    return Report;
+}
+
+/*******************************************************************************
+【函数名称】 Plan
+【函数功能】 按导出时的点序号（不焊接）计算新的面顺序，并测量重排前后的ACMR
+【参数】
+    - const Model<3>& Model（输入参数）：模型
+    - CacheReport* ReportPtr（输出参数）：重排前后的ACMR
+【返回值】 std::vector<std::size_t>：新顺序中依次排列的原面序号
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+std::vector<std::size_t> VertexCacheOptimizer::Plan(const Model<3>& Model,
+    CacheReport* ReportPtr) const {
+    std::vector<std::size_t> FaceIndices;
+    std::size_t PointCount;
+    {
+        IndexedModel<3> Indexed(Model);
+        FaceIndices = Indexed.FaceIndices;
+        PointCount = Indexed.Points.size();
+    }//不焊接时每个面都在索引中，第f个面对应Model.Faces[f]
+    CacheReport& Report = *ReportPtr;
+    Report.FaceCount = FaceIndices.size() / 3;
+    Report.AcmrBefore = MeasureAcmr(FaceIndices, m_CacheSize);
+    std::vector<std::size_t> Order = ComputeOrder(FaceIndices, PointCount);
+    std::vector<std::size_t> Reordered;
+    Reordered.reserve(FaceIndices.size());
+    for (std::size_t f: Order) {
+        for (std::size_t k = 0; k < 3; k++) {
+            Reordered.push_back(FaceIndices[f * 3 + k]);
+        }
+    }
+    Report.AcmrAfter = MeasureAcmr(Reordered, m_CacheSize);
+    return Order;
+}
+
+/*******************************************************************************
+【函数名称】 MeasureAcmr
+【函数功能】 模拟给定大小的FIFO缓存，计算平均每个面未命中的点数
+【参数】
+    - const std::vector<std::size_t>& FaceIndices（输入参数）：每个面的三个点序号
+    - std::size_t CacheSize（输入参数）：缓存大小
+【返回值】 double：ACMR，没有面时为0
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+double VertexCacheOptimizer::MeasureAcmr(
+    const std::vector<std::size_t>& FaceIndices, std::size_t CacheSize) {
+    std::size_t FaceCount = FaceIndices.size() / 3;
+    if (FaceCount == 0) {
+        return 0;
+    }
+    std::size_t PointCount = 0;
+    for (std::size_t Index: FaceIndices) {
+        PointCount = std::max(PointCount, Index + 1);
+    }
+    //点进入缓存时的未命中序号加1，为0表示从未进入
+    std::vector<std::size_t> EnteredAt(PointCount, 0);
+    std::size_t Misses = 0;
+    for (std::size_t Index: FaceIndices) {
+        if (EnteredAt[Index] == 0 || Misses - EnteredAt[Index] >= CacheSize) {
+            Misses++;
+            EnteredAt[Index] = Misses;
+        }//FIFO缓存中，此后又有CacheSize个点进入时该点被挤出
+    }
+    return static_cast<double>(Misses) / FaceCount;
+}
+
+/*******************************************************************************
+【函数名称】 ComputeOrder
+【函数功能】 Forsyth算法：维护LRU缓存与点、面的得分，每次输出得分最高的面；缓存中
+的点都没有剩余的面时，从尚未输出的面中按原顺序取下一个
+【参数】
+    - const std::vector<std::size_t>& FaceIndices（输入参数）：每个面的三个点序号
+    - std::size_t PointCount（输入参数）：点数
+【返回值】 std::vector<std::size_t>：新的面顺序
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+std::vector<std::size_t> VertexCacheOptimizer::ComputeOrder(
+    const std::vector<std::size_t>& FaceIndices,
+    std::size_t PointCount) const {
+    const std::size_t FaceCount = FaceIndices.size() / 3;
+    std::vector<std::size_t> Order;
+    Order.reserve(FaceCount);
+
+    //每个点尚未输出的相邻面，以CSR形式存放，段内前Remaining[p]个为有效
+    std::vector<std::size_t> Offsets(PointCount + 1, 0);
+    for (std::size_t Index: FaceIndices) {
+        Offsets[Index + 1]++;
+    }
+    for (std::size_t p = 0; p < PointCount; p++) {
+        Offsets[p + 1] += Offsets[p];
+    }
+    std::vector<std::size_t> Remaining(PointCount, 0);
+    std::vector<std::size_t> Adjacent(FaceIndices.size());
+    for (std::size_t i = 0; i < FaceIndices.size(); i++) {
+        std::size_t p = FaceIndices[i];
+        Adjacent[Offsets[p] + Remaining[p]++] = i / 3;
+    }
+
+    std::vector<long> CachePosition(PointCount, -1);
+    auto ScorePoint = [&](std::size_t p) {
+        if (Remaining[p] == 0) {
+            return -1.0;
+        }//没有剩余的面，不再参与
+        double Score = 0;
+        long Position = CachePosition[p];
+        if (Position >= 0) {
+            if (Position < 3) {
+                Score = LastFaceScore;
+            }//刚输出的面的三个点，得分固定以避免总选同一条带
+            else {
+                double Scale = 1.0 / (m_CacheSize - 3);
+                Score = std::pow(1.0 - (Position - 3) * Scale,
+                    CacheDecayPower);
+            }
+        }
+        return Score + ValenceBoostScale
+            * std::pow(static_cast<double>(Remaining[p]), -ValenceBoostPower);
+    };
+    std::vector<double> PointScore(PointCount);
+    for (std::size_t p = 0; p < PointCount; p++) {
+        PointScore[p] = ScorePoint(p);
+    }
+    std::vector<double> FaceScore(FaceCount);
+    std::vector<bool> Emitted(FaceCount, false);
+    for (std::size_t f = 0; f < FaceCount; f++) {
+        FaceScore[f] = PointScore[FaceIndices[f * 3]]
+            + PointScore[FaceIndices[f * 3 + 1]]
+            + PointScore[FaceIndices[f * 3 + 2]];
+    }
+
+    std::vector<std::size_t> Cache;
+    std::vector<std::size_t> NextCache;
+    Cache.reserve(m_CacheSize + 3);
+    NextCache.reserve(m_CacheSize + 3);
+    std::size_t Cursor = 0;//按原顺序查找未输出的面
+    std::size_t Best = FaceCount;
+    while (Order.size() < FaceCount) {
+        if (Best == FaceCount) {
+            while (Emitted[Cursor]) {
+                Cursor++;
+            }
+            Best = Cursor;
+        }
+        Emitted[Best] = true;
+        Order.push_back(Best);
+        NextCache.clear();
+        for (std::size_t k = 0; k < 3; k++) {
+            std::size_t p = FaceIndices[Best * 3 + k];
+            std::size_t* Begin = &Adjacent[Offsets[p]];
+            std::size_t* End = Begin + Remaining[p];
+            *std::find(Begin, End, Best) = *(End - 1);
+            Remaining[p]--;//从剩余的面中移除
+            NextCache.push_back(p);
+        }
+        for (std::size_t p: Cache) {
+            if (std::find(NextCache.begin(), NextCache.begin() + 3, p)
+                == NextCache.begin() + 3) {
+                NextCache.push_back(p);
+            }
+        }//新面的三个点移到最前，其余点依次后移
+        for (std::size_t i = 0; i < NextCache.size(); i++) {
+            CachePosition[NextCache[i]] =
+                i < m_CacheSize ? static_cast<long>(i) : -1;
+        }
+        Best = FaceCount;
+        double BestScore = -1;
+        for (std::size_t p: NextCache) {
+            PointScore[p] = ScorePoint(p);
+        }
+        for (std::size_t p: NextCache) {
+            for (std::size_t i = 0; i < Remaining[p]; i++) {
+                std::size_t f = Adjacent[Offsets[p] + i];
+                FaceScore[f] = PointScore[FaceIndices[f * 3]]
+                    + PointScore[FaceIndices[f * 3 + 1]]
+                    + PointScore[FaceIndices[f * 3 + 2]];
+                if (FaceScore[f] > BestScore) {
+                    BestScore = FaceScore[f];
+                    Best = f;
+                }
+            }
+        }//只有缓存中的点得分改变
+        if (NextCache.size() > m_CacheSize) {
+            NextCache.resize(m_CacheSize);
+        }//被挤出的点已在上面更新为不在缓存中的得分
+        Cache.swap(NextCache);
+    }
+    return Order;
+}
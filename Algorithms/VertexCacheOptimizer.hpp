@@ -0,0 +1,93 @@
+/*******************************************************************************
+【文件名】 VertexCacheOptimizer.hpp
+【功能模块和目的】 定义VertexCacheOptimizer类与CacheReport结构体，重排模型的面以提高
+GPU顶点变换后缓存的命中率
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 增添了Measure
+*******************************************************************************/
+#ifndef VERTEX_CACHE_OPTIMIZER_HPP
+#define VERTEX_CACHE_OPTIMIZER_HPP
+
+#include <cstddef>
+#include <vector>
+#include "../Models/Model.hpp"
+
+/*******************************************************************************
+【结构体名】 CacheReport
+【功能】 结构体，表示一次重排的结果
+【接口说明】
+    - std::size_t FaceCount
+        参与重排的面数
+    - double AcmrBefore
+        重排前的平均缓存未命中率（每个面平均需变换的点数）
+    - double AcmrAfter
+        重排后的平均缓存未命中率
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+struct CacheReport {
+    std::size_t FaceCount;
+    double AcmrBefore;
+    double AcmrAfter;
+};
+
+/*******************************************************************************
+【类名】 VertexCacheOptimizer
+【功能】 Forsyth线性时间顶点缓存优化。用LRU缓存模拟GPU的变换后缓存，点的得分由
+其在缓存中的位置和剩余未输出的相邻面数决定，每一步输出与缓存中的点相邻、得分最高的
+面，只需更新缓存中点的得分，因此整体为O(n)。点的序号由导出时的IndexedModel按首次
+出现的顺序分配，重排面之后点的顺序也随之与首次使用的顺序一致
+【接口说明】
+    - VertexCacheOptimizer(std::size_t CacheSize = DefaultCacheSize)
+        构造函数，传入模拟的缓存大小
+    - static constexpr std::size_t DefaultCacheSize
+        默认的缓存大小
+    - const std::size_t& CacheSize
+        模拟的缓存大小
+    - CacheReport Optimize(Model<3>& Model) const
+        重排模型的面并报告重排前后的ACMR；面的编号随之改变，应作用于导出用的副本
+    - CacheReport Measure(const Model<3>& Model) const
+        只报告重排前后的ACMR，不修改模型
+    - static double MeasureAcmr(const std::vector<std::size_t>& FaceIndices,
+        std::size_t CacheSize)
+        用FIFO缓存计算面序列的ACMR
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 增添了Measure
+*******************************************************************************/
+class VertexCacheOptimizer {
+    public:
+        static constexpr std::size_t DefaultCacheSize = 32;
+
+        explicit VertexCacheOptimizer(
+            std::size_t CacheSize = DefaultCacheSize);
+        VertexCacheOptimizer(const VertexCacheOptimizer& Other) = delete;
+        VertexCacheOptimizer& operator=(
+            const VertexCacheOptimizer& Other) = delete;
+
+        const std::size_t& CacheSize { m_CacheSize };
+
+        //重排模型的面
+        CacheReport Optimize(Model<3>& Model) const;
+        //测量重排前后的ACMR
+        CacheReport Measure(const Model<3>& Model) const;
+        //计算面序列的ACMR
+        static double MeasureAcmr(const std::vector<std::size_t>& FaceIndices,
+            std::size_t CacheSize);
+
+    private:
+        //计算新的面顺序并测量ACMR
+        std::vector<std::size_t> Plan(const Model<3>& Model,
+            CacheReport* ReportPtr) const;
+        //计算优化后的面顺序
+        std::vector<std::size_t> ComputeOrder(
+            const std::vector<std::size_t>& FaceIndices,
+            std::size_t PointCount) const;
+
+        std::size_t m_CacheSize;
+};
+
+#endif // VERTEX_CACHE_OPTIMIZER_HPP
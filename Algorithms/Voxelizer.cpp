@@ -0,0 +1,310 @@
+/*******************************************************************************
+【文件名】 Voxelizer.cpp
+【功能模块和目的】 实现Voxelizer类，按板块并行计算窄带有向距离场
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <thread>
+#include <vector>
+#include "FaceTree.hpp"
+#include "Voxelizer.hpp"
+
+//求距离时每组候选面的个数
+static const std::size_t GroupSize = 8;
+
+/*******************************************************************************
+【结构体名】 CandidateGroup
+【功能】 结构体，表示一组候选面：包围盒Min与Max、包围盒到块中心的距离Distance，
+以及组内的面在候选列表中的范围[First, Last)
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+struct CandidateGroup {
+    double Min[3];
+    double Max[3];
+    double Distance;
+    std::size_t First;
+    std::size_t Last;
+};
+
+/*******************************************************************************
+【函数名称】 BoxDistance
+【函数功能】 求点到长方体的距离的平方，点在长方体内时为0
+【参数】
+    - const double* Point（输入参数）：点的坐标
+    - const double* Min（输入参数）：长方体各坐标的下界
+    - const double* Max（输入参数）：长方体各坐标的上界
+【返回值】 double：距离的平方
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+static double BoxDistance(const double* Point, const double* Min,
+    const double* Max) {
+    double Sum = 0;
+    for (std::size_t i = 0; i < 3; i++) {
+        double Delta = std::max({ Min[i] - Point[i], Point[i] - Max[i], 0.0 });
+        Sum += Delta * Delta;
+    }
+    return Sum;
+}
+
+/*******************************************************************************
+【函数名称】 VoxelizeSlab
+【函数功能】 处理z方向第Slab个板块：先由各行的环绕数求出每个格点的符号，再逐块
+求距离。块的格点值追加到Payload中，BrickOffsets记录的是在Payload中的块号
+【参数】
+    - const FaceTree& Tree（输入参数）：模型各面的树
+    - std::size_t Slab（输入参数）：板块序号
+    - DistanceField& Field（输入输出参数）：距离场，网格参数已确定，只写入本板块
+    各块的BrickValues与BrickOffsets
+    - std::vector<float>& Payload（输出参数）：本板块存放的格点值
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+static void VoxelizeSlab(const FaceTree& Tree, std::size_t Slab,
+    DistanceField& Field, std::vector<float>& Payload) {
+    const std::size_t Brick = DistanceField::BrickSize;
+    const std::size_t BrickVolume = Brick * Brick * Brick;
+    const std::size_t SizeX = Field.Size[0];
+    const std::size_t SizeY = Field.Size[1];
+    const std::size_t FirstZ = Slab * Brick;
+    const std::size_t LastZ = std::min(FirstZ + Brick, Field.Size[2]);
+    const double Spacing = Field.Spacing;
+    const double Band = Field.BandWidth;
+    auto Coordinate = [&](std::size_t Axis, std::size_t Index) {
+        return Field.Origin[Axis] + Index * Spacing;
+    };
+
+    //各格点是否在内部，按x、y、z的顺序排列
+    std::vector<char> Inside((LastZ - FirstZ) * SizeY * SizeX);
+    std::vector<FaceTree::Crossing> Crossings;
+    for (std::size_t z = FirstZ; z < LastZ; z++) {
+        for (std::size_t y = 0; y < SizeY; y++) {
+            double Origin[3] = { 0, Coordinate(1, y), Coordinate(2, z) };
+            Crossings.clear();
+            Tree.FindCrossings(0, Origin, &Crossings);
+            std::sort(Crossings.begin(), Crossings.end(),
+                [](const FaceTree::Crossing& Left,
+                    const FaceTree::Crossing& Right) {
+                    return Left.Position < Right.Position;
+                });
+            char* Row = &Inside[((z - FirstZ) * SizeY + y) * SizeX];
+            int Winding = 0;
+            std::size_t k = 0;
+            for (std::size_t x = 0; x < SizeX; x++) {
+                double X = Coordinate(0, x);
+                while (k < Crossings.size() && Crossings[k].Position < X) {
+                    Winding -= Crossings[k].Direction;
+                    k++;
+                }//进入朝外的面时法向与x轴反向
+                Row[x] = Winding != 0;
+            }
+        }
+    }
+
+    std::vector<std::size_t> Candidates;
+    std::vector<CandidateGroup> Groups;
+    for (std::size_t by = 0; by < Field.BrickCounts[1]; by++) {
+        for (std::size_t bx = 0; bx < Field.BrickCounts[0]; bx++) {
+            const std::size_t First[3] = { bx * Brick, by * Brick, FirstZ };
+            const std::size_t Last[3] = { std::min(First[0] + Brick, SizeX),
+                std::min(First[1] + Brick, SizeY), LastZ };
+            double Min[3];
+            double Max[3];
+            double Center[3];
+            double Radius = 0;//块中心到块内格点的最大距离
+            for (std::size_t i = 0; i < 3; i++) {
+                Min[i] = Coordinate(i, First[i]) - Band;
+                Max[i] = Coordinate(i, Last[i] - 1) + Band;
+                Center[i] = (Min[i] + Max[i]) / 2;
+                Radius += (Max[i] - Center[i] - Band)
+                    * (Max[i] - Center[i] - Band);
+            }
+            Radius = std::sqrt(Radius);
+            const std::size_t Index = (Slab * Field.BrickCounts[1] + by)
+                * Field.BrickCounts[0] + bx;
+            Candidates.clear();
+            Tree.FindOverlapping(Min, Max, &Candidates);
+            if (Candidates.empty()) {
+                std::size_t Middle = (((Last[2] - 1 - FirstZ) / 2) * SizeY
+                    + (First[1] + Last[1] - 1) / 2) * SizeX
+                    + (First[0] + Last[0] - 1) / 2;
+                Field.BrickValues[Index] = Inside[Middle] ? -Band : Band;
+                continue;
+            }//整块都离表面超过窄带，各格点符号相同
+            //树中相邻的三角形在空间上也相邻，按序每GroupSize个分为一组
+            std::sort(Candidates.begin(), Candidates.end());
+            Groups.clear();
+            for (std::size_t c = 0; c < Candidates.size(); c += GroupSize) {
+                CandidateGroup Group;
+                Group.First = c;
+                Group.Last = std::min(c + GroupSize, Candidates.size());
+                const auto& Head = Tree.Triangles[Candidates[c]];
+                std::copy(Head.Min, Head.Min + 3, Group.Min);
+                std::copy(Head.Max, Head.Max + 3, Group.Max);
+                for (std::size_t k = c + 1; k < Group.Last; k++) {
+                    const auto& Current = Tree.Triangles[Candidates[k]];
+                    for (std::size_t i = 0; i < 3; i++) {
+                        Group.Min[i] = std::min(Group.Min[i], Current.Min[i]);
+                        Group.Max[i] = std::max(Group.Max[i], Current.Max[i]);
+                    }
+                }
+                Group.Distance = std::sqrt(
+                    BoxDistance(Center, Group.Min, Group.Max));
+                Groups.push_back(Group);
+            }
+            std::sort(Groups.begin(), Groups.end(),
+                [](const CandidateGroup& Left, const CandidateGroup& Right) {
+                    return Left.Distance < Right.Distance;
+                });
+            Field.BrickValues[Index] = Band;
+            Field.BrickOffsets[Index] = Payload.size() / BrickVolume;
+            std::size_t Offset = Payload.size();
+            Payload.resize(Offset + BrickVolume, static_cast<float>(Band));
+            float* Values = Payload.data() + Offset;
+            for (std::size_t z = First[2]; z < Last[2]; z++) {
+                for (std::size_t y = First[1]; y < Last[1]; y++) {
+                    for (std::size_t x = First[0]; x < Last[0]; x++) {
+                        double Point[3] = { Coordinate(0, x),
+                            Coordinate(1, y), Coordinate(2, z) };
+                        double Best = Band * Band;
+                        for (const auto& Group: Groups) {
+                            double Bound = Group.Distance - Radius;
+                            if (Bound > 0 && Bound * Bound >= Best) {
+                                break;
+                            }//其余的组离块中心更远，不可能更近
+                            if (BoxDistance(Point, Group.Min, Group.Max)
+                                >= Best) {
+                                continue;
+                            }
+                            for (std::size_t k = Group.First; k < Group.Last;
+                                k++) {
+                                const auto& Current =
+                                    Tree.Triangles[Candidates[k]];
+                                if (BoxDistance(Point, Current.Min,
+                                    Current.Max) < Best) {
+                                    Best = std::min(Best, FaceTree::
+                                        SquaredDistance(Current, Point));
+                                }
+                            }
+                        }
+                        double Distance = std::sqrt(Best);
+                        bool IsInside = Inside[((z - FirstZ) * SizeY + y)
+                            * SizeX + x];
+                        Values[((z - First[2]) * Brick + y - First[1]) * Brick
+                            + x - First[0]] = static_cast<float>(
+                                IsInside ? -Distance : Distance);
+                    }
+                }
+            }
+        }
+    }
+}
+
+/*******************************************************************************
+【函数名称】 Voxelizer
+【函数功能】 构造函数
+【参数】
+    - std::size_t WorkerCount（输入参数）：线程数，为0时取硬件线程数
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+Voxelizer::Voxelizer(std::size_t WorkerCount):
+    m_WorkerCount(WorkerCount != 0 ? WorkerCount
+        : std::max<std::size_t>(1, std::thread::hardware_concurrency())) {}
+
+/*******************************************************************************
+【函数名称】 Build
+【函数功能】 确定网格：最长轴Resolution个格点，其中两端各留Margin个格点的空白
+（窄带宽度向上取整再加1），间距由最长轴上的包围盒边长决定，其他轴按需取格点数。
+之后多个线程按原子计数器轮流领取板块，各板块的格点值最后按板块顺序拼接
+【参数】
+    - const Model<3>& Model（输入参数）：模型
+    - std::size_t Resolution（输入参数）：最长轴上的格点数，过小时取能容纳窄带的
+    最小值
+    - double BandVoxels（输入参数）：窄带宽度，以格点间距为单位
+【返回值】 DistanceField：有向距离场
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+DistanceField Voxelizer::Build(const Model<3>& Model, std::size_t Resolution,
+    double BandVoxels) const {
+    DistanceField Field = {};
+    FaceTree Tree(Model);
+    if (Tree.Nodes.empty()) {
+        return Field;
+    }
+    const auto& Root = Tree.Nodes[0];
+    BandVoxels = std::max(BandVoxels, 1.0);
+    const std::size_t Margin = static_cast<std::size_t>(
+        std::ceil(BandVoxels)) + 1;
+    Resolution = std::max(Resolution, 2 * Margin + 2);
+    double Extent = 0;
+    for (std::size_t i = 0; i < 3; i++) {
+        Extent = std::max(Extent, Root.Max[i] - Root.Min[i]);
+    }
+    Field.Spacing = Extent > 0 ? Extent / (Resolution - 1 - 2 * Margin) : 1;
+    Field.BandWidth = BandVoxels * Field.Spacing;
+    std::size_t BrickTotal = 1;
+    for (std::size_t i = 0; i < 3; i++) {
+        std::size_t Inner = static_cast<std::size_t>(std::ceil(
+            (Root.Max[i] - Root.Min[i]) / Field.Spacing - 1e-9)) + 1;
+        Field.Size[i] = std::min(Resolution, Inner + 2 * Margin);
+        Field.Origin[i] = Root.Min[i] - Margin * Field.Spacing;
+        Field.BrickCounts[i] = (Field.Size[i] + DistanceField::BrickSize - 1)
+            / DistanceField::BrickSize;
+        BrickTotal *= Field.BrickCounts[i];
+    }
+    Field.BrickValues.assign(BrickTotal, 0);
+    Field.BrickOffsets.assign(BrickTotal, DistanceField::NoVoxels);
+
+    const std::size_t SlabCount = Field.BrickCounts[2];
+    std::vector<std::vector<float>> Payloads(SlabCount);
+    std::atomic<std::size_t> NextSlab(0);
+    auto Work = [&]() {
+        for (;;) {
+            std::size_t Slab = NextSlab.fetch_add(1);
+            if (Slab >= SlabCount) {
+                return;
+            }
+            VoxelizeSlab(Tree, Slab, Field, Payloads[Slab]);
+        }
+    };//靠近表面的板块耗时多，按需领取以均衡负载
+    std::size_t Workers = std::min(m_WorkerCount, SlabCount);
+    std::vector<std::thread> Threads;
+    for (std::size_t w = 1; w < Workers; w++) {
+        Threads.emplace_back(Work);
+    }
+    Work();
+    for (auto& Thread: Threads) {
+        Thread.join();
+    }
+
+    const std::size_t BrickVolume = DistanceField::BrickSize
+        * DistanceField::BrickSize * DistanceField::BrickSize;
+    const std::size_t SlabBricks = Field.BrickCounts[0] * Field.BrickCounts[1];
+    std::size_t Stored = 0;
+    for (const auto& Payload: Payloads) {
+        Stored += Payload.size();
+    }
+    Field.Values.reserve(Stored);
+    for (std::size_t Slab = 0; Slab < SlabCount; Slab++) {
+        std::size_t Base = Field.Values.size() / BrickVolume;
+        for (std::size_t b = Slab * SlabBricks; b < (Slab + 1) * SlabBricks;
+            b++) {
+            if (Field.BrickOffsets[b] != DistanceField::NoVoxels) {
+                Field.BrickOffsets[b] += Base;
+            }
+        }
+        Field.Values.insert(Field.Values.end(), Payloads[Slab].begin(),
+            Payloads[Slab].end());
+        std::vector<float>().swap(Payloads[Slab]);
+    }//拼接时逐个释放，峰值内存约为格点值的两倍以内
+    return Field;
+}
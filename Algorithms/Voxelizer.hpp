@@ -0,0 +1,54 @@
+/*******************************************************************************
+【文件名】 Voxelizer.hpp
+【功能模块和目的】 定义Voxelizer类，把模型的面体素化为窄带有向距离场
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+#ifndef VOXELIZER_HPP
+#define VOXELIZER_HPP
+
+#include <cstddef>
+#include "../Models/DistanceField.hpp"
+#include "../Models/Model.hpp"
+
+/*******************************************************************************
+【类名】 Voxelizer
+【功能】 有向距离场体素化器。网格最长轴取Resolution个格点，四周各留出比窄带略宽的
+空白；先对所有面建立FaceTree，再把网格按z方向每BrickSize层分为一个板块，多个线程
+轮流领取板块处理：
+    1. 符号：对板块中每一行格点，求平行于x轴的直线与各面的交点并排序，沿x方向累加
+    交点的方向得到每个格点的环绕数，不为0即在内部。环绕数对朝向一致的封闭网格是
+    准确的，朝内的网格与互相嵌套的部分也能正确处理
+    2. 距离：对每个块，查找包围盒与“块外扩窄带宽度”相交的面。没有这样的面时整块
+    离表面都超过窄带，只存一个值；否则把这些面按树中的顺序每几个分为一组，按组的
+    包围盒离块中心由近到远排序，逐组计算每个格点到组内各面的距离：包围盒已经比
+    当前最近距离更远的组或面直接跳过，由三角不等式可知之后的组都不会更近时提前结束
+【接口说明】
+    - Voxelizer(std::size_t WorkerCount = 0)
+        构造函数，WorkerCount为0时取硬件线程数
+    - const std::size_t& WorkerCount
+        线程数
+    - DistanceField Build(const Model<3>& Model, std::size_t Resolution,
+        double BandVoxels) const
+        求模型的有向距离场，窄带宽度为BandVoxels个格点间距；模型没有面时返回
+        空的距离场
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+class Voxelizer {
+    public:
+        explicit Voxelizer(std::size_t WorkerCount = 0);
+        Voxelizer(const Voxelizer& Other) = delete;
+        Voxelizer& operator=(const Voxelizer& Other) = delete;
+
+        const std::size_t& WorkerCount { m_WorkerCount };
+
+        //求模型的有向距离场
+        DistanceField Build(const Model<3>& Model, std::size_t Resolution,
+            double BandVoxels) const;
+
+    private:
+        std::size_t m_WorkerCount;
+};
+
+#endif // VOXELIZER_HPP
@@ -5,15 +5,101 @@ Created by 朱昊东 on 2024/7/28
 【更改记录】 
     2024/8/17
     - 修改了一些缩进问题
+    2026/10/18
+    - 按扩展名在.obj与.cmf格式间选择导入导出器，增添了压缩格式测评
+    - 增添了后台异步加载模型
+    - 增添了按需读取.obj文件的惰性模式
+    - 编辑操作追加到编辑日志，加载模型后重放日志
+    - 增添了模型简化
+    - 增添了顶点缓存优化
+    - 增添了按Morton码空间重排
+    - 增添了连通部分的统计与分别导出
+    - 统计面积改为读取面属性缓存
+    - 统计信息增添了质量属性
+    - 统计信息增添了有向包围盒
+    - 增添了凸包的导出与测评
+    - 增添了有向距离场的导出
+    - 增添了自相交与模型间相交的检测
+    - 增添了点是否在模型内部的批量判断
+    - 增添了线与面的相交检测
+    - 增添了Loop细分
+    - 增添了Taubin光顺
+    - 增添了面质量分析
+    - 增添了仿射变换
+    - 增添了测地最短路径
 *******************************************************************************/
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <future>
+#include <limits>
 #include <memory>
+#include <random>
 #include <string>
 #include <vector>
 #include "Controller.hpp"
+#include "../Exporter&Importer/CmfExporter.hpp"
+#include "../Exporter&Importer/CmfImporter.hpp"
+#include "../Exporter&Importer/LazyObjFile.hpp"
 #include "../Exporter&Importer/ObjExporter.hpp"
 #include "../Exporter&Importer/ObjImporter.hpp"
+#include "../Exporter&Importer/PointListImporter.hpp"
+#include "../Exporter&Importer/VolumeExporter.hpp"
+#include "../Models/IndexedModel.hpp"
 #include "../Models/Model.hpp"
 
+/*******************************************************************************
+【函数名称】 IsCmfPath
+【函数功能】 判断文件路径是否为.cmf压缩格式
+【参数】 
+    - const std::string& Path（输入参数）：字符串，文件路径
+【返回值】 bool：是否为.cmf格式
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+static bool IsCmfPath(const std::string& Path) {
+    const std::string Extension = ".cmf";
+    return Path.length() >= Extension.length()
+        && 0 == Path.compare(Path.length() - Extension.length(),
+            Extension.length(), Extension);
+}
+
+/*******************************************************************************
+【函数名称】 CreateImporter
+【函数功能】 根据扩展名创建导入器，非.cmf文件均交给ObjImporter检查
+【参数】 
+    - const std::string& Path（输入参数）：字符串，文件路径
+【返回值】 std::unique_ptr<AbstractImporter>：导入器
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+static std::unique_ptr<AbstractImporter> CreateImporter(
+    const std::string& Path) {
+    if (IsCmfPath(Path)) {
+        return std::unique_ptr<AbstractImporter>(new CmfImporter());
+    }
+    return std::unique_ptr<AbstractImporter>(new ObjImporter());
+}
+
+/*******************************************************************************
+【函数名称】 CreateExporter
+【函数功能】 根据扩展名创建导出器，非.cmf文件均交给ObjExporter检查
+【参数】 
+    - const std::string& Path（输入参数）：字符串，文件路径
+【返回值】 std::unique_ptr<AbstractExporter>：导出器
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+static std::unique_ptr<AbstractExporter> CreateExporter(
+    const std::string& Path) {
+    if (IsCmfPath(Path)) {
+        return std::unique_ptr<AbstractExporter>(new CmfExporter());
+    }
+    return std::unique_ptr<AbstractExporter>(new ObjExporter());
+}
+
 /*******************************************************************************
 【函数名称】 GetInstance
 【函数功能】 获取Controller类的单例对象
@@ -27,6 +113,69 @@ Controller& Controller::GetInstance() {
     return s_Instance;
 }
 
+/*******************************************************************************
+【函数名称】 ~Controller
+【函数功能】 析构函数，取消并等待尚未结束的后台加载，避免退出时线程仍在访问；
+等待尚未结束的后台保存完成，避免丢失数据
+【参数】 无
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 等待尚未结束的后台保存
+    - 收取后台保存的结果，使编辑日志与模型文件保持一致
+*******************************************************************************/
+Controller::~Controller() {
+    if (m_PendingLoad) {
+        m_PendingLoad->Cancel();
+        m_PendingLoad->Wait();
+    }
+    if (m_PendingSave) {
+        m_PendingSave->Wait();
+        Result SaveResult;
+        CollectSavedModel(&SaveResult);
+    }
+}
+
+/*******************************************************************************
+【函数名称】 ImportModel
+【函数功能】 按扩展名选择导入器导入模型，并将异常转换为操作结果
+【参数】 
+    - const std::string& Path（输入参数）：字符串，文件路径
+    - Model3D& Model（输出参数）：Model3D对象，导入的目标模型
+    - ImportProgress* Progress（输入输出参数）：导入进度，可为空
+    - bool WeldPoints（输入参数）：导入后是否焊接重合的点
+【返回值】 Result：操作结果
+Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 增添了WeldPoints参数
+*******************************************************************************/
+Controller::Result Controller::ImportModel(const std::string& Path,
+    Model3D& Model, ImportProgress* Progress, bool WeldPoints) {
+    auto Importer = CreateImporter(Path);
+    Importer->SetWeldPoints(WeldPoints);
+    try {
+        Importer->Import(Path, Model, Progress);
+    }
+    catch (ExceptionFileExtension) {
+        return Result::R_FILE_EXTENSION_ERROR;
+    }
+    catch (ExceptionFileOpen) {
+        return Result::R_FILE_OPEN_ERROR;
+    }
+    catch (ExceptionFileFormat) {
+        return Result::R_FILE_FORMAT_ERROR;
+    }
+    catch (ExceptionIdenticalPoint) {
+        return Result::R_IDENTICAL_POINTS;
+    }
+    catch (ExceptionImportCancelled) {
+        return Result::R_CANCELLED;
+    }
+    return Result::R_OK;
+}
+
 /*******************************************************************************
 【函数名称】 LoadModel
 【函数功能】 加载模型
@@ -34,12 +183,124 @@ Controller& Controller::GetInstance() {
     - std::string Path（输入参数）：字符串，文件路径
 【返回值】 Result：操作结果
 Created by 朱昊东 on 2024/7/28
-【更改记录】 无
+【更改记录】 
+    2026/10/18
+    - 按扩展名选择导入器，导入过程移至ImportModel
+    - 按导入焊接开关决定是否焊接重合的点
+    - 加载成功后打开编辑日志并重放
 *******************************************************************************/
 Controller::Result Controller::LoadModel(std::string Path) {
-    ObjImporter importer;
+    auto Result = ImportModel(Path, m_Model, nullptr, m_WeldOnImport);
+    if (Result == Result::R_OK) {
+        AttachJournal(Path);
+    }
+    return Result;
+}
+
+/*******************************************************************************
+【函数名称】 LoadModelAsync
+【函数功能】 在后台线程加载模型到独立的模型对象中，当前模型在加载期间保持可用，
+加载结束后需调用CollectLoadedModel替换当前模型
+【参数】 
+    - std::string Path（输入参数）：字符串，文件路径
+    - std::shared_ptr<LoadTask>* TaskPtr（输出参数）：后台加载任务的句柄
+【返回值】 Result：操作结果，已有加载任务在进行时返回R_BUSY
+Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 按发起加载时的导入焊接开关决定是否焊接重合的点
+*******************************************************************************/
+Controller::Result Controller::LoadModelAsync(std::string Path,
+    std::shared_ptr<LoadTask>* TaskPtr) {
+    if (m_PendingLoad) {
+        return Result::R_BUSY;
+    }
+    auto Task = std::make_shared<LoadTask>(Path);
+    LoadTask* RawTask = Task.get();
+    bool WeldPoints = m_WeldOnImport;
+    Task->m_Future = std::async(std::launch::async, [RawTask, WeldPoints]() {
+        return ImportModel(RawTask->m_Path, RawTask->m_Model,
+            &RawTask->m_Progress, WeldPoints);
+    });//任务对象由m_PendingLoad持有，直到线程结束后才会被释放
+    m_PendingLoad = Task;
+    *TaskPtr = Task;
+    return Result::R_OK;
+}
+
+/*******************************************************************************
+【函数名称】 CollectLoadedModel
+【函数功能】 若后台加载已结束，收取其结果；加载成功时以新模型替换当前模型。
+当前模型有未保存的修改且未要求放弃时，不收取并以R_UNSAVED_CHANGES作为结果，
+加载任务保留，由调用者确认后再次收取或调用DiscardLoadedModel放弃
+【参数】 
+    - Result* ResultPtr（输出参数）：后台加载的结果
+    - bool IsDiscardingChanges（输入参数）：是否放弃当前模型未保存的修改
+【返回值】 bool：后台加载是否已结束
+Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 替换模型后打开新模型的编辑日志并重放
+    - 增添了参数IsDiscardingChanges，不再静默覆盖未保存的修改
+*******************************************************************************/
+bool Controller::CollectLoadedModel(Result* ResultPtr,
+    bool IsDiscardingChanges) {
+    if (!m_PendingLoad || !m_PendingLoad->IsReady()) {
+        return false;
+    }
+    if (m_HasUnsavedChanges && !IsDiscardingChanges) {
+        *ResultPtr = Result::R_UNSAVED_CHANGES;
+        return true;
+    }//与ConfirmExit相同，已写入编辑日志的修改不会丢失，无需确认
+    *ResultPtr = m_PendingLoad->m_Future.get();
+    if (*ResultPtr == Result::R_OK) {
+        m_Model.Swap(m_PendingLoad->m_Model);
+        AttachJournal(m_PendingLoad->m_Path);
+    }
+    m_PendingLoad.reset();
+    return true;
+}
+
+/*******************************************************************************
+【函数名称】 DiscardLoadedModel
+【函数功能】 放弃已结束的后台加载，当前模型及其编辑日志不变
+【参数】 无
+【返回值】 bool：是否放弃了已结束的后台加载
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+bool Controller::DiscardLoadedModel() {
+    if (!m_PendingLoad || !m_PendingLoad->IsReady()) {
+        return false;
+    }
+    m_PendingLoad.reset();
+    return true;
+}
+
+/*******************************************************************************
+【函数名称】 GetPendingLoad
+【函数功能】 获取正在进行的后台加载任务
+【参数】 无
+【返回值】 std::shared_ptr<LoadTask>：后台加载任务，没有时为空指针
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+std::shared_ptr<Controller::LoadTask> Controller::GetPendingLoad() const {
+    return m_PendingLoad;
+}
+
+/*******************************************************************************
+【函数名称】 OpenModelLazy
+【函数功能】 以惰性模式打开.obj文件，只建立（或从旁路文件载入）偏移索引，
+当前模型不受影响
+【参数】 
+    - std::string Path（输入参数）：字符串，文件路径
+【返回值】 Result：操作结果
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+Controller::Result Controller::OpenModelLazy(std::string Path) {
     try {
-        importer.Import(Path, m_Model);
+        m_LazyModel.reset(new LazyObjFile(Path));
     }
     catch (ExceptionFileExtension) {
         return Result::R_FILE_EXTENSION_ERROR;
@@ -50,6 +311,49 @@ Controller::Result Controller::LoadModel(std::string Path) {
     catch (ExceptionFileFormat) {
         return Result::R_FILE_FORMAT_ERROR;
     }
+    return Result::R_OK;
+}
+
+/*******************************************************************************
+【函数名称】 GetLazyModel
+【函数功能】 获取惰性模式打开的文件
+【参数】 无
+【返回值】 const LazyObjFile*：惰性模式打开的文件，没有时为空指针
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+const LazyObjFile* Controller::GetLazyModel() const {
+    return m_LazyModel.get();
+}
+
+/*******************************************************************************
+【函数名称】 GetLazyFaces
+【函数功能】 按需读取惰性模式文件中的若干个面，只访问这些面及其点所在的页
+【参数】 
+    - std::size_t FirstID（输入参数）：第一个面的ID，从1开始
+    - std::size_t Count（输入参数）：面的个数，超出末尾的部分被忽略
+    - std::vector<std::shared_ptr<Face3D>>* FacesPtr（输出参数）：面的数组
+【返回值】 Result：操作结果
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+Controller::Result Controller::GetLazyFaces(std::size_t FirstID,
+    std::size_t Count, std::vector<std::shared_ptr<Face3D>>* FacesPtr) {
+    if (!m_LazyModel || FirstID == 0
+        || FirstID > m_LazyModel->GetFaceCount()) {
+        return Result::R_ID_OUT_OF_BOUNDS;
+    }
+    std::size_t Last = std::min(
+        FirstID - 1 + Count, m_LazyModel->GetFaceCount());
+    FacesPtr->clear();
+    try {
+        for (std::size_t i = FirstID - 1; i < Last; i++) {
+            FacesPtr->push_back(m_LazyModel->GetFace(i));
+        }
+    }
+    catch (ExceptionFileFormat) {
+        return Result::R_FILE_FORMAT_ERROR;
+    }
     catch (ExceptionIdenticalPoint) {
         return Result::R_IDENTICAL_POINTS;
     }
@@ -57,18 +361,49 @@ Controller::Result Controller::LoadModel(std::string Path) {
 }
 
 /*******************************************************************************
-【函数名称】 SaveModel  
-【函数功能】 保存模型
+【函数名称】 GetLazyFacePointsById
+【函数功能】 按需读取惰性模式文件中指定面的点集合
 【参数】 
-    - std::string Path（输入参数）：字符串，文件路径
+    - std::size_t ID（输入参数）：面的ID，从1开始
+    - std::vector<std::shared_ptr<Point3D>>* PointsPtr（输出参数）：Point3D智能
+    指针的动态数组
 【返回值】 Result：操作结果
-Created by 朱昊东 on 2024/7/28
+Created by 朱昊东 on 2026/10/18
 【更改记录】 无
 *******************************************************************************/
-Controller::Result Controller::SaveModel(std::string Path) const {
-    ObjExporter exporter;
+Controller::Result Controller::GetLazyFacePointsById(std::size_t ID,
+    std::vector<std::shared_ptr<Point3D>>* PointsPtr) {
+    std::vector<std::shared_ptr<Face3D>> Faces;
+    auto Result = GetLazyFaces(ID, 1, &Faces);
+    if (Result == Result::R_OK) {
+        *PointsPtr = Faces[0]->GetPointsVector();
+    }
+    return Result;
+}
+
+/*******************************************************************************
+【函数名称】 ExportModel
+【函数功能】 按扩展名选择导出器导出模型，并将异常转换为操作结果
+【参数】 
+    - const std::string& Path（输入参数）：字符串，文件路径
+    - const Model3D& Model（输入参数）：Model3D对象，要导出的模型
+    - bool WeldPoints（输入参数）：导出时是否焊接重合的点
+    - const std::function<bool(const std::string&)>& BeforeReplace
+    （输入参数）：替换目标文件前的回调，可为空
+【返回值】 Result：操作结果
+Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 增添了参数BeforeReplace
+*******************************************************************************/
+Controller::Result Controller::ExportModel(const std::string& Path,
+    const Model3D& Model, bool WeldPoints,
+    const std::function<bool(const std::string&)>& BeforeReplace) {
+    auto Exporter = CreateExporter(Path);
+    Exporter->SetWeldPoints(WeldPoints);
+    Exporter->SetBeforeReplace(BeforeReplace);
     try {
-        exporter.Export(Path, m_Model);
+        Exporter->Export(Path, Model);
     }
     catch (ExceptionFileExtension) {
         return Result::R_FILE_EXTENSION_ERROR;
@@ -79,28 +414,191 @@ Controller::Result Controller::SaveModel(std::string Path) const {
     return Result::R_OK;
 }
 
+/*******************************************************************************
+【函数名称】 SaveModel  
+【函数功能】 保存模型
+【参数】 
+    - std::string Path（输入参数）：字符串，文件路径
+【返回值】 Result：操作结果
+Created by 朱昊东 on 2024/7/28
+【更改记录】 
+    2026/10/18
+    - 按扩展名选择导出器
+    - 按导出焊接开关决定是否焊接重合的点
+    - 导出过程移至ExportModel
+    - 开启导出优化且不是保存到模型文件时，导出按顶点缓存优化了面顺序的副本
+*******************************************************************************/
+Controller::Result Controller::SaveModel(std::string Path) const {
+    if (m_OptimizeOnExport && Path != m_ModelPath) {
+        Model3D Optimized;
+        Optimized.CopyFrom(m_Model);
+        VertexCacheOptimizer().Optimize(Optimized);
+        return ExportModel(Path, Optimized, m_WeldOnExport);
+    }//模型文件须保持编辑时的面顺序，日志中的面编号才有效
+    return ExportModel(Path, m_Model, m_WeldOnExport);
+}
+
+/*******************************************************************************
+【函数名称】 SaveModelAsync
+【函数功能】 拷贝当前模型的快照，在后台线程把快照保存到Path；保存期间当前模型
+可以继续编辑，编辑不影响正在保存的内容
+【参数】 
+    - std::string Path（输入参数）：字符串，文件路径
+    - std::shared_ptr<SaveTask>* TaskPtr（输出参数）：后台保存任务的句柄
+【返回值】 Result：操作结果，已有保存任务在进行时返回R_BUSY
+Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 保存到模型文件时记录日志的当前位置
+    - 替换模型文件前在日志中写入保存标记，替换后即使来不及清理日志，
+    重新加载时也能找回保存期间的编辑
+    - 记录发起保存时的修改计数
+    - 开启导出优化且不是保存到模型文件时，在后台线程优化快照的面顺序
+*******************************************************************************/
+Controller::Result Controller::SaveModelAsync(std::string Path,
+    std::shared_ptr<SaveTask>* TaskPtr) {
+    if (m_PendingSave) {
+        return Result::R_BUSY;
+    }
+    auto Task = std::make_shared<SaveTask>(Path);
+    Task->m_Snapshot.CopyFrom(m_Model);
+    Task->m_EditCount = m_EditCount;
+    std::function<bool(const std::string&)> BeforeReplace;
+    if (m_Journal && Path == m_Journal->ModelPath) {
+        Task->m_Journal = m_Journal;
+        Task->m_JournalSize = m_Journal->GetSize();
+        Task->m_JournalGeneration = m_Journal->GetGeneration();
+        std::shared_ptr<EditJournal> Journal = m_Journal;
+        std::uint64_t Folded = Task->m_JournalSize;
+        std::uint64_t Generation = Task->m_JournalGeneration;
+        BeforeReplace = [Journal, Folded, Generation](
+            const std::string& TempPath) {
+            return Journal->MarkSaved(Folded, Generation, TempPath);
+        };//标记写不进日志时放弃保存，以免日志与模型文件失配
+    }//快照包含此前日志中的全部编辑
+    SaveTask* RawTask = Task.get();
+    bool WeldPoints = m_WeldOnExport;
+    bool OptimizeCache = m_OptimizeOnExport && Path != m_ModelPath;
+    Task->m_Future = std::async(std::launch::async,
+        [RawTask, WeldPoints, OptimizeCache, BeforeReplace]() {
+        if (OptimizeCache) {
+            VertexCacheOptimizer().Optimize(RawTask->m_Snapshot);
+        }//快照是独立的副本，重排它不影响当前模型的面编号
+        return ExportModel(RawTask->m_Path, RawTask->m_Snapshot, WeldPoints,
+            BeforeReplace);
+    });//任务对象由m_PendingSave持有，直到线程结束后才会被释放
+    m_PendingSave = Task;
+    *TaskPtr = Task;
+    return Result::R_OK;
+}
+
+/*******************************************************************************
+【函数名称】 CollectSavedModel
+【函数功能】 若后台保存已结束，收取其结果并释放快照
+【参数】 
+    - Result* ResultPtr（输出参数）：后台保存的结果
+【返回值】 bool：是否收取到已结束的后台保存
+Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 成功保存到模型文件后，丢弃日志中已并入快照的记录
+    - 批量修改后保存到模型文件且其间没有新的修改时，重新打开编辑日志
+*******************************************************************************/
+bool Controller::CollectSavedModel(Result* ResultPtr) {
+    if (!m_PendingSave || !m_PendingSave->IsReady()) {
+        return false;
+    }
+    *ResultPtr = m_PendingSave->m_Future.get();
+    if (*ResultPtr == Result::R_OK && m_PendingSave->m_Journal
+        && m_PendingSave->m_Journal == m_Journal
+        && m_Journal->GetGeneration() == m_PendingSave->m_JournalGeneration) {
+        m_Journal->Rebase(m_PendingSave->m_JournalSize);
+    }//保存期间追加的记录仍保留在日志中
+    else if (*ResultPtr == Result::R_OK && !m_Journal && m_HasUnsavedChanges
+        && m_PendingSave->m_Path == m_ModelPath
+        && m_PendingSave->m_EditCount == m_EditCount) {
+        AttachJournal(m_ModelPath);
+    }//模型文件已与当前模型一致
+    m_PendingSave.reset();
+    return true;
+}
+
+/*******************************************************************************
+【函数名称】 GetPendingSave
+【函数功能】 获取正在进行的后台保存任务
+【参数】 无
+【返回值】 std::shared_ptr<SaveTask>：后台保存任务，没有时为空指针
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+std::shared_ptr<Controller::SaveTask> Controller::GetPendingSave() const {
+    return m_PendingSave;
+}
+
 /*******************************************************************************
 【函数名称】 GetPoints
 【函数功能】 获取点
 【参数】 无
-【返回值】 std::vector<std::shared_ptr<Line3D>>&：线的智能指针构成的向量
+【返回值】 std::vector<std::shared_ptr<Line3D>>：线的智能指针构成的向量，
+第i项为ID为i + 1的线
 Created by 朱昊东 on 2024/7/28
-【更改记录】 无
+【更改记录】 
+    2026/10/18
+    - 按ID而不是存储顺序排列
 *******************************************************************************/
-const std::vector<std::shared_ptr<Line3D>>& Controller::GetLines() const {
-    return m_Model.Lines;
+std::vector<std::shared_ptr<Line3D>> Controller::GetLines() const {
+    std::vector<std::shared_ptr<Line3D>> Lines;
+    Lines.reserve(m_Model.Lines.size());
+    for (std::size_t i = 0; i < m_Model.Lines.size(); i++) {
+        Lines.push_back(m_Model.Lines[m_Model.GetLineSlot(i)]);
+    }
+    return Lines;
 }
 
 /*******************************************************************************
 【函数名称】 GetPoints
 【函数功能】 获取点
 【参数】 无
-【返回值】 std::vector<std::shared_ptr<Face3D>>&：面的智能指针构成的向量
+【返回值】 std::vector<std::shared_ptr<Face3D>>：面的智能指针构成的向量，
+第i项为ID为i + 1的面
 Created by 朱昊东 on 2024/7/28
+【更改记录】 
+    2026/10/18
+    - 按ID而不是存储顺序排列
+*******************************************************************************/
+std::vector<std::shared_ptr<Face3D>> Controller::GetFaces() const {
+    std::vector<std::shared_ptr<Face3D>> Faces;
+    Faces.reserve(m_Model.Faces.size());
+    for (std::size_t i = 0; i < m_Model.Faces.size(); i++) {
+        Faces.push_back(m_Model.Faces[m_Model.GetFaceSlot(i)]);
+    }
+    return Faces;
+}
+
+/*******************************************************************************
+【函数名称】 GetFaceAttributes
+【函数功能】 获取面属性缓存，失效的面在返回前重新计算
+【参数】 无
+【返回值】 const FaceAttributeCache<3>&：面属性缓存，按存储顺序排列，
+ID对应的位置由GetFaceSlotById给出
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+const FaceAttributeCache<3>& Controller::GetFaceAttributes() const {
+    return m_Model.GetFaceAttributes();
+}
+
+/*******************************************************************************
+【函数名称】 GetFaceSlotById
+【函数功能】 获取面在存储顺序（面属性缓存）中的位置
+【参数】 
+    - std::size_t ID（输入参数）：面的ID，应在1到面数之间
+【返回值】 std::size_t：存储位置
+Created by 朱昊东 on 2026/10/18
 【更改记录】 无
 *******************************************************************************/
-const std::vector<std::shared_ptr<Face3D>>& Controller::GetFaces() const {
-    return m_Model.Faces;
+std::size_t Controller::GetFaceSlotById(std::size_t ID) const {
+    return m_Model.GetFaceSlot(ID - 1);
 }
 
 /*******************************************************************************
@@ -112,14 +610,16 @@ const std::vector<std::shared_ptr<Face3D>>& Controller::GetFaces() const {
     指针的动态数组
 【返回值】 Result：操作结果
 Created by 朱昊东 on 2024/7/28
-【更改记录】 无
+【更改记录】 
+    2026/10/18
+    - 经模型中的映射由ID找到线
 *******************************************************************************/
 Controller::Result Controller::GetLinePointsById(std::size_t ID,
                     std::vector<std::shared_ptr<Point3D>>* PointsPtr) const {
     if (ID == 0 || ID > m_Model.Lines.size()) {
         return Result::R_ID_OUT_OF_BOUNDS;
     }
-    *PointsPtr = m_Model.Lines[ID-1]->GetPointsVector();
+    *PointsPtr = m_Model.Lines[m_Model.GetLineSlot(ID-1)]->GetPointsVector();
     return Result::R_OK;
 }
 
@@ -132,14 +632,16 @@ Controller::Result Controller::GetLinePointsById(std::size_t ID,
     指针的动态数组
 【返回值】 Result：操作结果
 Created by 朱昊东 on 2024/7/28
-【更改记录】 无
+【更改记录】 
+    2026/10/18
+    - 经模型中的映射由ID找到面
 *******************************************************************************/
 Controller::Result Controller::GetFacePointsById(std::size_t ID,
     std::vector<std::shared_ptr<Point3D>>* PointsPtr) const {
     if (ID == 0 || ID > m_Model.Faces.size()) {
         return Result::R_ID_OUT_OF_BOUNDS;
     }
-    *PointsPtr = m_Model.Faces[ID-1]->GetPointsVector();
+    *PointsPtr = m_Model.Faces[m_Model.GetFaceSlot(ID-1)]->GetPointsVector();
     return Result::R_OK;
 }
 
@@ -150,12 +652,18 @@ Controller::Result Controller::GetFacePointsById(std::size_t ID,
     - std::size_t ID（输入参数）：线的ID
 【返回值】 Result：操作结果
 Created by 朱昊东 on 2024/7/28
-【更改记录】 无
+【更改记录】 
+    2026/10/18
+    - 成功后追加到编辑日志
 *******************************************************************************/
 
 Controller::Result Controller::RemoveLineById(std::size_t ID) {
     if (m_Model.RemoveLine(ID - 1)) {
         //m_LineStates.erase(m_LineStates.begin() + ID - 1);
+        EditJournal::Record Entry = {};
+        Entry.Op = EditJournal::Operation::REMOVE_LINE;
+        Entry.ID = ID;
+        AppendToJournal(Entry);
         return Result::R_OK;
     }
     else {
@@ -170,11 +678,17 @@ Controller::Result Controller::RemoveLineById(std::size_t ID) {
     - std::size_t id（输入参数）：面的ID
 【返回值】 Result：操作结果
 Created by 朱昊东 on 2024/7/28
-【更改记录】 无
+【更改记录】 
+    2026/10/18
+    - 成功后追加到编辑日志
 *******************************************************************************/
 Controller::Result Controller::RemoveFaceById(std::size_t ID) {
     if (m_Model.RemoveFace(ID - 1)) {
         //m_FaceStates.erase(m_FaceStates.begin() + ID - 1);
+        EditJournal::Record Entry = {};
+        Entry.Op = EditJournal::Operation::REMOVE_FACE;
+        Entry.ID = ID;
+        AppendToJournal(Entry);
         return Result::R_OK;
     }
     else {
@@ -197,6 +711,8 @@ Created by 朱昊东 on 2024/7/28
 【更改记录】 
     2024/8/17
     - 修改了一些缩进问题
+    2026/10/18
+    - 成功后追加到编辑日志
 *******************************************************************************/
 
 Controller::Result Controller::AddLine(
@@ -216,6 +732,11 @@ Controller::Result Controller::AddLine(
         return Result::R_IDENTICAL_ELEMENTS;
     }
     //m_LineStates.push_back(State::S_CREATED);
+    EditJournal::Record Entry = {};
+    Entry.Op = EditJournal::Operation::ADD_LINE;
+    std::copy(firstCoords, firstCoords + 3, Entry.Coordinates);
+    std::copy(secondCoords, secondCoords + 3, Entry.Coordinates + 3);
+    AppendToJournal(Entry);
     return Result::R_OK;
 }
 
@@ -237,6 +758,8 @@ Created by 朱昊东 on 2024/7/28
 【更改记录】 
     2024/8/17
     - 修改了一些缩进问题
+    2026/10/18
+    - 成功后追加到编辑日志
 *******************************************************************************/
 
 Controller::Result Controller::AddFace(
@@ -259,6 +782,12 @@ Controller::Result Controller::AddFace(
         return Result::R_IDENTICAL_ELEMENTS;
     }
     //m_FaceStates.push_back(State::S_CREATED);
+    EditJournal::Record Entry = {};
+    Entry.Op = EditJournal::Operation::ADD_FACE;
+    std::copy(firstCoords, firstCoords + 3, Entry.Coordinates);
+    std::copy(secondCoords, secondCoords + 3, Entry.Coordinates + 3);
+    std::copy(thirdCoords, thirdCoords + 3, Entry.Coordinates + 6);
+    AppendToJournal(Entry);
     return Result::R_OK;
 }
 
@@ -273,7 +802,11 @@ Controller::Result Controller::AddFace(
     - double Z（输入参数）：double，点的z坐标
 【返回值】 Result：操作结果
 Created by 朱昊东 on 2024/7/28
-【更改记录】 无
+【更改记录】 
+    2026/10/18
+    - 成功后追加到编辑日志
+    - 点重合或与其他线相同时返回R_IDENTICAL_POINTS或R_IDENTICAL_ELEMENTS，
+    线保持不变，不写入编辑日志
 *******************************************************************************/
 Controller::Result Controller::ModifyLine(std::size_t ID, int PointIndex,
                                           double X, double Y, double Z) {
@@ -289,7 +822,19 @@ Controller::Result Controller::ModifyLine(std::size_t ID, int PointIndex,
     catch (ExceptionIndexOutOfBounds) {
         return Result::R_POINT_INDEX_ERROR;
     }
+    catch (ExceptionIdenticalPoint) {
+        return Result::R_IDENTICAL_POINTS;
+    }
+    catch (ExceptionIdenticalElement) {
+        return Result::R_IDENTICAL_ELEMENTS;
+    }//Model::ModifyLine抛出异常时线不变，与编辑日志一致
     //m_LineStates[ID - 1] = State::S_MODIFIED;
+    EditJournal::Record Entry = {};
+    Entry.Op = EditJournal::Operation::MODIFY_LINE;
+    Entry.ID = ID;
+    Entry.PointIndex = PointIndex;
+    std::copy(Coords, Coords + 3, Entry.Coordinates);
+    AppendToJournal(Entry);
     return Result::R_OK;
 }
 
@@ -304,7 +849,11 @@ Controller::Result Controller::ModifyLine(std::size_t ID, int PointIndex,
     - double Z（输入参数）：double，点的z坐标
 【返回值】 Result：操作结果
 Created by 朱昊东 on 2024/7/28
-【更改记录】 无
+【更改记录】 
+    2026/10/18
+    - 成功后追加到编辑日志
+    - 点重合或与其他面相同时返回R_IDENTICAL_POINTS或R_IDENTICAL_ELEMENTS，
+    面保持不变，不写入编辑日志
 *******************************************************************************/
 Controller::Result Controller::ModifyFace(std::size_t ID, int PointIndex,
                                           double X, double Y, double Z) {
@@ -319,7 +868,19 @@ Controller::Result Controller::ModifyFace(std::size_t ID, int PointIndex,
     catch (ExceptionIndexOutOfBounds) {
         return Result::R_POINT_INDEX_ERROR;
     }
+    catch (ExceptionIdenticalPoint) {
+        return Result::R_IDENTICAL_POINTS;
+    }
+    catch (ExceptionIdenticalElement) {
+        return Result::R_IDENTICAL_ELEMENTS;
+    }//Model::ModifyFace抛出异常时面不变，与编辑日志一致
     //m_FaceStates[ID - 1] = State::S_MODIFIED;
+    EditJournal::Record Entry = {};
+    Entry.Op = EditJournal::Operation::MODIFY_FACE;
+    Entry.ID = ID;
+    Entry.PointIndex = PointIndex;
+    std::copy(Coords, Coords + 3, Entry.Coordinates);
+    AppendToJournal(Entry);
     return Result::R_OK;
 }
 
@@ -329,7 +890,12 @@ Controller::Result Controller::ModifyFace(std::size_t ID, int PointIndex,
 【参数】 无
 【返回值】 Statistics：统计信息
 Created by 朱昊东 on 2024/7/28
-【更改记录】 无
+【更改记录】 
+    2026/10/18
+    - 面积改为从面属性缓存中读取
+    - 增添了一次遍历求出的质量属性
+    - 增添了有向包围盒
+    - 质量属性与有向包围盒移至GetShapeProperties，不再在每次统计时求凸包
 *******************************************************************************/
 Controller::Statistics Controller::GetStatistics() const {
     Statistics Stats {
@@ -343,8 +909,1036 @@ Controller::Statistics Controller::GetStatistics() const {
     for (auto line: m_Model.Lines) {
         Stats.TotalLineLength += line->GetLength();
     }
-    for (auto face: m_Model.Faces) {
-        Stats.TotalFaceArea += face->GetArea();
+    for (double Area: m_Model.GetFaceAttributes().Areas) {
+        Stats.TotalFaceArea += Area;
     }
     return Stats;
-}
\ No newline at end of file
+}
+
+/*******************************************************************************
+【函数名称】 GetShapeProperties
+【函数功能】 求面所围的质量属性，以及主成分包围盒与凸包上的最小体积有向包围盒；
+求凸包与最小包围盒的耗时远大于其他统计，因此不包含在GetStatistics中
+【参数】 
+    - ShapeProperties* PropertiesPtr（输出参数）：形状属性
+【返回值】 Result：操作结果
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+Controller::Result Controller::GetShapeProperties(
+    ShapeProperties* PropertiesPtr) const {
+    PropertiesPtr->Mass = MassIntegrator().Integrate(m_Model);
+    PropertiesPtr->OrientedBoxes = BoxFitter().Fit(m_Model);
+    return Result::R_OK;
+}
+
+/*******************************************************************************
+【函数名称】 BenchmarkCompression
+【函数功能】 以.cmf格式保存模型并重新读入，测量压缩率与编解码吞吐量；此前先开启
+焊接保存并读回一次，检查线数和面数与焊接后的模型一致
+【参数】 
+    - std::string Path（输入参数）：字符串，.cmf文件路径
+    - CompressionReport* ReportPtr（输出参数）：测评结果
+【返回值】 Result：操作结果
+Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 读回的文件含有无效元素时返回R_IDENTICAL_POINTS或R_IDENTICAL_ELEMENTS
+    - 增添了开启焊接时的读回检查
+*******************************************************************************/
+Controller::Result Controller::BenchmarkCompression(std::string Path,
+    CompressionReport* ReportPtr) const {
+    if (!IsCmfPath(Path)) {
+        return Result::R_FILE_EXTENSION_ERROR;
+    }
+    using Clock = std::chrono::steady_clock;
+    CmfExporter Exporter;
+    CmfImporter Importer;
+    Model3D Decoded;
+    ReportPtr->IsWeldedRoundTripValid = false;
+    try {
+        IndexedModel<3> Welded(m_Model, true);
+        Model3D Reloaded;
+        Exporter.SetWeldPoints(true);
+        Exporter.Export(Path, m_Model);
+        Importer.Import(Path, Reloaded);
+        ReportPtr->IsWeldedRoundTripValid
+            = Reloaded.Lines.size() == Welded.LineIndices.size() / 2
+            && Reloaded.Faces.size() == Welded.FaceIndices.size() / 3;
+    }
+    catch (ExceptionFileOpen) {
+        return Result::R_FILE_OPEN_ERROR;
+    }
+    catch (...) {
+    }//读回失败即检查不通过，下面的测评照常进行
+    Exporter.SetWeldPoints(false);
+    try {
+        auto Start = Clock::now();
+        Exporter.Export(Path, m_Model);
+        auto Encoded = Clock::now();
+        Importer.Import(Path, Decoded);
+        auto Finish = Clock::now();
+        ReportPtr->EncodeSeconds
+            = std::chrono::duration<double>(Encoded - Start).count();
+        ReportPtr->DecodeSeconds
+            = std::chrono::duration<double>(Finish - Encoded).count();
+    }
+    catch (ExceptionFileOpen) {
+        return Result::R_FILE_OPEN_ERROR;
+    }
+    catch (ExceptionFileFormat) {
+        return Result::R_FILE_FORMAT_ERROR;
+    }
+    catch (ExceptionIdenticalPoint) {
+        return Result::R_IDENTICAL_POINTS;
+    }
+    catch (ExceptionIdenticalElement) {
+        return Result::R_IDENTICAL_ELEMENTS;
+    }//解码出无效的元素时报告错误，而不是终止程序
+    ReportPtr->TriangleCount = m_Model.Faces.size();
+    ReportPtr->Bytes = std::filesystem::file_size(Path);
+    ReportPtr->BytesPerTriangle = ReportPtr->TriangleCount == 0 ? 0
+        : static_cast<double>(ReportPtr->Bytes) / ReportPtr->TriangleCount;
+    return Result::R_OK;
+}
+
+/*******************************************************************************
+【函数名称】 WeldPoints
+【函数功能】 合并当前模型中相距在Point::IsSame容差以内的点；合并了点时关闭编辑
+日志，由用户决定是否保存
+【参数】 
+    - WeldReport* ReportPtr（输出参数）：焊接结果
+【返回值】 Result：操作结果
+Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 焊接后做一次检查点
+    - 不再自动写回模型文件
+*******************************************************************************/
+Controller::Result Controller::WeldPoints(WeldReport* ReportPtr) {
+    *ReportPtr = m_Model.WeldPoints();
+    if (ReportPtr->PointsAfter != ReportPtr->PointsBefore
+        || ReportPtr->DegenerateElements != 0) {
+        DetachJournal();
+    }
+    return Result::R_OK;
+}
+
+/*******************************************************************************
+【函数名称】 SetWeldOnImport
+【函数功能】 设置加载模型后是否自动焊接重合的点
+【参数】 
+    - bool WeldOnImport（输入参数）：是否焊接
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+void Controller::SetWeldOnImport(bool WeldOnImport) {
+    m_WeldOnImport = WeldOnImport;
+}
+
+/*******************************************************************************
+【函数名称】 SetWeldOnExport
+【函数功能】 设置保存模型时是否在导出的文件中焊接重合的点，当前模型不受影响
+【参数】 
+    - bool WeldOnExport（输入参数）：是否焊接
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+void Controller::SetWeldOnExport(bool WeldOnExport) {
+    m_WeldOnExport = WeldOnExport;
+}
+
+/*******************************************************************************
+【函数名称】 IsWeldingOnImport
+【函数功能】 加载模型后是否自动焊接重合的点
+【参数】 无
+【返回值】 bool：是否焊接
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+bool Controller::IsWeldingOnImport() const {
+    return m_WeldOnImport;
+}
+
+/*******************************************************************************
+【函数名称】 IsWeldingOnExport
+【函数功能】 保存模型时是否焊接重合的点
+【参数】 无
+【返回值】 bool：是否焊接
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+bool Controller::IsWeldingOnExport() const {
+    return m_WeldOnExport;
+}
+
+/*******************************************************************************
+【函数名称】 Checkpoint
+【函数功能】 把当前模型完整写回模型文件（先写临时文件再重命名），然后清空编辑日志；
+批量修改关闭了日志时，写回模型文件后重新打开日志；没有需要写回的修改时不做任何事
+【参数】 无
+【返回值】 Result：操作结果
+Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 批量修改之后由此显式写回模型文件
+*******************************************************************************/
+Controller::Result Controller::Checkpoint() {
+    if (!m_Journal && !m_HasUnsavedChanges) {
+        return Result::R_OK;
+    }
+    if (m_PendingSave) {
+        m_PendingSave->Wait();
+    }//避免与后台保存同时写同一个临时文件
+    if (!m_Journal) {
+        auto Result = ExportModel(m_ModelPath, m_Model, false);
+        if (Result == Result::R_OK) {
+            AttachJournal(m_ModelPath);
+        }//写回失败时保持未保存状态
+        return Result;
+    }
+    std::uint64_t Folded = m_Journal->GetSize();
+    auto Result = ExportModel(m_Journal->ModelPath, m_Model, false);
+    if (Result == Result::R_OK) {
+        m_Journal->Rebase(Folded);
+    }
+    return Result;
+}
+
+/*******************************************************************************
+【函数名称】 GetJournalLength
+【函数功能】 获取编辑日志中尚未并入模型文件的记录数
+【参数】 无
+【返回值】 std::size_t：记录数，没有打开日志时为0
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+std::size_t Controller::GetJournalLength() const {
+    return m_Journal ? m_Journal->GetRecordCount() : 0;
+}
+
+/*******************************************************************************
+【函数名称】 HasUnsavedChanges
+【函数功能】 判断是否有既不在模型文件中、也不在编辑日志中的修改。批量修改无法逐条
+写入日志，它们之后的修改只存在于内存中，直到Checkpoint或保存到模型文件
+【参数】 无
+【返回值】 bool：是否有未保存的修改
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+bool Controller::HasUnsavedChanges() const {
+    return m_HasUnsavedChanges;
+}
+
+/*******************************************************************************
+【函数名称】 GetReplayedEditCount
+【函数功能】 获取最近一次加载模型时从编辑日志重放的编辑数
+【参数】 无
+【返回值】 std::size_t：编辑数
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+std::size_t Controller::GetReplayedEditCount() const {
+    return m_ReplayedEdits;
+}
+
+/*******************************************************************************
+【函数名称】 SimplifyModel
+【函数功能】 用二次误差边折叠简化当前模型，面数降到TargetFaceCount或下一次折叠的
+误差超过MaxError时停止；简化是有损的，完成后只关闭编辑日志，由用户决定是否保存
+【参数】 
+    - std::size_t TargetFaceCount（输入参数）：目标面数
+    - double MaxError（输入参数）：允许的最大二次误差
+    - SimplifyReport* ReportPtr（输出参数）：简化结果
+【返回值】 Result：操作结果
+Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 不再自动写回模型文件
+*******************************************************************************/
+Controller::Result Controller::SimplifyModel(std::size_t TargetFaceCount,
+    double MaxError, SimplifyReport* ReportPtr) {
+    MeshSimplifier Simplifier(TargetFaceCount, MaxError);
+    *ReportPtr = Simplifier.Simplify(m_Model);
+    DetachJournal();
+    return Result::R_OK;
+}
+
+/*******************************************************************************
+【函数名称】 OptimizeVertexCache
+【函数功能】 按Forsyth算法计算有利于GPU顶点缓存的面顺序，报告按该顺序导出时的ACMR；
+当前模型的面顺序与编号不变，优化由SetOptimizeOnExport开启后在导出时作用于副本
+【参数】 
+    - CacheReport* ReportPtr（输出参数）：重排前后的ACMR
+【返回值】 Result：操作结果
+Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 不再重排当前模型，也不再做检查点
+*******************************************************************************/
+Controller::Result Controller::OptimizeVertexCache(
+    CacheReport* ReportPtr) const {
+    *ReportPtr = VertexCacheOptimizer().Measure(m_Model);
+    return Result::R_OK;
+}
+
+/*******************************************************************************
+【函数名称】 SetOptimizeOnExport
+【函数功能】 设置保存时是否按顶点缓存优化导出文件中面的顺序。当前模型不受影响；
+保存到模型文件本身时不优化，使文件中的面编号与编辑日志一致
+【参数】 
+    - bool OptimizeOnExport（输入参数）：是否优化
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+void Controller::SetOptimizeOnExport(bool OptimizeOnExport) {
+    m_OptimizeOnExport = OptimizeOnExport;
+}
+
+/*******************************************************************************
+【函数名称】 IsOptimizingOnExport
+【函数功能】 保存时是否按顶点缓存优化面的顺序
+【参数】 无
+【返回值】 bool：是否优化
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+bool Controller::IsOptimizingOnExport() const {
+    return m_OptimizeOnExport;
+}
+
+/*******************************************************************************
+【函数名称】 ReorderSpatially
+【函数功能】 按Morton码重排当前模型中点、线和面的存储，重排前后各测量三次统计与
+建立索引的耗时并取最小值，两项合计没有变快时恢复重排前的存储顺序；线和面的ID经
+模型中的映射保持不变，导出的文件也不变，模型文件与编辑日志仍然有效
+【参数】 
+    - LocalityReport* ReportPtr（输出参数）：重排结果与耗时
+【返回值】 Result：操作结果
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+Controller::Result Controller::ReorderSpatially(LocalityReport* ReportPtr) {
+    using Clock = std::chrono::steady_clock;
+    auto Measure = [](const auto& Pass) {
+        double Best = std::numeric_limits<double>::max();
+        for (int i = 0; i < 3; i++) {
+            auto Start = Clock::now();
+            Pass();
+            Best = std::min(Best, std::chrono::duration<double>(
+                Clock::now() - Start).count());
+        }
+        return Best;
+    };
+    auto Statistics = [this]() {
+        volatile double Area = GetStatistics().TotalFaceArea;
+        (void)Area;
+    };//写入volatile变量，避免整个计算被优化掉
+    auto Indexing = [this]() {
+        IndexedModel<3> Indexed(m_Model);
+    };
+    ReportPtr->StatisticsSecondsBefore = Measure(Statistics);
+    ReportPtr->IndexingSecondsBefore = Measure(Indexing);
+    std::vector<std::size_t> LineOrder = m_Model.GetLineIndicesBySlot();
+    std::vector<std::size_t> FaceOrder = m_Model.GetFaceIndicesBySlot();
+    MortonReorderer Reorderer;
+    Reorderer.Reorder(m_Model);
+    ReportPtr->StatisticsSecondsAfter = Measure(Statistics);
+    ReportPtr->IndexingSecondsAfter = Measure(Indexing);
+    ReportPtr->IsKept = ReportPtr->StatisticsSecondsAfter
+        + ReportPtr->IndexingSecondsAfter < ReportPtr->StatisticsSecondsBefore
+        + ReportPtr->IndexingSecondsBefore;
+    if (!ReportPtr->IsKept) {
+        for (std::size_t& Index : LineOrder) {
+            Index = m_Model.GetLineSlot(Index);
+        }
+        for (std::size_t& Index : FaceOrder) {
+            Index = m_Model.GetFaceSlot(Index);
+        }
+        m_Model.Compact(LineOrder, FaceOrder, {});
+    }//已按原来的存储顺序排列的模型（如按行生成的网格）重排后可能变慢
+    ReportPtr->LineCount = m_Model.Lines.size();
+    ReportPtr->FaceCount = m_Model.Faces.size();
+    return Result::R_OK;
+}
+
+/*******************************************************************************
+【函数名称】 LabelComponents
+【函数功能】 把当前模型划分为互不相连（不共享点）的部分并统计各部分的信息
+【参数】 
+    - std::vector<ComponentInfo>* ComponentsPtr（输出参数）：各部分的统计信息，
+    按第一个元素出现的顺序排列
+【返回值】 Result：操作结果
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+Controller::Result Controller::LabelComponents(
+    std::vector<ComponentInfo>* ComponentsPtr) const {
+    ComponentLabeler Labeler;
+    *ComponentsPtr = Labeler.Label(m_Model, nullptr, nullptr);
+    return Result::R_OK;
+}
+
+/*******************************************************************************
+【函数名称】 ExportComponents
+【函数功能】 把当前模型的每个连通部分分别保存，第k个部分（从1开始）保存到
+"<文件名>_k<扩展名>"中，格式由扩展名决定
+【参数】 
+    - std::string Path（输入参数）：字符串，文件路径模板
+    - std::size_t* CountPtr（输出参数）：保存的部分数
+【返回值】 Result：操作结果，任一部分保存失败时立即返回
+Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 各部分的元素按ID而不是存储顺序加入
+*******************************************************************************/
+Controller::Result Controller::ExportComponents(std::string Path,
+    std::size_t* CountPtr) const {
+    *CountPtr = 0;
+    ComponentLabeler Labeler;
+    std::vector<std::size_t> LineLabels;
+    std::vector<std::size_t> FaceLabels;
+    auto Components = Labeler.Label(m_Model, &LineLabels, &FaceLabels);
+    std::vector<std::unique_ptr<Model3D>> Parts;
+    for (std::size_t k = 0; k < Components.size(); k++) {
+        Parts.emplace_back(
+            new Model3D(m_Model.Name + "_" + std::to_string(k + 1)));
+    }
+    for (std::size_t i = 0; i < LineLabels.size(); i++) {
+        std::size_t Slot = m_Model.GetLineSlot(i);
+        Parts[LineLabels[Slot]]->AddLineUnchecked(*m_Model.Lines[Slot]);
+    }
+    for (std::size_t i = 0; i < FaceLabels.size(); i++) {
+        std::size_t Slot = m_Model.GetFaceSlot(i);
+        Parts[FaceLabels[Slot]]->AddFaceUnchecked(*m_Model.Faces[Slot]);
+    }//按ID加入，元素的副本与当前模型共享点对象，只在导出期间读取
+    std::filesystem::path Template(Path);
+    for (std::size_t k = 0; k < Parts.size(); k++) {
+        std::filesystem::path PartPath = Template.parent_path() / (
+            Template.stem().string() + "_" + std::to_string(k + 1)
+            + Template.extension().string());
+        auto Result = ExportModel(PartPath.string(), *Parts[k],
+            m_WeldOnExport);
+        if (Result != Result::R_OK) {
+            return Result;
+        }
+        (*CountPtr)++;
+    }
+    return Result::R_OK;
+}
+
+/*******************************************************************************
+【函数名称】 ExportConvexHull
+【函数功能】 求当前模型（Component为0时）或其第Component个连通部分（从1开始，
+编号与LabelComponents一致）的凸包，计算其面积与体积后保存，格式由扩展名决定
+【参数】 
+    - std::string Path（输入参数）：字符串，文件路径
+    - std::size_t Component（输入参数）：连通部分的编号，0表示整个模型
+    - HullReport* ReportPtr（输出参数）：凸包的信息
+【返回值】 Result：操作结果，部分编号越界时为R_ID_OUT_OF_BOUNDS
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+Controller::Result Controller::ExportConvexHull(std::string Path,
+    std::size_t Component, HullReport* ReportPtr) const {
+    const Model3D* Source = &m_Model;
+    Model3D Part(m_Model.Name + "_" + std::to_string(Component));
+    if (Component != 0) {
+        std::vector<std::size_t> LineLabels;
+        std::vector<std::size_t> FaceLabels;
+        auto Components = ComponentLabeler().Label(
+            m_Model, &LineLabels, &FaceLabels);
+        if (Component > Components.size()) {
+            return Result::R_ID_OUT_OF_BOUNDS;
+        }
+        for (std::size_t i = 0; i < LineLabels.size(); i++) {
+            if (LineLabels[i] == Component - 1) {
+                Part.AddLineUnchecked(*m_Model.Lines[i]);
+            }
+        }
+        for (std::size_t i = 0; i < FaceLabels.size(); i++) {
+            if (FaceLabels[i] == Component - 1) {
+                Part.AddFaceUnchecked(*m_Model.Faces[i]);
+            }
+        }//元素的副本与当前模型共享点对象，只在此期间读取
+        Source = &Part;
+    }
+    Model3D Hull;
+    auto Start = std::chrono::steady_clock::now();
+    HullBuilder().Build(*Source, Hull);
+    ReportPtr->Seconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - Start).count();
+    ReportPtr->PointCount = IndexedModel<3>(*Source).Points.size();
+    ReportPtr->HullPointCount = IndexedModel<3>(Hull).Points.size();
+    ReportPtr->HullFaceCount = Hull.Faces.size();
+    MassProperties Mass = MassIntegrator().Integrate(Hull);
+    ReportPtr->Area = Mass.SurfaceArea;
+    ReportPtr->Volume = Mass.SignedVolume;
+    return ExportModel(Path, Hull, false);
+}
+
+/*******************************************************************************
+【函数名称】 BenchmarkConvexHull
+【函数功能】 生成固定种子的随机点云（立方体内、球内均匀分布，以及点数为十分之一的
+球面分布，球面上的点全部是凸包顶点），分别用单线程与多线程求凸包并计时
+【参数】 
+    - std::size_t PointCount（输入参数）：点数
+    - std::vector<HullBenchmark>* ResultsPtr（输出参数）：各点云的测评结果
+【返回值】 Result：操作结果
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+Controller::Result Controller::BenchmarkConvexHull(std::size_t PointCount,
+    std::vector<HullBenchmark>* ResultsPtr) const {
+    ResultsPtr->clear();
+    std::mt19937_64 Random(20261018);
+    std::uniform_real_distribution<double> Uniform(-1, 1);
+    std::normal_distribution<double> Normal;
+    //Kind为0：立方体内；1：球内；2：球面
+    auto Generate = [&](int Kind, std::size_t Count) {
+        std::vector<std::array<double, 3>> Points(Count);
+        for (auto& P: Points) {
+            if (Kind == 0) {
+                P = { Uniform(Random), Uniform(Random), Uniform(Random) };
+                continue;
+            }
+            P = { Normal(Random), Normal(Random), Normal(Random) };
+            double Length = std::sqrt(P[0] * P[0] + P[1] * P[1] + P[2] * P[2]);
+            double Radius = Kind == 1
+                ? std::cbrt((Uniform(Random) + 1) / 2) : 1;
+            for (double& X: P) {
+                X *= Radius / Length;
+            }
+        }
+        return Points;
+    };
+    const char* Names[3] = { "cube", "ball", "sphere" };
+    HullBuilder Serial(1);
+    HullBuilder Parallel;
+    for (int Kind = 0; Kind < 3; Kind++) {
+        HullBenchmark Entry;
+        Entry.Cloud = Names[Kind];
+        Entry.PointCount = Kind == 2 ? PointCount / 10 : PointCount;
+        Entry.WorkerCount = Parallel.WorkerCount;
+        auto Points = Generate(Kind, Entry.PointCount);
+        auto Start = std::chrono::steady_clock::now();
+        ConvexHull Hull = Serial.Build(Points);
+        auto Middle = std::chrono::steady_clock::now();
+        Parallel.Build(Points);
+        auto End = std::chrono::steady_clock::now();
+        Entry.HullPointCount = Hull.Points.size();
+        Entry.SerialSeconds =
+            std::chrono::duration<double>(Middle - Start).count();
+        Entry.ParallelSeconds =
+            std::chrono::duration<double>(End - Middle).count();
+        ResultsPtr->push_back(Entry);
+    }
+    return Result::R_OK;
+}
+
+/*******************************************************************************
+【函数名称】 ExportDistanceField
+【函数功能】 求当前模型的窄带有向距离场并计时，保存为.raw体数据，同时写出同名的
+.nhdr说明文件；模型没有面时不保存，报告中的格点数全为0
+【参数】 
+    - std::string Path（输入参数）：字符串，.raw文件路径
+    - std::size_t Resolution（输入参数）：最长轴上的格点数
+    - double BandVoxels（输入参数）：窄带宽度，以格点间距为单位
+    - FieldReport* ReportPtr（输出参数）：距离场的信息
+【返回值】 Result：操作结果
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+Controller::Result Controller::ExportDistanceField(std::string Path,
+    std::size_t Resolution, double BandVoxels, FieldReport* ReportPtr) const {
+    auto Start = std::chrono::steady_clock::now();
+    DistanceField Field = Voxelizer().Build(m_Model, Resolution, BandVoxels);
+    ReportPtr->Seconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - Start).count();
+    ReportPtr->BrickCount = Field.BrickOffsets.size();
+    ReportPtr->StoredBrickCount = Field.GetStoredBrickCount();
+    ReportPtr->MemoryBytes = Field.Values.size() * sizeof(float)
+        + Field.BrickValues.size() * sizeof(float)
+        + Field.BrickOffsets.size() * sizeof(std::size_t);
+    ReportPtr->Spacing = Field.Spacing;
+    ReportPtr->BandWidth = Field.BandWidth;
+    for (std::size_t i = 0; i < 3; i++) {
+        ReportPtr->Size[i] = Field.Size[i];
+    }
+    if (Field.Size[0] == 0) {
+        return Result::R_OK;
+    }
+    try {
+        VolumeExporter().Export(Path, Field);
+    }
+    catch (ExceptionFileExtension) {
+        return Result::R_FILE_EXTENSION_ERROR;
+    }
+    catch (ExceptionFileOpen) {
+        return Result::R_FILE_OPEN_ERROR;
+    }
+    return Result::R_OK;
+}
+
+/*******************************************************************************
+【函数名称】 FindSelfIntersections
+【函数功能】 求当前模型中互相穿插的面对，共用顶点的相邻面只在折叠重叠或对边穿过
+时才算穿插
+【参数】 
+    - std::vector<std::pair<std::size_t, std::size_t>>* PairsPtr（输出参数）：
+    穿插的面对，面的序号（ID减1）从0开始，每对中较小的在前，按序号升序排列
+【返回值】 Result：操作结果
+Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 把存储位置换算为面的序号
+*******************************************************************************/
+Controller::Result Controller::FindSelfIntersections(
+    std::vector<std::pair<std::size_t, std::size_t>>* PairsPtr) const {
+    *PairsPtr = IntersectionFinder().FindSelf(m_Model);
+    std::vector<std::size_t> Indices = m_Model.GetFaceIndicesBySlot();
+    for (auto& Pair : *PairsPtr) {
+        Pair = std::minmax(Indices[Pair.first], Indices[Pair.second]);
+    }
+    std::sort(PairsPtr->begin(), PairsPtr->end());
+    return Result::R_OK;
+}
+
+/*******************************************************************************
+【函数名称】 FindIntersectionsWith
+【函数功能】 按当前的导入设置读入另一个模型（不替换当前模型），求两者之间相交
+（含接触）的面对
+【参数】 
+    - std::string Path（输入参数）：字符串，另一个模型的文件路径
+    - std::vector<std::pair<std::size_t, std::size_t>>* PairsPtr（输出参数）：
+    相交的面对，依次为当前模型与另一个模型中面的序号，从0开始，按序号升序排列
+【返回值】 Result：操作结果，读入失败时为相应的错误
+Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 把当前模型中面的存储位置换算为序号
+*******************************************************************************/
+Controller::Result Controller::FindIntersectionsWith(std::string Path,
+    std::vector<std::pair<std::size_t, std::size_t>>* PairsPtr) const {
+    Model3D Other;
+    auto Result = ImportModel(Path, Other, nullptr, m_WeldOnImport);
+    if (Result != Result::R_OK) {
+        return Result;
+    }
+    *PairsPtr = IntersectionFinder().FindBetween(m_Model, Other);
+    std::vector<std::size_t> Indices = m_Model.GetFaceIndicesBySlot();
+    for (auto& Pair : *PairsPtr) {
+        Pair.first = Indices[Pair.first];
+    }//另一个模型刚刚读入，存储位置即序号
+    std::sort(PairsPtr->begin(), PairsPtr->end());
+    return Result::R_OK;
+}
+
+/*******************************************************************************
+【函数名称】 ClassifyPoints
+【函数功能】 批量判断点是否在当前模型的内部
+【参数】 
+    - const std::vector<double>& Coordinates（输入参数）：依次为各点的x、y、z
+    坐标
+    - std::vector<std::uint64_t>* MaskPtr（输出参数）：位掩码，第i个点在内部时
+    第i / 64个字的第i % 64位为1
+【返回值】 Result：操作结果
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+Controller::Result Controller::ClassifyPoints(
+    const std::vector<double>& Coordinates,
+    std::vector<std::uint64_t>* MaskPtr) const {
+    *MaskPtr = ContainmentTester().Classify(m_Model, Coordinates);
+    return Result::R_OK;
+}
+
+/*******************************************************************************
+【函数名称】 ClassifyPointsFrom
+【函数功能】 从文本文件读入点的坐标，再批量判断它们是否在当前模型的内部
+【参数】 
+    - std::string Path（输入参数）：字符串，点文件的路径
+    - std::vector<double>* CoordinatesPtr（输出参数）：读入的各点坐标
+    - std::vector<std::uint64_t>* MaskPtr（输出参数）：位掩码
+【返回值】 Result：操作结果，无法打开文件时为R_FILE_OPEN_ERROR，格式错误时为
+R_FILE_FORMAT_ERROR
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+Controller::Result Controller::ClassifyPointsFrom(std::string Path,
+    std::vector<double>* CoordinatesPtr,
+    std::vector<std::uint64_t>* MaskPtr) const {
+    try {
+        *CoordinatesPtr = PointListImporter().Import(Path);
+    }
+    catch (ExceptionFileOpen) {
+        return Result::R_FILE_OPEN_ERROR;
+    }
+    catch (ExceptionFileFormat) {
+        return Result::R_FILE_FORMAT_ERROR;
+    }
+    return ClassifyPoints(*CoordinatesPtr, MaskPtr);
+}
+
+/*******************************************************************************
+【函数名称】 FindLineFaceHits
+【函数功能】 求当前模型中各条线穿过的面，线段整个落在面所在平面内的不算
+【参数】 
+    - std::vector<IntersectionFinder::LineHit>* HitsPtr（输出参数）：交点，
+    按线的序号、参数、面的序号排列，序号（ID减1）从0开始
+【返回值】 Result：操作结果
+Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 把线和面的存储位置换算为序号
+*******************************************************************************/
+Controller::Result Controller::FindLineFaceHits(
+    std::vector<IntersectionFinder::LineHit>* HitsPtr) const {
+    *HitsPtr = IntersectionFinder().FindLineHits(m_Model);
+    std::vector<std::size_t> Lines = m_Model.GetLineIndicesBySlot();
+    std::vector<std::size_t> Faces = m_Model.GetFaceIndicesBySlot();
+    for (auto& Hit : *HitsPtr) {
+        Hit.Line = Lines[Hit.Line];
+        Hit.Face = Faces[Hit.Face];
+    }
+    std::sort(HitsPtr->begin(), HitsPtr->end(),
+        [](const IntersectionFinder::LineHit& Left,
+            const IntersectionFinder::LineHit& Right) {
+            if (Left.Line != Right.Line) {
+                return Left.Line < Right.Line;
+            }
+            if (Left.Parameter != Right.Parameter) {
+                return Left.Parameter < Right.Parameter;
+            }
+            return Left.Face < Right.Face;
+        });
+    return Result::R_OK;
+}
+
+/*******************************************************************************
+【函数名称】 SubdivideModel
+【函数功能】 用Loop细分规则把当前模型细分Levels级，重合的点先被焊接；所有元素都被
+替换，完成后关闭编辑日志，由用户决定是否保存
+【参数】 
+    - std::size_t Levels（输入参数）：细分的级数
+    - SubdivisionReport* ReportPtr（输出参数）：细分结果
+【返回值】 Result：操作结果
+Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 不再自动写回模型文件
+*******************************************************************************/
+Controller::Result Controller::SubdivideModel(std::size_t Levels,
+    SubdivisionReport* ReportPtr) {
+    *ReportPtr = LoopSubdivider().Subdivide(m_Model, Levels, m_Model);
+    DetachJournal();
+    return Result::R_OK;
+}
+
+/*******************************************************************************
+【函数名称】 SmoothModel
+【函数功能】 用Taubin方法把当前模型光顺Iterations次，重合的点被移到同一位置；
+所有点都可能移动，完成后关闭编辑日志，由用户决定是否保存
+【参数】 
+    - std::size_t Iterations（输入参数）：迭代次数
+    - SmoothingReport* ReportPtr（输出参数）：光顺结果
+【返回值】 Result：操作结果
+Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 不再自动写回模型文件
+*******************************************************************************/
+Controller::Result Controller::SmoothModel(std::size_t Iterations,
+    SmoothingReport* ReportPtr) {
+    *ReportPtr = MeshSmoother().Smooth(m_Model, Iterations);
+    DetachJournal();
+    return Result::R_OK;
+}
+
+/*******************************************************************************
+【函数名称】 AnalyzeQuality
+【函数功能】 并行分析当前模型各个面的形状
+【参数】 
+    - const QualityThresholds& Thresholds（输入参数）：判定劣质面的阈值
+    - QualityReport* ReportPtr（输出参数）：分析结果，FlaggedFaces为面的序号
+    （ID减1），升序
+【返回值】 Result：操作结果
+Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 把FlaggedFaces中面的存储位置换算为序号
+*******************************************************************************/
+Controller::Result Controller::AnalyzeQuality(
+    const QualityThresholds& Thresholds, QualityReport* ReportPtr) const {
+    *ReportPtr = QualityAnalyzer().Analyze(m_Model, Thresholds);
+    std::vector<std::size_t> Indices = m_Model.GetFaceIndicesBySlot();
+    for (std::size_t& Face : ReportPtr->FlaggedFaces) {
+        Face = Indices[Face];
+    }
+    std::sort(ReportPtr->FlaggedFaces.begin(),
+        ReportPtr->FlaggedFaces.end());
+    return Result::R_OK;
+}
+
+/*******************************************************************************
+【函数名称】 TransformModel
+【函数功能】 对当前模型的所有点施加仿射矩阵，面属性缓存随之换算；线性部分不可逆
+（行列式为0或不是有限值）时会使不同的点重合，拒绝变换。所有点都被移动，
+完成后关闭编辑日志，由用户决定是否保存
+【参数】 
+    - const std::array<double, 16>& Matrix（输入参数）：4×4仿射矩阵，按行存放，
+    最后一行不被读取
+    - TransformReport* ReportPtr（输出参数）：变换结果
+【返回值】 Result：操作结果，矩阵不可逆时返回R_SINGULAR_TRANSFORM
+Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 不再自动写回模型文件
+*******************************************************************************/
+Controller::Result Controller::TransformModel(
+    const std::array<double, 16>& Matrix, TransformReport* ReportPtr) {
+    for (std::size_t i = 0; i < 12; i++) {
+        if (!std::isfinite(Matrix[i])) {
+            return Result::R_SINGULAR_TRANSFORM;
+        }
+    }
+    double Determinant = AffineTransformer::Determinant(Matrix);
+    if (!std::isfinite(Determinant) || Determinant == 0) {
+        return Result::R_SINGULAR_TRANSFORM;
+    }
+    *ReportPtr = AffineTransformer().Transform(m_Model, Matrix);
+    DetachJournal();
+    return Result::R_OK;
+}
+
+/*******************************************************************************
+【函数名称】 TranslateModel
+【函数功能】 平移当前模型
+【参数】 
+    - double X（输入参数）：x方向的平移量
+    - double Y（输入参数）：y方向的平移量
+    - double Z（输入参数）：z方向的平移量
+    - TransformReport* ReportPtr（输出参数）：变换结果
+【返回值】 Result：操作结果
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+Controller::Result Controller::TranslateModel(double X, double Y, double Z,
+    TransformReport* ReportPtr) {
+    return TransformModel(AffineTransformer::Translation(X, Y, Z), ReportPtr);
+}
+
+/*******************************************************************************
+【函数名称】 RotateModel
+【函数功能】 绕坐标轴旋转当前模型
+【参数】 
+    - std::size_t Axis（输入参数）：旋转轴，0、1、2分别为x、y、z轴
+    - double Degrees（输入参数）：旋转角（度），从轴的正方向看为逆时针
+    - TransformReport* ReportPtr（输出参数）：变换结果
+【返回值】 Result：操作结果
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+Controller::Result Controller::RotateModel(std::size_t Axis, double Degrees,
+    TransformReport* ReportPtr) {
+    return TransformModel(AffineTransformer::Rotation(Axis, Degrees),
+        ReportPtr);
+}
+
+/*******************************************************************************
+【函数名称】 ScaleModel
+【函数功能】 沿坐标轴缩放当前模型，倍数为负时沿该轴镜像
+【参数】 
+    - double X（输入参数）：x方向的倍数
+    - double Y（输入参数）：y方向的倍数
+    - double Z（输入参数）：z方向的倍数
+    - TransformReport* ReportPtr（输出参数）：变换结果
+【返回值】 Result：操作结果，有倍数为0时返回R_SINGULAR_TRANSFORM
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+Controller::Result Controller::ScaleModel(double X, double Y, double Z,
+    TransformReport* ReportPtr) {
+    return TransformModel(AffineTransformer::Scaling(X, Y, Z), ReportPtr);
+}
+
+/*******************************************************************************
+【函数名称】 FindGeodesicPath
+【函数功能】 在当前模型的面的边上求离From与To最近的两个顶点之间的最短路径，
+把路径的各段作为线加入模型；加入的线与AddLine一样逐条写入编辑日志
+【参数】 
+    - const double* From（输入参数）：起点位置的x、y、z坐标
+    - const double* To（输入参数）：终点位置的x、y、z坐标
+    - GeodesicPath* PathPtr（输出参数）：最短路径，不可达时顶点为空
+    - std::size_t* AddedLinesPtr（输出参数）：加入的线数
+【返回值】 Result：操作结果，模型没有点时返回R_ID_OUT_OF_BOUNDS
+Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 加入的线改为写入编辑日志，不再自动写回模型文件
+*******************************************************************************/
+Controller::Result Controller::FindGeodesicPath(const double* From,
+    const double* To, GeodesicPath* PathPtr, std::size_t* AddedLinesPtr) {
+    GeodesicSolver Solver(m_Model);
+    if (Solver.GetVertexCount() == 0) {
+        return Result::R_ID_OUT_OF_BOUNDS;
+    }
+    *PathPtr = Solver.FindPath(Solver.NearestVertex(From),
+        Solver.NearestVertex(To));
+    *AddedLinesPtr = Solver.AddPathLines(*PathPtr, m_Model);
+    for (std::size_t i = m_Model.Lines.size() - *AddedLinesPtr;
+        i < m_Model.Lines.size(); i++) {
+        auto Points = m_Model.Lines[i]->GetPointsVector();
+        EditJournal::Record Entry = {};
+        Entry.Op = EditJournal::Operation::ADD_LINE;
+        for (std::size_t j = 0; j < 3; j++) {
+            Entry.Coordinates[j] = (*Points[0])[j];
+            Entry.Coordinates[3 + j] = (*Points[1])[j];
+        }
+        AppendToJournal(Entry);
+    }//新线都在末尾，重放AddLine得到相同的编号
+    return Result::R_OK;
+}
+
+/*******************************************************************************
+【函数名称】 GeodesicDistances
+【函数功能】 在当前模型的面的边上求各顶点到离From最近的顶点的最短距离
+【参数】 
+    - const double* From（输入参数）：源位置的x、y、z坐标
+    - std::vector<double>* PositionsPtr（输出参数）：各顶点的x、y、z坐标，
+    重合的点只出现一次
+    - std::vector<double>* DistancesPtr（输出参数）：各顶点的距离，
+    不可达时为无穷大
+【返回值】 Result：操作结果，模型没有点时返回R_ID_OUT_OF_BOUNDS
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+Controller::Result Controller::GeodesicDistances(const double* From,
+    std::vector<double>* PositionsPtr,
+    std::vector<double>* DistancesPtr) const {
+    GeodesicSolver Solver(m_Model);
+    if (Solver.GetVertexCount() == 0) {
+        return Result::R_ID_OUT_OF_BOUNDS;
+    }
+    *DistancesPtr = Solver.DistancesFrom(Solver.NearestVertex(From));
+    *PositionsPtr = Solver.Positions;
+    return Result::R_OK;
+}
+
+/*******************************************************************************
+【函数名称】 AttachJournal
+【函数功能】 打开模型文件旁的编辑日志，按顺序重放其中尚未并入模型文件的记录；
+记录过多时随即做一次检查点
+【参数】 
+    - const std::string& Path（输入参数）：字符串，模型文件路径
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 记录模型文件路径，清除未保存标记
+*******************************************************************************/
+void Controller::AttachJournal(const std::string& Path) {
+    m_Journal.reset(new EditJournal(Path));
+    m_ModelPath = Path;
+    m_HasUnsavedChanges = false;
+    m_ReplayedEdits = 0;
+    m_IsReplaying = true;
+    for (const auto& Entry: m_Journal->PendingRecords) {
+        if (ApplyRecord(Entry) == Result::R_OK) {
+            m_ReplayedEdits++;
+        }
+    }
+    m_IsReplaying = false;
+    if (m_Journal->GetRecordCount() >= CheckpointInterval) {
+        Checkpoint();
+    }
+}
+
+/*******************************************************************************
+【函数名称】 ApplyRecord
+【函数功能】 通过对应的编辑接口重放一条日志记录
+【参数】 
+    - const EditJournal::Record& Entry（输入参数）：日志记录
+【返回值】 Result：编辑接口的操作结果
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+Controller::Result Controller::ApplyRecord(const EditJournal::Record& Entry) {
+    const double* C = Entry.Coordinates;
+    switch (Entry.Op) {
+        case EditJournal::Operation::ADD_LINE : {
+            return AddLine(C[0], C[1], C[2], C[3], C[4], C[5]);
+        }
+        case EditJournal::Operation::ADD_FACE : {
+            return AddFace(
+                C[0], C[1], C[2], C[3], C[4], C[5], C[6], C[7], C[8]);
+        }
+        case EditJournal::Operation::MODIFY_LINE : {
+            return ModifyLine(Entry.ID, Entry.PointIndex, C[0], C[1], C[2]);
+        }
+        case EditJournal::Operation::MODIFY_FACE : {
+            return ModifyFace(Entry.ID, Entry.PointIndex, C[0], C[1], C[2]);
+        }
+        case EditJournal::Operation::REMOVE_LINE : {
+            return RemoveLineById(Entry.ID);
+        }
+        case EditJournal::Operation::REMOVE_FACE : {
+            return RemoveFaceById(Entry.ID);
+        }
+        case EditJournal::Operation::CHECKPOINT : {
+            break;
+        }//保存标记不会出现在待重放的记录中
+    }
+    return Result::R_FILE_FORMAT_ERROR;
+}
+
+/*******************************************************************************
+【函数名称】 AppendToJournal
+【函数功能】 编辑成功后把记录追加到日志；重放期间不追加；记录数达到
+CheckpointInterval时做一次检查点。日志无法写入时改为完整写回模型文件，
+也失败时关闭日志并标记为有未保存的修改
+【参数】 
+    - const EditJournal::Record& Entry（输入参数）：日志记录
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 日志与模型文件都无法写入时关闭日志，不再忽略检查点的失败
+*******************************************************************************/
+void Controller::AppendToJournal(const EditJournal::Record& Entry) {
+    if (m_IsReplaying) {
+        return;
+    }
+    m_EditCount++;
+    if (!m_Journal) {
+        return;
+    }
+    if (!m_Journal->Append(Entry)) {
+        if (Checkpoint() != Result::R_OK) {
+            DetachJournal();
+        }
+        return;
+    }
+    if (m_Journal->GetRecordCount() >= CheckpointInterval) {
+        Checkpoint();
+    }//失败时日志仍完整，下一条记录会再次尝试
+}
+
+/*******************************************************************************
+【函数名称】 DetachJournal
+【函数功能】 模型有了无法写入日志的修改（如批量修改）后调用：关闭日志，磁盘上的
+日志与模型文件仍描述修改之前的状态；模型被标记为有未保存的修改，直到Checkpoint
+或保存到模型文件后重新打开日志
+【参数】 无
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+void Controller::DetachJournal() {
+    m_Journal.reset();
+    m_HasUnsavedChanges = !m_ModelPath.empty();
+    m_EditCount++;
+}
@@ -2,18 +2,70 @@
 【文件名】 Controller.hpp
 【功能模块和目的】 实现Controller类，提供对模型的操作
  Created by 朱昊东 on 2024/7/28
-【更改记录】 无
+【更改记录】 
+    2026/10/18
+    - 增添了压缩模型格式的测评接口BenchmarkCompression
+    - 增添了后台异步加载模型的接口
+    - 增添了按需读取.obj文件的惰性模式接口
+    - 增添了焊接重合点的接口
+    - 增添了后台保存模型快照的接口
+    - 增添了编辑日志与检查点接口
+    - 增添了简化模型的接口
+    - 增添了顶点缓存优化的接口
+    - 增添了按Morton码空间重排的接口
+    - 增添了连通部分的统计与分别导出接口
+    - 增添了获取面属性缓存的接口
+    - 统计信息增添了体积、质心与惯性张量
+    - 统计信息增添了有向包围盒
+    - 增添了凸包的导出与测评接口
+    - 增添了有向距离场的导出接口
+    - 增添了自相交与模型间相交的检测接口
+    - 增添了批量判断点是否在模型内部的接口
+    - 增添了线与面的相交检测接口
+    - 增添了Loop细分的接口
+    - 增添了Taubin光顺的接口
+    - 增添了面质量分析的接口
+    - 增添了仿射变换的接口
+    - 增添了测地最短路径的接口
+    - 质量属性与有向包围盒从统计信息中移出，改为单独的接口
+    - 空间重排后线和面的ID经模型中的映射保持不变
 *******************************************************************************/
 #ifndef CONTROLLER_HPP
 #define CONTROLLER_HPP
 
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <future>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
+#include "../Exporter&Importer/EditJournal.hpp"
+#include "../Exporter&Importer/ImportProgress.hpp"
 #include "../Models/Line.hpp"
 #include "../Models/Face.hpp"
 #include "../Models/Model.hpp"
 #include "../Models/Point.hpp"
+#include "../Models/PointWelder.hpp"
+#include "../Algorithms/AffineTransformer.hpp"
+#include "../Algorithms/BoxFitter.hpp"
+#include "../Algorithms/ComponentLabeler.hpp"
+#include "../Algorithms/ContainmentTester.hpp"
+#include "../Algorithms/ConvexHull.hpp"
+#include "../Algorithms/GeodesicSolver.hpp"
+#include "../Algorithms/IntersectionFinder.hpp"
+#include "../Algorithms/LoopSubdivider.hpp"
+#include "../Algorithms/MassIntegrator.hpp"
+#include "../Algorithms/MeshSimplifier.hpp"
+#include "../Algorithms/MeshSmoother.hpp"
+#include "../Algorithms/MortonReorderer.hpp"
+#include "../Algorithms/QualityAnalyzer.hpp"
+#include "../Algorithms/VertexCacheOptimizer.hpp"
+#include "../Algorithms/Voxelizer.hpp"
+
+class LazyObjFile;
 
 using Line3D = Line<3>;
 using Face3D = Face<3>;
@@ -28,12 +80,44 @@ using Point3D = Point<3>;
         获取Controller实例（单例模式）
     - Result LoadModel(std::string Path)
         加载模型
+    - Result LoadModelAsync(std::string Path,
+        std::shared_ptr<LoadTask>* TaskPtr)
+        在后台线程加载模型，加载期间当前模型保持可用
+    - bool CollectLoadedModel(Result* ResultPtr,
+        bool IsDiscardingChanges = false)
+        若后台加载已结束，收取结果并以新模型替换当前模型；当前模型有未保存的
+        修改时，除非IsDiscardingChanges为true，否则不替换
+    - bool DiscardLoadedModel()
+        放弃已结束的后台加载，保留当前模型
+    - std::shared_ptr<LoadTask> GetPendingLoad() const
+        获取正在进行的后台加载任务，没有时返回空指针
+    - Result OpenModelLazy(std::string Path)
+        以惰性模式打开.obj文件，只建立偏移索引，不读入元素
+    - const LazyObjFile* GetLazyModel() const
+        获取惰性模式打开的文件，没有时返回空指针
+    - Result GetLazyFaces(std::size_t FirstID, std::size_t Count,
+        std::vector<std::shared_ptr<Face3D>>* FacesPtr)
+        按需读取惰性模式文件中从FirstID开始的Count个面
+    - Result GetLazyFacePointsById(std::size_t ID,
+        std::vector<std::shared_ptr<Point3D>>* PointsPtr)
+        按需读取惰性模式文件中指定面的点集合
     - Result SaveModel(std::string Path) const
         保存模型
-    - const std::vector<std::shared_ptr<Line3D>>& GetLines() const
-        获取线集合
-    - const std::vector<std::shared_ptr<Face3D>>& GetFaces() const
-        获取面集合
+    - Result SaveModelAsync(std::string Path,
+        std::shared_ptr<SaveTask>* TaskPtr)
+        拷贝当前模型的快照并在后台线程保存，保存期间可继续编辑
+    - bool CollectSavedModel(Result* ResultPtr)
+        若后台保存已结束，收取其结果
+    - std::shared_ptr<SaveTask> GetPendingSave() const
+        获取正在进行的后台保存任务，没有时返回空指针
+    - std::vector<std::shared_ptr<Line3D>> GetLines() const
+        获取按ID排列的线集合
+    - std::vector<std::shared_ptr<Face3D>> GetFaces() const
+        获取按ID排列的面集合
+    - const FaceAttributeCache<3>& GetFaceAttributes() const
+        获取按存储顺序与面一一对应的面属性缓存（法向、面积、包围盒）
+    - std::size_t GetFaceSlotById(std::size_t ID) const
+        获取面在面属性缓存中的位置
     - Result GetLinePointsById(std::size_t ID,
                         std::vector<std::shared_ptr<Point3D>>* PointsPtr) const
         获取线的点集合
@@ -61,10 +145,136 @@ using Point3D = Point<3>;
         修改面
     - Statistics GetStatistics() const
         获取统计信息
+    - Result GetShapeProperties(ShapeProperties* PropertiesPtr) const
+        求质量属性与有向包围盒，需要求凸包，耗时较长
+    - Result BenchmarkCompression(std::string Path,
+        CompressionReport* ReportPtr) const
+        以.cmf格式保存并重新读入模型，测量压缩率与编解码吞吐量
+    - Result WeldPoints(WeldReport* ReportPtr)
+        合并当前模型中相距在容差以内的点
+    - void SetWeldOnImport(bool WeldOnImport)
+        设置加载后是否自动焊接
+    - void SetWeldOnExport(bool WeldOnExport)
+        设置保存时是否焊接
+    - bool IsWeldingOnImport() const
+        加载后是否自动焊接
+    - bool IsWeldingOnExport() const
+        保存时是否焊接
+    - static constexpr std::size_t CheckpointInterval
+        日志累积到这么多条记录时自动做一次检查点
+    - Result Checkpoint()
+        把当前模型完整写回模型文件并清空编辑日志
+    - bool HasUnsavedChanges() const
+        是否有既不在模型文件中、也不在编辑日志中的修改（批量修改之后）
+    - std::size_t GetJournalLength() const
+        编辑日志中尚未并入模型文件的记录数
+    - std::size_t GetReplayedEditCount() const
+        最近一次加载模型时从日志重放的编辑数
+    - Result SimplifyModel(std::size_t TargetFaceCount, double MaxError,
+        SimplifyReport* ReportPtr)
+        用二次误差边折叠把模型简化到目标面数或误差上限
+    - Result OptimizeVertexCache(CacheReport* ReportPtr) const
+        测量按顶点缓存优化的顺序导出时的ACMR，当前模型不变
+    - void SetOptimizeOnExport(bool OptimizeOnExport)
+        设置保存到其他文件时是否按顶点缓存优化面的顺序
+    - bool IsOptimizingOnExport() const
+        保存到其他文件时是否优化面的顺序
+    - Result ReorderSpatially(LocalityReport* ReportPtr)
+        按Morton码重排模型的存储，并测量重排前后遍历的耗时
+    - Result LabelComponents(std::vector<ComponentInfo>* ComponentsPtr) const
+        把模型划分为互不相连的部分并统计各部分的信息
+    - Result ExportComponents(std::string Path, std::size_t* CountPtr) const
+        把每个部分分别保存到"<文件名>_<编号><扩展名>"中
+    - Result ExportConvexHull(std::string Path, std::size_t Component,
+        HullReport* ReportPtr) const
+        求模型或其中一个连通部分的凸包并保存
+    - Result BenchmarkConvexHull(std::size_t PointCount,
+        std::vector<HullBenchmark>* ResultsPtr) const
+        在随机点云上比较单线程与多线程求凸包的耗时
+    - Result ExportDistanceField(std::string Path, std::size_t Resolution,
+        double BandVoxels, FieldReport* ReportPtr) const
+        求模型的窄带有向距离场并保存为.raw体数据与.nhdr说明文件
+    - Result FindSelfIntersections(
+        std::vector<std::pair<std::size_t, std::size_t>>* PairsPtr) const
+        求模型中互相穿插的面对
+    - Result FindIntersectionsWith(std::string Path,
+        std::vector<std::pair<std::size_t, std::size_t>>* PairsPtr) const
+        读入另一个模型，求当前模型与它之间相交的面对
+    - Result ClassifyPoints(const std::vector<double>& Coordinates,
+        std::vector<std::uint64_t>* MaskPtr) const
+        批量判断点是否在模型内部，结果为位掩码
+    - Result ClassifyPointsFrom(std::string Path,
+        std::vector<double>* CoordinatesPtr,
+        std::vector<std::uint64_t>* MaskPtr) const
+        从文本文件读入点，判断它们是否在模型内部
+    - Result FindLineFaceHits(
+        std::vector<IntersectionFinder::LineHit>* HitsPtr) const
+        求模型中各条线穿过的面与交点的参数
+    - Result SubdivideModel(std::size_t Levels, SubdivisionReport* ReportPtr)
+        用Loop细分规则把模型细分若干级
+    - Result SmoothModel(std::size_t Iterations, SmoothingReport* ReportPtr)
+        用Taubin方法光顺模型，点的共享关系不变
+    - Result AnalyzeQuality(const QualityThresholds& Thresholds,
+        QualityReport* ReportPtr) const
+        统计面的内角与长宽比，找出退化与超出阈值的面
+    - Result TransformModel(const std::array<double, 16>& Matrix,
+        TransformReport* ReportPtr)
+        对模型的所有点施加4×4仿射矩阵，点的共享关系不变
+    - Result TranslateModel(double X, double Y, double Z,
+        TransformReport* ReportPtr)
+        平移模型
+    - Result RotateModel(std::size_t Axis, double Degrees,
+        TransformReport* ReportPtr)
+        绕坐标轴旋转模型
+    - Result ScaleModel(double X, double Y, double Z,
+        TransformReport* ReportPtr)
+        沿坐标轴缩放模型
+    - Result FindGeodesicPath(const double* From, const double* To,
+        GeodesicPath* PathPtr, std::size_t* AddedLinesPtr)
+        沿网格的边求离两个位置最近的顶点之间的最短路径，并作为线加入模型
+    - Result GeodesicDistances(const double* From,
+        std::vector<double>* PositionsPtr,
+        std::vector<double>* DistancesPtr) const
+        沿网格的边求各顶点到离给定位置最近的顶点的最短距离
  Created by 朱昊东 on 2024/7/27
 【更改记录】 
         2024/8/17
         - 修改了一些缩进问题
+        2026/10/18
+        - 增添了BenchmarkCompression，LoadModel与SaveModel按扩展名选择格式
+        - 增添了LoadModelAsync、CollectLoadedModel与GetPendingLoad
+        - 增添了OpenModelLazy、GetLazyModel、GetLazyFaces与
+        GetLazyFacePointsById
+        - 增添了WeldPoints、SetWeldOnImport、SetWeldOnExport、IsWeldingOnImport
+        与IsWeldingOnExport
+        - 增添了SaveModelAsync、CollectSavedModel与GetPendingSave
+        - 增添了Checkpoint、GetJournalLength与GetReplayedEditCount，
+        编辑操作成功后追加到编辑日志
+        - 增添了SimplifyModel
+        - 增添了OptimizeVertexCache
+        - 增添了LocalityReport与ReorderSpatially
+        - 增添了LabelComponents与ExportComponents
+        - 增添了GetFaceAttributes
+        - Statistics增添了Mass
+        - Statistics增添了OrientedBoxes
+        - 增添了HullReport、HullBenchmark、ExportConvexHull与
+        BenchmarkConvexHull
+        - 增添了FieldReport与ExportDistanceField
+        - 增添了FindSelfIntersections与FindIntersectionsWith
+        - 增添了ClassifyPoints与ClassifyPointsFrom
+        - 增添了FindLineFaceHits
+        - 增添了SubdivideModel
+        - 增添了SmoothModel
+        - 增添了AnalyzeQuality
+        - 增添了TransformModel、TranslateModel、RotateModel与ScaleModel
+        - 增添了FindGeodesicPath与GeodesicDistances
+        - 增添了HasUnsavedChanges，批量修改不再自动写回模型文件
+        - OptimizeVertexCache改为只测量，增添了SetOptimizeOnExport与
+        IsOptimizingOnExport，优化只作用于导出的文件
+        - Statistics中的Mass与OrientedBoxes移至ShapeProperties，
+        增添了GetShapeProperties
+        - GetLines与GetFaces改为按ID排列，增添了GetFaceSlotById
+        - CollectLoadedModel不再覆盖未保存的修改，增添了DiscardLoadedModel
 *******************************************************************************/
 class Controller {
     public:
@@ -92,8 +302,20 @@ class Controller {
                 元素重复
             - R_POINT_INDEX_ERROR
                 点索引错误
+            - R_CANCELLED
+                操作被取消
+            - R_BUSY
+                已有同类后台任务在进行
+            - R_SINGULAR_TRANSFORM
+                变换矩阵不可逆
+            - R_UNSAVED_CHANGES
+                当前模型有未保存的修改
         Created by 朱昊东 on 2024/7/27
-        【更改记录】 无
+        【更改记录】 
+            2026/10/18
+            - 增添了R_CANCELLED与R_BUSY
+            - 增添了R_SINGULAR_TRANSFORM
+            - 增添了R_UNSAVED_CHANGES
         ***********************************************************************/
         enum class Result {
             R_OK,
@@ -104,6 +326,10 @@ class Controller {
             R_IDENTICAL_POINTS,
             R_IDENTICAL_ELEMENTS,
             R_POINT_INDEX_ERROR,
+            R_CANCELLED,
+            R_BUSY,
+            R_SINGULAR_TRANSFORM,
+            R_UNSAVED_CHANGES,
         };
 
         /***********************************************************************
@@ -123,7 +349,12 @@ class Controller {
             - double MinBoxVolume
                 最小包围盒体积
         Created by 朱昊东 on 2024/7/27
-        【更改记录】 无
+        【更改记录】 
+            2026/10/18
+            - 增添了Mass
+            - 增添了OrientedBoxes
+            - Mass与OrientedBoxes移至ShapeProperties，统计信息只包含
+            线性时间的计算
         ***********************************************************************/
         struct Statistics {
             std::size_t TotalPointCount;
@@ -133,14 +364,305 @@ class Controller {
             double TotalFaceArea;
             double MinBoxVolume;
         };
+
+        /***********************************************************************
+        【结构体名】 ShapeProperties
+        【功能】 结构体，表示模型的形状属性
+        【接口说明】
+            - MassProperties Mass
+                面所围的体积、质心与惯性张量
+            - BoxReport OrientedBoxes
+                主成分包围盒与最小体积有向包围盒
+        Created by 朱昊东 on 2026/10/18
+        【更改记录】 无
+        ***********************************************************************/
+        struct ShapeProperties {
+            MassProperties Mass;
+            BoxReport OrientedBoxes;
+        };
+
+        /***********************************************************************
+        【结构体名】 CompressionReport
+        【功能】 结构体，表示压缩格式的测评结果
+        【接口说明】
+            - std::size_t TriangleCount
+                三角面数
+            - std::size_t Bytes
+                压缩文件字节数
+            - double BytesPerTriangle
+                每个三角面平均占用的字节数
+            - double EncodeSeconds
+                编码并写入文件的耗时（秒）
+            - double DecodeSeconds
+                读入并解码文件的耗时（秒）
+            - bool IsWeldedRoundTripValid
+                开启焊接保存后能否读回，且线数和面数与焊接后的模型一致
+        Created by 朱昊东 on 2026/10/18
+        【更改记录】 
+            2026/10/18
+            - 增添了IsWeldedRoundTripValid
+        ***********************************************************************/
+        struct CompressionReport {
+            std::size_t TriangleCount;
+            std::size_t Bytes;
+            double BytesPerTriangle;
+            double EncodeSeconds;
+            double DecodeSeconds;
+            bool IsWeldedRoundTripValid;
+        };
+
+        /***********************************************************************
+        【结构体名】 LocalityReport
+        【功能】 结构体，表示空间重排的结果与重排前后遍历模型的耗时
+        【接口说明】
+            - std::size_t LineCount
+                线数
+            - std::size_t FaceCount
+                面数
+            - double StatisticsSecondsBefore
+                重排前计算统计信息的耗时（秒）
+            - double StatisticsSecondsAfter
+                重排后计算统计信息的耗时（秒）
+            - double IndexingSecondsBefore
+                重排前为模型建立点索引（导出与各算法的第一步）的耗时（秒）
+            - double IndexingSecondsAfter
+                重排后建立点索引的耗时（秒）
+            - bool IsKept
+                是否保留重排后的存储顺序；重排后没有变快时恢复原来的顺序
+        Created by 朱昊东 on 2026/10/18
+        【更改记录】 
+            2026/10/18
+            - 增添了IsKept
+        ***********************************************************************/
+        struct LocalityReport {
+            std::size_t LineCount;
+            std::size_t FaceCount;
+            double StatisticsSecondsBefore;
+            double StatisticsSecondsAfter;
+            double IndexingSecondsBefore;
+            double IndexingSecondsAfter;
+            bool IsKept;
+        };
+
+        /***********************************************************************
+        【结构体名】 HullReport
+        【功能】 结构体，表示一次求凸包的结果
+        【接口说明】
+            - std::size_t PointCount
+                参与计算的不同点数
+            - std::size_t HullPointCount
+                凸包的顶点数
+            - std::size_t HullFaceCount
+                凸包的面数
+            - double Area
+                凸包的表面积
+            - double Volume
+                凸包的体积
+            - double Seconds
+                求凸包的耗时（秒）
+        Created by 朱昊东 on 2026/10/18
+        【更改记录】 无
+        ***********************************************************************/
+        struct HullReport {
+            std::size_t PointCount;
+            std::size_t HullPointCount;
+            std::size_t HullFaceCount;
+            double Area;
+            double Volume;
+            double Seconds;
+        };
+
+        /***********************************************************************
+        【结构体名】 HullBenchmark
+        【功能】 结构体，表示在一种随机点云上求凸包的测评结果
+        【接口说明】
+            - std::string Cloud
+                点云的名称
+            - std::size_t PointCount
+                点数
+            - std::size_t HullPointCount
+                凸包的顶点数
+            - std::size_t WorkerCount
+                多线程求解使用的线程数
+            - double SerialSeconds
+                单线程求解的耗时（秒）
+            - double ParallelSeconds
+                多线程求解的耗时（秒）
+        Created by 朱昊东 on 2026/10/18
+        【更改记录】 无
+        ***********************************************************************/
+        struct HullBenchmark {
+            std::string Cloud;
+            std::size_t PointCount;
+            std::size_t HullPointCount;
+            std::size_t WorkerCount;
+            double SerialSeconds;
+            double ParallelSeconds;
+        };
+
+        /***********************************************************************
+        【结构体名】 FieldReport
+        【功能】 结构体，表示一次有向距离场计算的结果
+        【接口说明】
+            - std::size_t Size[3]
+                各轴的格点数，模型没有面时全为0
+            - double Spacing
+                格点间距
+            - double BandWidth
+                窄带宽度
+            - std::size_t BrickCount
+                块数
+            - std::size_t StoredBrickCount
+                存放全部格点值的块数
+            - std::size_t MemoryBytes
+                距离场占用的内存（字节）
+            - double Seconds
+                计算距离场的耗时（秒），不含保存
+        Created by 朱昊东 on 2026/10/18
+        【更改记录】 无
+        ***********************************************************************/
+        struct FieldReport {
+            std::size_t Size[3];
+            double Spacing;
+            double BandWidth;
+            std::size_t BrickCount;
+            std::size_t StoredBrickCount;
+            std::size_t MemoryBytes;
+            double Seconds;
+        };
+        /***********************************************************************
+        【类名】 LoadTask
+        【功能】 后台加载任务的句柄，可查询进度、请求取消或等待结束
+        【接口说明】
+            - const std::string& Path
+                正在加载的文件路径
+            - bool IsReady() const
+                加载是否已经结束（成功、失败或被取消）
+            - void Cancel()
+                请求取消加载，导入器会在下一个检查点退出
+            - const ImportProgress& GetProgress() const
+                获取加载进度
+            - void Wait() const
+                阻塞直到加载结束
+        Created by 朱昊东 on 2026/10/18
+        【更改记录】 无
+        ***********************************************************************/
+        class LoadTask {
+            public:
+                explicit LoadTask(const std::string& Path): m_Path(Path) {}
+                LoadTask(const LoadTask& Other) = delete;
+                LoadTask& operator=(const LoadTask& Other) = delete;
+
+                const std::string& Path { m_Path };
+
+                bool IsReady() const {
+                    return m_Future.wait_for(std::chrono::seconds(0))
+                        == std::future_status::ready;
+                }
+
+                void Cancel() {
+                    m_Progress.Cancel();
+                }
+
+                const ImportProgress& GetProgress() const {
+                    return m_Progress;
+                }
+
+                void Wait() const {
+                    m_Future.wait();
+                }
+
+            private:
+                friend class Controller;
+                std::string m_Path;
+                ImportProgress m_Progress;
+                Model3D m_Model;
+                std::future<Result> m_Future;
+        };
+
+        /***********************************************************************
+        【类名】 SaveTask
+        【功能】 后台保存任务的句柄，持有发起保存时模型的快照
+        【接口说明】
+            - const std::string& Path
+                正在保存的文件路径
+            - bool IsReady() const
+                保存是否已经结束
+            - void Wait() const
+                阻塞直到保存结束
+        Created by 朱昊东 on 2026/10/18
+        【更改记录】 
+            2026/10/18
+            - 记录保存到模型文件时日志的位置，用于保存完成后清理日志
+            - 记录发起保存时的日志对象与修改计数
+        ***********************************************************************/
+        class SaveTask {
+            public:
+                explicit SaveTask(const std::string& Path): m_Path(Path) {}
+                SaveTask(const SaveTask& Other) = delete;
+                SaveTask& operator=(const SaveTask& Other) = delete;
+
+                const std::string& Path { m_Path };
+
+                bool IsReady() const {
+                    return m_Future.wait_for(std::chrono::seconds(0))
+                        == std::future_status::ready;
+                }
+
+                void Wait() const {
+                    m_Future.wait();
+                }
+
+            private:
+                friend class Controller;
+                std::string m_Path;
+                Model3D m_Snapshot;
+                std::future<Result> m_Future;
+                std::shared_ptr<EditJournal> m_Journal;
+                std::uint64_t m_EditCount = 0;
+                std::uint64_t m_JournalSize = 0;
+                std::uint64_t m_JournalGeneration = 0;
+        };
+
         //加载模型
         Result LoadModel(std::string Path);
+        //在后台线程加载模型
+        Result LoadModelAsync(std::string Path,
+            std::shared_ptr<LoadTask>* TaskPtr);
+        //收取已结束的后台加载
+        bool CollectLoadedModel(Result* ResultPtr,
+            bool IsDiscardingChanges = false);
+        //放弃已结束的后台加载
+        bool DiscardLoadedModel();
+        //获取正在进行的后台加载任务
+        std::shared_ptr<LoadTask> GetPendingLoad() const;
+        //以惰性模式打开.obj文件
+        Result OpenModelLazy(std::string Path);
+        //获取惰性模式打开的文件
+        const LazyObjFile* GetLazyModel() const;
+        //按需读取惰性模式文件中的若干个面
+        Result GetLazyFaces(std::size_t FirstID, std::size_t Count,
+            std::vector<std::shared_ptr<Face3D>>* FacesPtr);
+        //按需读取惰性模式文件中指定面的点集合
+        Result GetLazyFacePointsById(std::size_t ID,
+            std::vector<std::shared_ptr<Point3D>>* PointsPtr);
         //保存模型
         Result SaveModel(std::string Path) const;
+        //在后台线程保存模型快照
+        Result SaveModelAsync(std::string Path,
+            std::shared_ptr<SaveTask>* TaskPtr);
+        //收取已结束的后台保存
+        bool CollectSavedModel(Result* ResultPtr);
+        //获取正在进行的后台保存任务
+        std::shared_ptr<SaveTask> GetPendingSave() const;
         //获取线集合
-        const std::vector<std::shared_ptr<Line3D>>& GetLines() const;
+        std::vector<std::shared_ptr<Line3D>> GetLines() const;
         //获取面集合
-        const std::vector<std::shared_ptr<Face3D>>& GetFaces() const;
+        std::vector<std::shared_ptr<Face3D>> GetFaces() const;
+        //获取面属性缓存
+        const FaceAttributeCache<3>& GetFaceAttributes() const;
+        //获取面在面属性缓存中的位置
+        std::size_t GetFaceSlotById(std::size_t ID) const;
         //获取指定线的点集合
         Result GetLinePointsById(std::size_t ID,
                     std::vector<std::shared_ptr<Point3D>>* PointsPtr) const;
@@ -168,10 +690,131 @@ class Controller {
             double X, double Y, double Z);
         //获取统计信息
         Statistics GetStatistics() const;
+        //求质量属性与有向包围盒
+        Result GetShapeProperties(ShapeProperties* PropertiesPtr) const;
+        //测评压缩格式
+        Result BenchmarkCompression(std::string Path,
+            CompressionReport* ReportPtr) const;
+        //焊接重合的点
+        Result WeldPoints(WeldReport* ReportPtr);
+        //设置加载后是否自动焊接
+        void SetWeldOnImport(bool WeldOnImport);
+        //设置保存时是否焊接
+        void SetWeldOnExport(bool WeldOnExport);
+        //加载后是否自动焊接
+        bool IsWeldingOnImport() const;
+        //保存时是否焊接
+        bool IsWeldingOnExport() const;
+        static constexpr std::size_t CheckpointInterval = 4096;
+        //做一次检查点
+        Result Checkpoint();
+        //是否有未保存的批量修改
+        bool HasUnsavedChanges() const;
+        //日志中尚未并入模型文件的记录数
+        std::size_t GetJournalLength() const;
+        //最近一次加载时重放的编辑数
+        std::size_t GetReplayedEditCount() const;
+        //简化模型
+        Result SimplifyModel(std::size_t TargetFaceCount, double MaxError,
+            SimplifyReport* ReportPtr);
+        //重排面以提高顶点缓存命中率
+        Result OptimizeVertexCache(CacheReport* ReportPtr) const;
+        //设置保存时是否优化面的顺序
+        void SetOptimizeOnExport(bool OptimizeOnExport);
+        //保存时是否优化面的顺序
+        bool IsOptimizingOnExport() const;
+        //按Morton码重排模型的存储
+        Result ReorderSpatially(LocalityReport* ReportPtr);
+        //统计连通部分
+        Result LabelComponents(
+            std::vector<ComponentInfo>* ComponentsPtr) const;
+        //分别保存各个连通部分
+        Result ExportComponents(std::string Path, std::size_t* CountPtr) const;
+        //求凸包并保存
+        Result ExportConvexHull(std::string Path, std::size_t Component,
+            HullReport* ReportPtr) const;
+        //测评求凸包的耗时
+        Result BenchmarkConvexHull(std::size_t PointCount,
+            std::vector<HullBenchmark>* ResultsPtr) const;
+        //求有向距离场并保存
+        Result ExportDistanceField(std::string Path, std::size_t Resolution,
+            double BandVoxels, FieldReport* ReportPtr) const;
+        //求自相交的面对
+        Result FindSelfIntersections(
+            std::vector<std::pair<std::size_t, std::size_t>>* PairsPtr) const;
+        //求与另一个模型相交的面对
+        Result FindIntersectionsWith(std::string Path,
+            std::vector<std::pair<std::size_t, std::size_t>>* PairsPtr) const;
+        //批量判断点是否在模型内部
+        Result ClassifyPoints(const std::vector<double>& Coordinates,
+            std::vector<std::uint64_t>* MaskPtr) const;
+        //从文件读入点并判断是否在模型内部
+        Result ClassifyPointsFrom(std::string Path,
+            std::vector<double>* CoordinatesPtr,
+            std::vector<std::uint64_t>* MaskPtr) const;
+        //求各条线穿过的面
+        Result FindLineFaceHits(
+            std::vector<IntersectionFinder::LineHit>* HitsPtr) const;
+        //Loop细分模型
+        Result SubdivideModel(std::size_t Levels, SubdivisionReport* ReportPtr);
+        //Taubin光顺模型
+        Result SmoothModel(std::size_t Iterations, SmoothingReport* ReportPtr);
+        //分析面的质量
+        Result AnalyzeQuality(const QualityThresholds& Thresholds,
+            QualityReport* ReportPtr) const;
+        //仿射变换模型
+        Result TransformModel(const std::array<double, 16>& Matrix,
+            TransformReport* ReportPtr);
+        //平移模型
+        Result TranslateModel(double X, double Y, double Z,
+            TransformReport* ReportPtr);
+        //旋转模型
+        Result RotateModel(std::size_t Axis, double Degrees,
+            TransformReport* ReportPtr);
+        //缩放模型
+        Result ScaleModel(double X, double Y, double Z,
+            TransformReport* ReportPtr);
+        //求测地最短路径并加入模型
+        Result FindGeodesicPath(const double* From, const double* To,
+            GeodesicPath* PathPtr, std::size_t* AddedLinesPtr);
+        //求测地距离场
+        Result GeodesicDistances(const double* From,
+            std::vector<double>* PositionsPtr,
+            std::vector<double>* DistancesPtr) const;
     private:
         //构造函数
         Controller() = default;
+        //析构函数，取消尚未结束的后台加载，等待尚未结束的后台保存
+        ~Controller();
+        //导入模型并将异常转换为操作结果
+        static Result ImportModel(const std::string& Path, Model3D& Model,
+            ImportProgress* Progress, bool WeldPoints);
+        //导出模型并将异常转换为操作结果
+        static Result ExportModel(const std::string& Path,
+            const Model3D& Model, bool WeldPoints,
+            const std::function<bool(const std::string&)>& BeforeReplace
+                = nullptr);
+        //为新加载的模型打开编辑日志并重放其中的记录
+        void AttachJournal(const std::string& Path);
+        //重放一条日志记录
+        Result ApplyRecord(const EditJournal::Record& Entry);
+        //编辑成功后追加日志，必要时做检查点
+        void AppendToJournal(const EditJournal::Record& Entry);
+        //无法写入日志的修改之后关闭日志，标记为有未保存的修改
+        void DetachJournal();
         Model3D m_Model;
+        std::shared_ptr<LoadTask> m_PendingLoad;
+        std::shared_ptr<SaveTask> m_PendingSave;
+        std::unique_ptr<LazyObjFile> m_LazyModel;
+        bool m_WeldOnImport = false;
+        bool m_WeldOnExport = false;
+        bool m_OptimizeOnExport = false;
+        std::shared_ptr<EditJournal> m_Journal;
+        std::string m_ModelPath;
+        bool m_HasUnsavedChanges = false;
+        std::uint64_t m_EditCount = 0;
+        bool m_IsReplaying = false;
+        std::size_t m_ReplayedEdits = 0;
 };
 
 #endif // CONTROLLER_HPP
\ No newline at end of file
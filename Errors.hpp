@@ -7,6 +7,8 @@
     - 增添了文件扩展名异常类、文件打开异常类、文件格式异常类、重复点异常类、重复元素异常类
     2024/7/28 
     - 增添了单例模式异常类
+    2026/10/18
+    - 增添了导入取消异常类
 *******************************************************************************/
 #ifndef ERRORS_HPP
 #define ERRORS_HPP
@@ -136,4 +138,19 @@ class ExceptionOnlyOneInstance: public std::invalid_argument {
             invalid_argument("Only one module is allowed to be created.") {}
 };
 
+/*******************************************************************************
+【类名】 ExceptionImportCancelled
+【功能】 导入取消异常类，导入器响应取消请求时抛出
+【接口说明】
+    - ExceptionImportCancelled()
+        构造函数
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+class ExceptionImportCancelled: public std::runtime_error {
+    public:
+        ExceptionImportCancelled():
+            runtime_error("Import was cancelled.") {}
+};
+
 #endif // ERRORS_HPP
\ No newline at end of file
@@ -2,11 +2,20 @@
 【文件名】 AbstractExporter.cpp
 【功能模块和目的】 实现抽象类AbstractExporter，提供导出方法Export
  Created by 朱昊东 on 2024/7/27
-【更改记录】 无
+【更改记录】 
+    2026/10/18
+    - Export按GetOpenMode指定的模式打开文件
+    - Export先写临时文件再原子地重命名，保存中途崩溃不会破坏原文件
+    - Export在重命名前后同步临时文件与目录，断电也不会留下被截断的文件
+    - Export在重命名前调用SetBeforeReplace设置的回调
+    - Export的临时文件名附加进程号与序号，同时保存同一路径时互不干扰
 *******************************************************************************/
+#include <filesystem>
 #include <fstream>
 #include <string>
+#include <system_error>
 #include "AbstractExporter.hpp"
+#include "FileSync.hpp"
 #include "../Errors.hpp"
 
 /*******************************************************************************
@@ -17,17 +26,49 @@
     - const Model3D& Model（输入参数）：Model3D对象，三维模型
 【返回值】 无
 Created by 朱昊东 on 2024/7/26
-【更改记录】 无
+【更改记录】 
+    2026/10/18
+    - 按GetOpenMode指定的模式打开文件
+    - 先写入同目录下的临时文件，成功后重命名为目标文件；目标文件要么保持原样，
+    要么被完整替换
+    - 重命名前把临时文件同步到磁盘，重命名后同步所在目录
+    - 重命名前调用替换前回调，回调失败时放弃替换
+    - 临时文件名由FileSync::MakeTempPath生成，后台保存与前台导出同一路径时
+    不再共用同一个临时文件
 *******************************************************************************/
 void AbstractExporter::Export(std::string Path, const Model3D& Model) const {
     if (!CheckExtension(Path)) {
         throw ExceptionFileExtension();
     }//检查扩展名
+    const std::string TempPath = FileSync::MakeTempPath(Path);
+    std::error_code Error;
     std::ofstream File;
-    File.open(Path, std::ios::trunc);//打开文件
+    File.open(TempPath, GetOpenMode());//打开临时文件
     if (!File.is_open()) {
         throw ExceptionFileOpen();
     }//打开失败
-    Save(File, Model);
+    try {
+        Save(File, Model);
+    }
+    catch (...) {
+        File.close();
+        std::filesystem::remove(TempPath, Error);
+        throw;
+    }
     File.close();
+    if (File.fail() || !FileSync::SyncFile(TempPath)) {
+        std::filesystem::remove(TempPath, Error);
+        throw ExceptionFileOpen();
+    }//写入或落盘失败，例如磁盘已满；此时目标文件还未被触及
+    if (m_BeforeReplace && !m_BeforeReplace(TempPath)) {
+        std::filesystem::remove(TempPath, Error);
+        throw ExceptionFileOpen();
+    }
+    std::filesystem::rename(TempPath, Path, Error);
+    if (Error) {
+        std::filesystem::remove(TempPath, Error);
+        throw ExceptionFileOpen();
+    }
+    //目录项未能同步时，断电后至多看到完整的原文件，不视为保存失败
+    FileSync::SyncParentDirectory(Path);
 }
\ No newline at end of file
@@ -3,12 +3,19 @@
 【功能模块和目的】 定义抽象类AbstractExporter，提供导出方法Export，并指定虚函数
 检查扩展名和保存模型
  Created by 朱昊东 on 2024/7/27
-【更改记录】 无
+【更改记录】 
+    2026/10/18
+    - 增添了虚函数GetOpenMode，以支持二进制格式的导出器
+    - 增添了导出时焊接重合点的开关
+    - Export改为先写临时文件再重命名
+    - Export在重命名前同步临时文件
+    - 增添了替换目标文件前的回调
 *******************************************************************************/
 #ifndef ABSTRACT_EXPORTER_HPP
 #define ABSTRACT_EXPORTER_HPP
 
 #include <fstream>
+#include <functional>
 #include <string>
 #include "../Models/Model.hpp"
 
@@ -23,24 +30,59 @@ using Point3D = Point<3>;
 保存模型
 【接口说明】
     - void Export(std::string Path, const Model3D& Model) const
-        导出模型
+        导出模型，先写入临时文件并同步到磁盘，完成后原子地替换目标文件
+    - void SetWeldPoints(bool WeldPoints)
+        设置导出时是否焊接相距在容差以内的点，不修改模型本身
+    - void SetBeforeReplace(
+        std::function<bool(const std::string& TempPath)> BeforeReplace)
+        设置临时文件写完并同步后、替换目标文件前调用的回调，回调返回false时
+        放弃替换，Export抛出文件打开异常
+    - bool IsWeldingPoints() const
+        导出时是否焊接重合的点，供派生类的Save使用
     - virtual bool CheckExtension(std::string Path) const
         检查扩展名
     - virtual void Save(std::ofstream& File, const Model3D& Model) const
         保存模型
+    - virtual std::ios::openmode GetOpenMode() const
+        打开文件的模式，默认为文本模式
    
-【更改记录】 无
+【更改记录】 
+    2026/10/18
+    - 增添了虚函数GetOpenMode
+    - 增添了SetWeldPoints与IsWeldingPoints
+    - 增添了SetBeforeReplace
 *******************************************************************************/
 class AbstractExporter {
     public:
         //导出model到path
         void Export(std::string Path, const Model3D& Model) const;
+        //设置导出时是否焊接重合的点
+        void SetWeldPoints(bool WeldPoints) {
+            m_WeldPoints = WeldPoints;
+        }
+        //设置替换目标文件前的回调
+        void SetBeforeReplace(
+            std::function<bool(const std::string& TempPath)> BeforeReplace) {
+            m_BeforeReplace = BeforeReplace;
+        }
     
     protected:
         //检查扩展名
         virtual bool CheckExtension(std::string Path) const = 0;
         //保存模型
         virtual void Save(std::ofstream& File, const Model3D& Model) const = 0;
+        //打开文件的模式，二进制格式的导出器需重写
+        virtual std::ios::openmode GetOpenMode() const {
+            return std::ios::out | std::ios::trunc;
+        }
+        //导出时是否焊接重合的点
+        bool IsWeldingPoints() const {
+            return m_WeldPoints;
+        }
+
+    private:
+        bool m_WeldPoints = false;
+        std::function<bool(const std::string& TempPath)> m_BeforeReplace;
 };
 
 #endif // ABSTRACT_EXPORTER_HPP
\ No newline at end of file
@@ -2,7 +2,11 @@
 【文件名】 AbstractImporter.cpp
 【功能模块和目的】 实现抽象类AbstractImporter，提供导入方法Import
  Created by 朱昊东 on 2024/7/27
-【更改记录】 无
+【更改记录】 
+    2026/10/18
+    - Import按GetOpenMode指定的模式打开文件
+    - Import增添了导入进度参数
+    - Import可在加载后焊接重合的点
 *******************************************************************************/
 
 #include <string>
@@ -16,19 +20,36 @@
 【参数】 
     - std::string Path（输入参数）：字符串，文件路径
     - const Model3D& Model（输入参数）：Model3D对象，三维模型
+    - ImportProgress* Progress（输入输出参数）：导入进度，可为空
 【返回值】 无
 Created by 朱昊东 on 2024/7/26
-【更改记录】 无
+【更改记录】 
+    2026/10/18
+    - 按GetOpenMode指定的模式打开文件
+    - 增添了导入进度参数，导入前记录文件总字节数
+    - 开启焊接时，加载后合并相距在容差以内的点
 *******************************************************************************/
-void AbstractImporter::Import(std::string Path, Model3D& Model) const {
+void AbstractImporter::Import(std::string Path, Model3D& Model,
+    ImportProgress* Progress) const {
     if (!CheckExtension(Path)) {
         throw ExceptionFileExtension();
     }//检查扩展名
     std::ifstream File;
-    File.open(Path, std::ios::in);//打开文件
+    File.open(Path, GetOpenMode());//打开文件
     if (!File.is_open()) {
         throw ExceptionFileOpen();
     }//打开失败
-    Load(File, Model);
+    ImportProgress LocalProgress;
+    if (Progress == nullptr) {
+        Progress = &LocalProgress;
+    }//调用者不关心进度时使用局部对象
+    File.seekg(0, std::ios::end);
+    std::streamoff Size = File.tellg();
+    Progress->SetTotalBytes(Size > 0 ? static_cast<std::size_t>(Size) : 0);
+    File.seekg(0, std::ios::beg);
+    Load(File, Model, *Progress);
     File.close();
+    if (m_WeldPoints) {
+        Model.WeldPoints();
+    }
 }
\ No newline at end of file
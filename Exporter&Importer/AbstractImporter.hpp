@@ -3,13 +3,18 @@
 【功能模块和目的】 定义抽象类AbstractImporter，提供导入方法Import，并指定虚函数 
 检查扩展名和加载模型
  Created by 朱昊东 on 2024/7/27
-【更改记录】 无
+【更改记录】 
+    2026/10/18
+    - 增添了虚函数GetOpenMode，以支持二进制格式的导入器
+    - Import与Load增添了导入进度参数
+    - 增添了导入后焊接重合点的开关
 *******************************************************************************/
 #ifndef ABSTRACT_IMPORTER_HPP
 #define ABSTRACT_IMPORTER_HPP
 
 #include <fstream>
 #include <string>
+#include "ImportProgress.hpp"
 #include "../Models/Model.hpp"
 
 using Line3D = Line<3>;
@@ -22,24 +27,47 @@ using Point3D = Point<3>;
 【功能】 定义抽象类AbstractImporter，提供导入方法Import，并指定虚函数检查扩展名和
 加载模型
 【接口说明】
-    - void Import(std::string Path, Model3D& Model) const
-        导入模型
+    - void Import(std::string Path, Model3D& Model,
+        ImportProgress* Progress = nullptr) const
+        导入模型，可通过Progress获取进度或取消导入
+    - void SetWeldPoints(bool WeldPoints)
+        设置导入后是否焊接相距在容差以内的点
     - virtual bool CheckExtension(std::string Path) const
         检查扩展名
-    - virtual void Load(std::ifstream& File, Model3D& Model) const
-        加载模型
+    - virtual void Load(std::ifstream& File, Model3D& Model,
+        ImportProgress& Progress) const
+        加载模型，需定期报告进度并响应取消请求
+    - virtual std::ios::openmode GetOpenMode() const
+        打开文件的模式，默认为文本模式
  Created by 朱昊东 on 2024/7/27
-【更改记录】 无
+【更改记录】 
+    2026/10/18
+    - 增添了虚函数GetOpenMode
+    - Import与Load增添了导入进度参数
+    - 增添了SetWeldPoints
 *******************************************************************************/
 class AbstractImporter {
     public:
-        void Import(std::string Path, Model3D& Model) const;
+        void Import(std::string Path, Model3D& Model,
+            ImportProgress* Progress = nullptr) const;
+        //设置导入后是否焊接重合的点
+        void SetWeldPoints(bool WeldPoints) {
+            m_WeldPoints = WeldPoints;
+        }
 
     protected:
         //检查扩展名
         virtual bool CheckExtension(std::string Path) const = 0;
         //加载模型
-        virtual void Load(std::ifstream& File, Model3D& Model) const = 0;
+        virtual void Load(std::ifstream& File, Model3D& Model,
+            ImportProgress& Progress) const = 0;
+        //打开文件的模式，二进制格式的导入器需重写
+        virtual std::ios::openmode GetOpenMode() const {
+            return std::ios::in;
+        }
+
+    private:
+        bool m_WeldPoints = false;
 };
 
 #endif // ABSTRACT_IMPORTER_HPP
\ No newline at end of file
@@ -0,0 +1,178 @@
+/*******************************************************************************
+【文件名】 CmfExporter.cpp
+【功能模块和目的】 实现CmfExporter类，用于导出.cmf压缩模型文件
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - Save支持导出时焊接重合的点
+    - 量化使元素的两个点被判定为相同时减小步长
+*******************************************************************************/
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "CmfExporter.hpp"
+#include "VarintCodec.hpp"
+#include "../Models/IndexedModel.hpp"
+#include "../Models/Model.hpp"
+
+constexpr char CmfExporter::Magic[4];
+constexpr double CmfExporter::DefaultStep;
+
+/*******************************************************************************
+【函数名称】 CollapsesElement
+【函数功能】 按解码器的方式还原量化后的坐标，判断是否有元素的两个点被Point::IsSame
+判定为相同；这样的文件在读入时会因元素无效而失败
+【参数】
+    - const std::vector<std::int64_t>& Quantized（输入参数）：各点量化后的坐标，
+    每3个为一个点
+    - double Step（输入参数）：量化步长
+    - const std::vector<std::size_t>& Indices（输入参数）：各元素的点序号
+    - std::size_t Arity（输入参数）：每个元素的点数
+【返回值】 bool：是否有元素的点被量化为相同
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+static bool CollapsesElement(const std::vector<std::int64_t>& Quantized,
+    double Step, const std::vector<std::size_t>& Indices, std::size_t Arity) {
+    auto Decode = [&](std::size_t Index) {
+        double Coords[3];
+        for (std::size_t i = 0; i < 3; i++) {
+            Coords[i] = Quantized[3 * Index + i] * Step;
+        }
+        return Point3D(Coords);
+    };
+    for (std::size_t e = 0; e < Indices.size(); e += Arity) {
+        for (std::size_t i = 0; i < Arity; i++) {
+            for (std::size_t j = i + 1; j < Arity; j++) {
+                if (Point3D::IsSame(Decode(Indices[e + i]),
+                    Decode(Indices[e + j]))) {
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
+/*******************************************************************************
+【函数名称】 CheckExtension
+【函数功能】 检查扩展名为.cmf
+【参数】 
+    - std::string Path（输入参数）：字符串，文件路径
+【返回值】 bool：扩展名是否正确
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+bool CmfExporter::CheckExtension(std::string Path) const {
+    const std::string extension = ".cmf";
+    if (Path.length() >= extension.length()) {
+        return (0 == Path.compare(Path.length() - extension.length(),
+            extension.length(), extension));
+    } else {
+        return false;
+    }
+}
+
+/*******************************************************************************
+【函数名称】 GetOpenMode
+【函数功能】 以二进制模式打开文件
+【参数】 无
+【返回值】 std::ios::openmode：打开模式
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+std::ios::openmode CmfExporter::GetOpenMode() const {
+    return std::ios::out | std::ios::trunc | std::ios::binary;
+}
+
+/*******************************************************************************
+【函数名称】 Save
+【函数功能】 将模型编码后一次性写入文件
+【参数】 
+    - std::ofstream& File（输入参数）：文件流对象
+    - const Model3D& Model（输入参数）：Model3D对象，三维模型
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 开启焊接时，建立索引的同时合并重合的点
+    - 量化后检查各元素，有元素的点被量化为相同时把步长减半重新量化，
+    直到达到坐标范围允许的最小步长
+    - 文件头记录焊接后实际写入的线数和面数
+    - 线和面按序号而不是存储顺序写入
+*******************************************************************************/
+void CmfExporter::Save(std::ofstream& File, const Model3D& Model) const {
+    IndexedModel<3> Indexed(Model, IsWeldingPoints(), true);
+    const auto& Points = Indexed.Points;
+
+    double MaxAbs = 0;
+    for (const auto& P: Points) {
+        for (int i = 0; i < 3; i++) {
+            MaxAbs = std::max(MaxAbs, std::fabs(P->GetCoordinate(i)));
+        }
+    }
+    double Step = DefaultStep;
+    const double MaxQuantized = std::ldexp(1.0, 60);
+    const double MinStep = MaxAbs / MaxQuantized;
+    if (Step < MinStep) {
+        Step = MinStep;
+    }//坐标过大时放宽步长，保证量化值不溢出
+    std::vector<std::int64_t> Quantized(Points.size() * 3);
+    while (true) {
+        for (std::size_t v = 0; v < Points.size(); v++) {
+            for (std::size_t i = 0; i < 3; i++) {
+                Quantized[3 * v + i]
+                    = std::llround(Points[v]->GetCoordinate(i) / Step);
+            }
+        }
+        bool IsValid
+            = !CollapsesElement(Quantized, Step, Indexed.LineIndices, 2)
+            && !CollapsesElement(Quantized, Step, Indexed.FaceIndices, 3);
+        if (IsValid || Step / 2 < MinStep) {
+            break;
+        }
+        Step /= 2;
+    }//相距略大于容差的点可能被量化为相同，此时需要更细的步长
+
+    std::string Buffer;
+    Buffer.reserve(32 + Model.Name.size() + Points.size() * 9
+        + Indexed.LineIndices.size() * 2 + Indexed.FaceIndices.size() * 2);
+    Buffer.append(Magic, sizeof(Magic));
+    VarintCodec::Write(Buffer, Model.Name.size());
+    Buffer.append(Model.Name);
+    VarintCodec::WriteDouble(Buffer, Step);
+    VarintCodec::Write(Buffer, Points.size());
+    VarintCodec::Write(Buffer, Indexed.LineIndices.size() / 2);
+    VarintCodec::Write(Buffer, Indexed.FaceIndices.size() / 3);
+
+    std::int64_t Previous[3] = { 0, 0, 0 };
+    for (std::size_t v = 0; v < Points.size(); v++) {
+        for (std::size_t i = 0; i < 3; i++) {
+            VarintCodec::Write(Buffer,
+                VarintCodec::ZigZag(Quantized[3 * v + i] - Previous[i]));
+            Previous[i] = Quantized[3 * v + i];
+        }
+    }//点坐标：量化后差分预测
+
+    auto WriteElements = [&Buffer](
+        const std::vector<std::size_t>& Indices, std::size_t Arity) {
+        std::int64_t PreviousFirst = 0;
+        for (std::size_t i = 0; i < Indices.size(); i += Arity) {
+            std::int64_t First = static_cast<std::int64_t>(Indices[i]);
+            VarintCodec::Write(Buffer,
+                VarintCodec::ZigZag(First - PreviousFirst));
+            for (std::size_t j = 1; j < Arity; j++) {
+                VarintCodec::Write(Buffer, VarintCodec::ZigZag(
+                    static_cast<std::int64_t>(Indices[i + j]) - First));
+            }
+            PreviousFirst = First;
+        }
+    };//连接关系：序号差分
+    WriteElements(Indexed.LineIndices, 2);
+    WriteElements(Indexed.FaceIndices, 3);
+
+    File.write(Buffer.data(), Buffer.size());
+}
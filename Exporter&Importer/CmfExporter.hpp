@@ -0,0 +1,60 @@
+/*******************************************************************************
+【文件名】 CmfExporter.hpp
+【功能模块和目的】 定义CmfExporter类，用于导出.cmf压缩模型文件
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 量化步长不再固定，保证解码后的元素仍然有效
+*******************************************************************************/
+#ifndef CMF_EXPORTER_HPP
+#define CMF_EXPORTER_HPP
+
+#include <fstream>
+#include <string>
+#include "AbstractExporter.hpp"
+#include "../Models/Model.hpp"
+
+/*******************************************************************************
+【类名】 CmfExporter
+【功能】 CmfExporter类，将模型编码为紧凑的二进制.cmf文件
+    文件布局（多字节整数均为varint，有符号量先做ZigZag）：
+    - 魔数"CMF1"
+    - 名称长度、名称
+    - 量化步长（8字节double）
+    - 点数、线数、面数
+    - 点坐标：按步长量化为整数后，与上一个点的同轴坐标做差分预测
+    - 线：首点序号与上一条线首点序号之差，次点序号与本线首点序号之差
+    - 面：首点序号与上一个面首点序号之差，其余两点序号与本面首点序号之差
+    点按首次出现的顺序编号，相邻元素的序号相近，差分值通常只占1~2字节
+【接口说明】
+    - static const char Magic[4]
+        文件魔数
+    - static constexpr double DefaultStep
+        默认量化步长，小于Point::IsSame的容差，解码后的点与原点判定为相同；
+        若量化使某个线或面的两个点被判定为相同，步长逐次减半直到各元素有效
+    - bool CheckExtension(std::string Path) const override
+        检查扩展名为.cmf
+    - void Save(std::ofstream& File, const Model3D& Model) const override
+        保存模型
+    - std::ios::openmode GetOpenMode() const override
+        以二进制模式打开文件
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - Save在量化使元素无效时减小步长
+*******************************************************************************/
+class CmfExporter: public AbstractExporter {
+    public:
+        static constexpr char Magic[4] = { 'C', 'M', 'F', '1' };
+        static constexpr double DefaultStep = 1e-7;
+
+    protected:
+        //检查扩展名
+        bool CheckExtension(std::string Path) const override;
+        //保存模型
+        void Save(std::ofstream& File, const Model3D& Model) const override;
+        //以二进制模式打开文件
+        std::ios::openmode GetOpenMode() const override;
+};
+
+#endif // CMF_EXPORTER_HPP
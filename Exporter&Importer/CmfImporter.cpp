@@ -0,0 +1,140 @@
+/*******************************************************************************
+【文件名】 CmfImporter.cpp
+【功能模块和目的】 实现CmfImporter类，用于导入.cmf压缩模型文件
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+#include "CmfExporter.hpp"
+#include "CmfImporter.hpp"
+#include "VarintCodec.hpp"
+#include "../Errors.hpp"
+#include "../Models/Model.hpp"
+
+/*******************************************************************************
+【函数名称】 CheckExtension
+【函数功能】 检查扩展名为.cmf
+【参数】 
+    - std::string Path（输入参数）：字符串，文件路径
+【返回值】 bool：扩展名是否正确
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+bool CmfImporter::CheckExtension(std::string Path) const {
+    const std::string extension = ".cmf";
+    if (Path.length() >= extension.length()) {
+        return (0 == Path.compare(Path.length() - extension.length(),
+            extension.length(), extension));
+    } else {
+        return false;
+    }
+}
+
+/*******************************************************************************
+【函数名称】 GetOpenMode
+【函数功能】 以二进制模式打开文件
+【参数】 无
+【返回值】 std::ios::openmode：打开模式
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+std::ios::openmode CmfImporter::GetOpenMode() const {
+    return std::ios::in | std::ios::binary;
+}
+
+/*******************************************************************************
+【函数名称】 Load
+【函数功能】 读入整个文件并解码模型
+【参数】 
+    - std::ifstream& File（输入参数）：文件流对象
+    - Model3D& Model（输出参数）：Model3D对象，三维模型
+    - ImportProgress& Progress（输入输出参数）：导入进度
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+void CmfImporter::Load(std::ifstream& File, Model3D& Model,
+    ImportProgress& Progress) const {
+    const std::size_t ReportInterval = 65536;
+    std::vector<char> Data(Progress.GetTotalBytes());
+    File.read(Data.data(), Data.size());
+    Data.resize(static_cast<std::size_t>(File.gcount()));
+    const char* Cursor = Data.data();
+    const char* End = Data.data() + Data.size();
+
+    if (Data.size() < sizeof(CmfExporter::Magic)
+        || std::memcmp(Cursor, CmfExporter::Magic,
+            sizeof(CmfExporter::Magic)) != 0) {
+        throw ExceptionFileFormat();
+    }//检查魔数
+    Cursor += sizeof(CmfExporter::Magic);
+
+    std::uint64_t NameLength = VarintCodec::Read(Cursor, End);
+    if (NameLength > static_cast<std::uint64_t>(End - Cursor)) {
+        throw ExceptionFileFormat();
+    }
+    Model.SetName(std::string(Cursor, NameLength));
+    Cursor += NameLength;
+    double Step = VarintCodec::ReadDouble(Cursor, End);
+    std::uint64_t PointCount = VarintCodec::Read(Cursor, End);
+    std::uint64_t LineCount = VarintCodec::Read(Cursor, End);
+    std::uint64_t FaceCount = VarintCodec::Read(Cursor, End);
+    if (PointCount > static_cast<std::uint64_t>(End - Cursor)) {
+        throw ExceptionFileFormat();
+    }//每个点至少占3字节，防止损坏的计数导致巨量分配
+
+    std::size_t Elements = 0;
+    auto ReportElement = [&]() {
+        if (++Elements % ReportInterval == 0) {
+            Progress.Report(Cursor - Data.data(), Elements);
+            Progress.ThrowIfCancelled();
+        }
+    };//压缩数据已全部读入内存，按已解码的字节数报告进度
+
+    std::vector<std::shared_ptr<Point3D>> Points;
+    Points.reserve(PointCount);
+    std::int64_t Previous[3] = { 0, 0, 0 };
+    for (std::uint64_t i = 0; i < PointCount; i++) {
+        double Coords[3];
+        for (int j = 0; j < 3; j++) {
+            Previous[j] += VarintCodec::UnZigZag(
+                VarintCodec::Read(Cursor, End));
+            Coords[j] = Previous[j] * Step;
+        }
+        Points.push_back(std::make_shared<Point3D>(Coords));
+        ReportElement();
+    }
+
+    auto ReadIndex = [&](std::int64_t Base) -> std::size_t {
+        std::int64_t Index = Base
+            + VarintCodec::UnZigZag(VarintCodec::Read(Cursor, End));
+        if (Index < 0 || static_cast<std::uint64_t>(Index) >= PointCount) {
+            throw ExceptionFileFormat();
+        }
+        return static_cast<std::size_t>(Index);
+    };
+    std::int64_t PreviousFirst = 0;
+    for (std::uint64_t i = 0; i < LineCount; i++) {
+        std::size_t First = ReadIndex(PreviousFirst);
+        std::size_t Second = ReadIndex(First);
+        Model.AddLineUnchecked(Line3D(Points[First], Points[Second]));
+        PreviousFirst = First;
+        ReportElement();
+    }
+    PreviousFirst = 0;
+    for (std::uint64_t i = 0; i < FaceCount; i++) {
+        std::size_t First = ReadIndex(PreviousFirst);
+        std::size_t Second = ReadIndex(First);
+        std::size_t Third = ReadIndex(First);
+        Model.AddFaceUnchecked(
+            Face3D(Points[First], Points[Second], Points[Third]));
+        PreviousFirst = First;
+        ReportElement();
+    }
+    Progress.Report(Data.size(), Elements);
+}
@@ -0,0 +1,40 @@
+/*******************************************************************************
+【文件名】 CmfImporter.hpp
+【功能模块和目的】 定义CmfImporter类，用于导入.cmf压缩模型文件
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+#ifndef CMF_IMPORTER_HPP
+#define CMF_IMPORTER_HPP
+
+#include <fstream>
+#include <string>
+#include "AbstractImporter.hpp"
+#include "../Models/Model.hpp"
+
+/*******************************************************************************
+【类名】 CmfImporter
+【功能】 CmfImporter类，解码CmfExporter生成的.cmf文件
+【接口说明】
+    - bool CheckExtension(std::string Path) const override
+        检查扩展名为.cmf
+    - void Load(std::ifstream& File, Model3D& Model,
+        ImportProgress& Progress) const override
+        加载模型，文件损坏时抛出文件格式异常
+    - std::ios::openmode GetOpenMode() const override
+        以二进制模式打开文件
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+class CmfImporter: public AbstractImporter {
+    protected:
+        //检查扩展名
+        bool CheckExtension(std::string Path) const override;
+        //加载模型
+        void Load(std::ifstream& File, Model3D& Model,
+            ImportProgress& Progress) const override;
+        //以二进制模式打开文件
+        std::ios::openmode GetOpenMode() const override;
+};
+
+#endif // CMF_IMPORTER_HPP
@@ -0,0 +1,528 @@
+/*******************************************************************************
+【文件名】 EditJournal.cpp
+【功能模块和目的】 实现EditJournal类，追加、读取与重写编辑日志
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 日志文件改为在追加第一条记录时创建
+    - 增添了保存标记的写入与识别
+*******************************************************************************/
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <vector>
+#include "EditJournal.hpp"
+#include "FileSync.hpp"
+#include "VarintCodec.hpp"
+#include "../Errors.hpp"
+
+static const char JournalMagic[4] = { 'E', 'J', 'L', '1' };
+
+/*******************************************************************************
+【函数名称】 EditJournal
+【函数功能】 构造函数。日志文件头与模型文件一致时读出其中完整的编辑记录，丢弃写了
+一半的末尾记录；文件头已过期但有与模型文件一致的保存标记时（保存后、清理日志前
+崩溃），读出该标记所记位置之后的编辑记录并以新的文件头重写日志；其余情况下日志
+已过期，将被删除。日志不存在时不创建
+【参数】
+    - const std::string& ModelPath（输入参数）：字符串，模型文件路径
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 不再为没有记录的日志创建文件
+    - 文件头过期时按保存标记找回未并入模型文件的记录
+*******************************************************************************/
+EditJournal::EditJournal(const std::string& ModelPath):
+    m_ModelPath(ModelPath), m_JournalPath(GetJournalPath(ModelPath)) {
+    std::string Data;
+    std::ifstream Existing(m_JournalPath, std::ios::in | std::ios::binary);
+    if (!Existing.is_open()) {
+        return;
+    }//日志不存在
+    Data.assign(std::istreambuf_iterator<char>(Existing),
+        std::istreambuf_iterator<char>());
+    Existing.close();
+    std::uint64_t HeaderFileSize = 0;
+    std::int64_t HeaderFileTime = 0;
+    std::size_t HeaderSize = GetHeaderSize(Data,
+        &HeaderFileSize, &HeaderFileTime);
+    std::uint64_t FileSize = 0;
+    std::int64_t FileTime = 0;
+    GetFileStamp(m_ModelPath, &FileSize, &FileTime);
+    std::vector<Record> Records;
+    std::vector<std::uint64_t> Offsets;
+    std::size_t Valid = 0;
+    if (HeaderSize != 0) {
+        Valid = Parse(Data, HeaderSize, &Records, &Offsets);
+    }
+    bool IsHeaderCurrent = HeaderSize != 0
+        && HeaderFileSize == FileSize && HeaderFileTime == FileTime;
+    std::uint64_t From = 0;
+    bool HasMarker = false;
+    bool IsMarkerCurrent = false;
+    for (const auto& Entry: Records) {
+        if (Entry.Op != Operation::CHECKPOINT) {
+            continue;
+        }
+        HasMarker = true;
+        if (!IsHeaderCurrent
+            && Entry.FileSize == FileSize && Entry.FileTime == FileTime) {
+            From = Entry.ID;
+            IsMarkerCurrent = true;
+        }//模型文件正是带有该标记的那次保存写出的
+    }
+    if (!IsHeaderCurrent && !IsMarkerCurrent) {
+        Rewrite(std::string());
+        return;
+    }//日志已过期
+    std::string Edits = KeepEdits(Records, Offsets, From, &m_PendingRecords);
+    m_RecordCount = m_PendingRecords.size();
+    if (!HasMarker && HeaderSize + Valid == Data.size()) {
+        m_HeaderSize = HeaderSize;
+        m_Size = Valid;
+        m_File.open(m_JournalPath,
+            std::ios::out | std::ios::app | std::ios::binary);
+        return;
+    }
+    m_Size = Edits.size();//重写失败时阻止Append另起新日志
+    Rewrite(Edits);//截去损坏的末尾记录与保存标记，文件头改为当前模型文件
+}
+
+/*******************************************************************************
+【函数名称】 GetJournalPath
+【函数功能】 获取模型文件对应的日志文件路径
+【参数】
+    - const std::string& ModelPath（输入参数）：字符串，模型文件路径
+【返回值】 std::string：日志文件路径
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+std::string EditJournal::GetJournalPath(const std::string& ModelPath) {
+    return ModelPath + ".journal";
+}
+
+/*******************************************************************************
+【函数名称】 Append
+【函数功能】 在日志末尾追加一条记录并刷新到磁盘；日志文件尚不存在时，连同文件头
+与这条记录一起以原子方式创建
+【参数】
+    - const Record& Entry（输入参数）：编辑记录
+【返回值】 bool：是否写入成功
+Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 日志文件不存在时在此创建
+    - 写入移至Write，可与MarkSaved在不同线程中调用
+*******************************************************************************/
+bool EditJournal::Append(const Record& Entry) {
+    std::lock_guard<std::mutex> Lock(m_Mutex);
+    std::string Buffer;
+    Encode(Buffer, Entry);
+    if (!Write(Buffer)) {
+        return false;
+    }
+    m_RecordCount++;
+    return true;
+}
+
+/*******************************************************************************
+【函数名称】 MarkSaved
+【函数功能】 追加一条保存标记并同步到磁盘。须在SavedPath已完整写入并同步、
+尚未替换模型文件时调用，替换后SavedPath的大小与修改时间即为模型文件的大小与
+修改时间
+【参数】
+    - std::uint64_t FoldedBytes（输入参数）：保存的快照已包含的记录字节数
+    - std::uint64_t Generation（输入参数）：取得FoldedBytes时日志的Rebase次数
+    - const std::string& SavedPath（输入参数）：即将替换模型文件的文件路径
+【返回值】 bool：是否写入成功；期间日志已被Rebase时返回false
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+bool EditJournal::MarkSaved(std::uint64_t FoldedBytes,
+    std::uint64_t Generation, const std::string& SavedPath) {
+    std::lock_guard<std::mutex> Lock(m_Mutex);
+    if (Generation != m_Generation) {
+        return false;
+    }//FoldedBytes已不是当前日志中的偏移
+    Record Entry = {};
+    Entry.Op = Operation::CHECKPOINT;
+    Entry.ID = FoldedBytes;
+    GetFileStamp(SavedPath, &Entry.FileSize, &Entry.FileTime);
+    std::string Buffer;
+    Encode(Buffer, Entry);
+    return Write(Buffer) && FileSync::SyncFile(m_JournalPath);
+}
+
+std::size_t EditJournal::GetRecordCount() const {
+    std::lock_guard<std::mutex> Lock(m_Mutex);
+    return m_RecordCount;
+}
+
+std::uint64_t EditJournal::GetSize() const {
+    std::lock_guard<std::mutex> Lock(m_Mutex);
+    return m_Size;
+}
+
+std::uint64_t EditJournal::GetGeneration() const {
+    std::lock_guard<std::mutex> Lock(m_Mutex);
+    return m_Generation;
+}
+
+/*******************************************************************************
+【函数名称】 Rebase
+【函数功能】 模型文件已被重写，丢弃前FoldedBytes字节的记录，以新的文件头保留其后
+（重写期间追加）的编辑记录
+【参数】
+    - std::uint64_t FoldedBytes（输入参数）：已并入模型文件的记录字节数
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 同时丢弃保存标记
+*******************************************************************************/
+void EditJournal::Rebase(std::uint64_t FoldedBytes) {
+    std::lock_guard<std::mutex> Lock(m_Mutex);
+    std::string Tail;
+    std::vector<Record> Remaining;
+    if (FoldedBytes < m_Size) {
+        m_File.close();
+        std::ifstream Existing(m_JournalPath,
+            std::ios::in | std::ios::binary);
+        std::string Data(std::istreambuf_iterator<char>(Existing),
+            (std::istreambuf_iterator<char>()));
+        Data.resize(std::min<std::size_t>(Data.size(), m_HeaderSize + m_Size));
+        std::vector<Record> Records;
+        std::vector<std::uint64_t> Offsets;
+        Parse(Data, m_HeaderSize, &Records, &Offsets);
+        Tail = KeepEdits(Records, Offsets, FoldedBytes, &Remaining);
+    }
+    Rewrite(Tail);
+    m_RecordCount = Remaining.size();
+    m_PendingRecords.clear();
+    m_Generation++;
+}
+
+/*******************************************************************************
+【函数名称】 GetFileStamp
+【函数功能】 读取文件的大小与修改时间，文件不存在时均为0
+【参数】
+    - const std::string& Path（输入参数）：文件路径
+    - std::uint64_t* SizePtr（输出参数）：文件大小
+    - std::int64_t* TimePtr（输出参数）：修改时间
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+void EditJournal::GetFileStamp(const std::string& Path,
+    std::uint64_t* SizePtr, std::int64_t* TimePtr) {
+    std::error_code Error;
+    *SizePtr = std::filesystem::file_size(Path, Error);
+    if (Error) {
+        *SizePtr = 0;
+    }
+    auto FileTime = std::filesystem::last_write_time(Path, Error);
+    *TimePtr = Error ? 0 : FileTime.time_since_epoch().count();
+}
+
+/*******************************************************************************
+【函数名称】 MakeHeader
+【函数功能】 生成文件头：魔数、模型文件的大小与修改时间
+【参数】 无
+【返回值】 std::string：文件头
+Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 改用GetFileStamp读取模型文件的大小与修改时间
+*******************************************************************************/
+std::string EditJournal::MakeHeader() const {
+    std::uint64_t FileSize = 0;
+    std::int64_t FileTime = 0;
+    GetFileStamp(m_ModelPath, &FileSize, &FileTime);
+    std::string Header(JournalMagic, sizeof(JournalMagic));
+    VarintCodec::Write(Header, FileSize);
+    VarintCodec::Write(Header, VarintCodec::ZigZag(FileTime));
+    return Header;
+}
+
+/*******************************************************************************
+【函数名称】 GetHeaderSize
+【函数功能】 解析日志文件头，取出其中记录的模型文件大小与修改时间
+【参数】
+    - const std::string& Data（输入参数）：日志内容
+    - std::uint64_t* SizePtr（输出参数）：文件头中的模型文件大小
+    - std::int64_t* TimePtr（输出参数）：文件头中的模型文件修改时间
+【返回值】 std::size_t：文件头的字节数，不是有效的文件头时为0
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+std::size_t EditJournal::GetHeaderSize(const std::string& Data,
+    std::uint64_t* SizePtr, std::int64_t* TimePtr) {
+    if (Data.size() < sizeof(JournalMagic)
+        || Data.compare(0, sizeof(JournalMagic), JournalMagic,
+            sizeof(JournalMagic)) != 0) {
+        return 0;
+    }
+    const char* Cursor = Data.data() + sizeof(JournalMagic);
+    const char* End = Data.data() + Data.size();
+    try {
+        *SizePtr = VarintCodec::Read(Cursor, End);
+        *TimePtr = VarintCodec::UnZigZag(VarintCodec::Read(Cursor, End));
+    }
+    catch (ExceptionFileFormat) {
+        return 0;
+    }
+    return Cursor - Data.data();
+}
+
+/*******************************************************************************
+【函数名称】 Encode
+【函数功能】 把一条记录编码为"长度+操作码+参数"的形式追加到缓冲区
+【参数】
+    - std::string& Buffer（输入输出参数）：缓冲区
+    - const Record& Entry（输入参数）：编辑记录
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 支持保存标记
+*******************************************************************************/
+void EditJournal::Encode(std::string& Buffer, const Record& Entry) {
+    std::string Payload(1, static_cast<char>(Entry.Op));
+    std::size_t CoordinateCount = 0;
+    switch (Entry.Op) {
+        case Operation::ADD_LINE : {
+            CoordinateCount = 6;
+            break;
+        }
+        case Operation::ADD_FACE : {
+            CoordinateCount = 9;
+            break;
+        }
+        case Operation::MODIFY_LINE :
+        case Operation::MODIFY_FACE : {
+            VarintCodec::Write(Payload, Entry.ID);
+            VarintCodec::Write(Payload, VarintCodec::ZigZag(Entry.PointIndex));
+            CoordinateCount = 3;
+            break;
+        }
+        case Operation::REMOVE_LINE :
+        case Operation::REMOVE_FACE : {
+            VarintCodec::Write(Payload, Entry.ID);
+            break;
+        }
+        case Operation::CHECKPOINT : {
+            VarintCodec::Write(Payload, Entry.ID);
+            VarintCodec::Write(Payload, Entry.FileSize);
+            VarintCodec::Write(Payload, VarintCodec::ZigZag(Entry.FileTime));
+            break;
+        }
+    }
+    for (std::size_t i = 0; i < CoordinateCount; i++) {
+        VarintCodec::WriteDouble(Payload, Entry.Coordinates[i]);
+    }
+    VarintCodec::Write(Buffer, Payload.size());
+    Buffer += Payload;
+}
+
+/*******************************************************************************
+【函数名称】 Decode
+【函数功能】 解码一条记录的内容（不含长度前缀）
+【参数】
+    - const char* Cursor（输入参数）：内容起始位置
+    - const char* End（输入参数）：内容结束位置
+【返回值】 Record：编辑记录
+Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 支持保存标记
+*******************************************************************************/
+EditJournal::Record EditJournal::Decode(const char* Cursor, const char* End) {
+    if (Cursor == End) {
+        throw ExceptionFileFormat();
+    }
+    Record Entry = {};
+    Entry.Op = static_cast<Operation>(static_cast<std::uint8_t>(*Cursor++));
+    std::size_t CoordinateCount = 0;
+    switch (Entry.Op) {
+        case Operation::ADD_LINE : {
+            CoordinateCount = 6;
+            break;
+        }
+        case Operation::ADD_FACE : {
+            CoordinateCount = 9;
+            break;
+        }
+        case Operation::MODIFY_LINE :
+        case Operation::MODIFY_FACE : {
+            Entry.ID = VarintCodec::Read(Cursor, End);
+            Entry.PointIndex = static_cast<int>(
+                VarintCodec::UnZigZag(VarintCodec::Read(Cursor, End)));
+            CoordinateCount = 3;
+            break;
+        }
+        case Operation::REMOVE_LINE :
+        case Operation::REMOVE_FACE : {
+            Entry.ID = VarintCodec::Read(Cursor, End);
+            break;
+        }
+        case Operation::CHECKPOINT : {
+            Entry.ID = VarintCodec::Read(Cursor, End);
+            Entry.FileSize = VarintCodec::Read(Cursor, End);
+            Entry.FileTime = VarintCodec::UnZigZag(
+                VarintCodec::Read(Cursor, End));
+            break;
+        }
+        default : {
+            throw ExceptionFileFormat();
+        }
+    }
+    for (std::size_t i = 0; i < CoordinateCount; i++) {
+        Entry.Coordinates[i] = VarintCodec::ReadDouble(Cursor, End);
+    }
+    if (Cursor != End) {
+        throw ExceptionFileFormat();
+    }
+    return Entry;
+}
+
+/*******************************************************************************
+【函数名称】 Parse
+【函数功能】 从Begin处开始依次解析记录，遇到不完整或损坏的记录时停止
+【参数】
+    - const std::string& Data（输入参数）：日志内容
+    - std::size_t Begin（输入参数）：记录部分的起始位置
+    - std::vector<Record>* Records（输出参数）：解析出的记录
+    - std::vector<std::uint64_t>* Offsets（输出参数）：每条记录相对Begin的偏移
+【返回值】 std::size_t：完整记录所占的字节数
+Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 增添了输出参数Offsets，用于按保存标记所记的位置取出记录
+*******************************************************************************/
+std::size_t EditJournal::Parse(const std::string& Data, std::size_t Begin,
+    std::vector<Record>* Records, std::vector<std::uint64_t>* Offsets) {
+    const char* Start = Data.data() + Begin;
+    const char* Cursor = Start;
+    const char* End = Data.data() + Data.size();
+    while (Cursor < End) {
+        try {
+            const char* Next = Cursor;
+            std::uint64_t Length = VarintCodec::Read(Next, End);
+            if (Length > static_cast<std::uint64_t>(End - Next)) {
+                break;
+            }//末尾记录只写了一半
+            Records->push_back(Decode(Next, Next + Length));
+            Offsets->push_back(Cursor - Start);
+            Cursor = Next + Length;
+        }
+        catch (ExceptionFileFormat) {
+            break;
+        }
+    }
+    return Cursor - Start;
+}
+
+/*******************************************************************************
+【函数名称】 KeepEdits
+【函数功能】 取出偏移不小于From的编辑记录，跳过保存标记，并把它们重新编码
+【参数】
+    - const std::vector<Record>& Records（输入参数）：Parse解析出的记录
+    - const std::vector<std::uint64_t>& Offsets（输入参数）：记录的偏移
+    - std::uint64_t From（输入参数）：已并入模型文件的记录字节数
+    - std::vector<Record>* Edits（输出参数）：取出的编辑记录
+【返回值】 std::string：取出的编辑记录的编码
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+std::string EditJournal::KeepEdits(const std::vector<Record>& Records,
+    const std::vector<std::uint64_t>& Offsets, std::uint64_t From,
+    std::vector<Record>* Edits) {
+    std::string Buffer;
+    for (std::size_t i = 0; i < Records.size(); i++) {
+        if (Offsets[i] >= From && Records[i].Op != Operation::CHECKPOINT) {
+            Encode(Buffer, Records[i]);
+            Edits->push_back(Records[i]);
+        }
+    }
+    return Buffer;
+}
+
+/*******************************************************************************
+【函数名称】 Write
+【函数功能】 把编码后的记录追加到日志并刷新；日志文件尚不存在时，连同文件头与
+这些记录一起以原子方式创建。调用者须持有m_Mutex
+【参数】
+    - const std::string& Buffer（输入参数）：编码后的记录
+【返回值】 bool：是否写入成功
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+bool EditJournal::Write(const std::string& Buffer) {
+    if (!m_File.is_open()) {
+        if (m_Size != 0) {
+            return false;
+        }//已有记录的日志无法重新打开，不能另起一个丢掉它们的新日志
+        Rewrite(Buffer);
+        return m_File.is_open();
+    }
+    m_File.write(Buffer.data(), Buffer.size());
+    m_File.flush();
+    if (!m_File) {
+        m_File.clear();
+        return false;
+    }
+    m_Size += Buffer.size();
+    return true;
+}
+
+/*******************************************************************************
+【函数名称】 Rewrite
+【函数功能】 以文件头加Records重写日志：先写临时文件再重命名，然后以追加方式打开；
+Records为空时删除日志文件，等到追加下一条记录时再创建
+【参数】
+    - const std::string& Records（输入参数）：记录部分的内容
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 没有记录时删除日志文件
+*******************************************************************************/
+void EditJournal::Rewrite(const std::string& Records) {
+    m_File.close();
+    if (Records.empty()) {
+        std::error_code Error;
+        std::filesystem::remove(m_JournalPath, Error);
+        m_HeaderSize = 0;
+        m_Size = 0;
+        return;
+    }//删除失败时留下的旧日志文件头已过期，下次打开时会被丢弃
+    std::string Header = MakeHeader();
+    std::string TempPath = m_JournalPath + ".tmp";
+    std::error_code Error;
+    {
+        std::ofstream Temp(TempPath,
+            std::ios::out | std::ios::trunc | std::ios::binary);
+        Temp.write(Header.data(), Header.size());
+        Temp.write(Records.data(), Records.size());
+        if (!Temp) {
+            Error = std::make_error_code(std::errc::io_error);
+        }
+    }
+    if (!Error) {
+        std::filesystem::rename(TempPath, m_JournalPath, Error);
+    }
+    if (Error) {
+        std::filesystem::remove(TempPath, Error);
+        return;
+    }//无法写入时日志不可用，Append将返回false
+    m_HeaderSize = Header.size();
+    m_Size = Records.size();
+    m_File.open(m_JournalPath,
+        std::ios::out | std::ios::app | std::ios::binary);
+}
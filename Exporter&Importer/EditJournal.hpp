@@ -0,0 +1,158 @@
+/*******************************************************************************
+【文件名】 EditJournal.hpp
+【功能模块和目的】 定义EditJournal类，把对模型的编辑以紧凑的二进制记录追加到模型
+文件旁的日志中，使单次编辑只需O(1)的磁盘写入
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 日志文件改为在追加第一条记录时创建
+    - 增添了保存标记，保存与清理日志之间崩溃也不会丢失编辑
+*******************************************************************************/
+#ifndef EDIT_JOURNAL_HPP
+#define EDIT_JOURNAL_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/*******************************************************************************
+【类名】 EditJournal
+【功能】 仅追加的编辑日志，存放在"<模型文件>.journal"中。文件头记录模型文件的大小和
+修改时间，只有与模型文件一致时日志中的记录才会被重放；每条记录前带有长度，崩溃时
+写了一半的末尾记录会被丢弃。模型文件被完整重写（检查点）后，调用Rebase丢弃已并入
+模型文件的记录。日志文件在追加第一条记录时才创建，记录被全部丢弃时随之删除，
+只加载而不编辑的模型旁不会留下日志文件。
+后台保存在替换模型文件之前追加一条保存标记，记下保存后模型文件的大小、修改时间与
+已并入的记录字节数；若在替换之后、Rebase之前崩溃，文件头虽已过期，打开时仍可凭
+与模型文件一致的保存标记找回其后的记录
+【接口说明】
+    - enum class Operation
+        编辑操作的种类
+    - struct Record
+        一条编辑记录，ID与Controller的编号一致（从1开始）
+    - EditJournal(const std::string& ModelPath)
+        构造函数，打开已有的日志；日志与模型文件不一致时删除日志
+    - static std::string GetJournalPath(const std::string& ModelPath)
+        日志文件的路径
+    - const std::string& ModelPath
+        模型文件路径
+    - const std::vector<Record>& PendingRecords
+        打开日志时读到的、尚未并入模型文件的记录，需由调用者按顺序重放
+    - bool Append(const Record& Entry)
+        追加一条记录并立即写入磁盘，日志文件不存在时先创建，失败时返回false
+    - bool MarkSaved(std::uint64_t FoldedBytes, std::uint64_t Generation,
+        const std::string& SavedPath)
+        追加保存标记并同步到磁盘，SavedPath为即将替换模型文件的已写完的文件
+    - std::size_t GetRecordCount() const
+        日志中的记录数
+    - std::uint64_t GetSize() const
+        日志中记录部分的字节数，可作为Rebase的参数
+    - std::uint64_t GetGeneration() const
+        日志被Rebase的次数，用于判断之前取得的偏移是否仍然有效
+    - void Rebase(std::uint64_t FoldedBytes)
+        模型文件已被重写并包含了前FoldedBytes字节记录的效果，丢弃这些记录
+    Append、MarkSaved、Rebase与各Get函数可在不同线程中调用
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 日志文件在追加第一条记录时才创建，没有记录时删除
+    - 增添了MarkSaved
+*******************************************************************************/
+class EditJournal {
+    public:
+        /***********************************************************************
+        【类名】 Operation
+        【功能】 枚举类，表示编辑操作的种类
+        Created by 朱昊东 on 2026/10/18
+        【更改记录】 无
+        ***********************************************************************/
+        enum class Operation: std::uint8_t {
+            ADD_LINE = 1,
+            ADD_FACE,
+            MODIFY_LINE,
+            MODIFY_FACE,
+            REMOVE_LINE,
+            REMOVE_FACE,
+            CHECKPOINT,
+        };
+
+        /***********************************************************************
+        【结构体名】 Record
+        【功能】 一条编辑记录。添加操作使用前6或9个坐标；修改操作使用ID、
+        PointIndex与前3个坐标；删除操作只使用ID；保存标记以ID存放已并入的
+        记录字节数，以FileSize与FileTime存放保存后模型文件的大小与修改时间
+        Created by 朱昊东 on 2026/10/18
+        【更改记录】 
+            2026/10/18
+            - 增添了保存标记使用的FileSize与FileTime
+        ***********************************************************************/
+        struct Record {
+            Operation Op;
+            std::size_t ID;
+            int PointIndex;
+            double Coordinates[9];
+            std::uint64_t FileSize;
+            std::int64_t FileTime;
+        };
+
+        explicit EditJournal(const std::string& ModelPath);
+        EditJournal(const EditJournal& Other) = delete;
+        EditJournal& operator=(const EditJournal& Other) = delete;
+
+        static std::string GetJournalPath(const std::string& ModelPath);
+
+        const std::string& ModelPath { m_ModelPath };
+        const std::vector<Record>& PendingRecords { m_PendingRecords };
+
+        //追加一条记录
+        bool Append(const Record& Entry);
+        //追加保存标记
+        bool MarkSaved(std::uint64_t FoldedBytes, std::uint64_t Generation,
+            const std::string& SavedPath);
+        std::size_t GetRecordCount() const;
+        std::uint64_t GetSize() const;
+        std::uint64_t GetGeneration() const;
+        //丢弃已并入模型文件的记录
+        void Rebase(std::uint64_t FoldedBytes);
+
+    private:
+        //读取文件的大小与修改时间
+        static void GetFileStamp(const std::string& Path,
+            std::uint64_t* SizePtr, std::int64_t* TimePtr);
+        //生成与模型文件当前状态对应的文件头
+        std::string MakeHeader() const;
+        //读出日志文件头的长度，魔数不符或文件头不完整时返回0
+        static std::size_t GetHeaderSize(const std::string& Data,
+            std::uint64_t* SizePtr, std::int64_t* TimePtr);
+        //把记录编码为带长度前缀的字节串
+        static void Encode(std::string& Buffer, const Record& Entry);
+        //解码一条记录的内容，格式错误时抛出文件格式异常
+        static Record Decode(const char* Cursor, const char* End);
+        //解析记录部分，返回完整记录所占的字节数
+        static std::size_t Parse(const std::string& Data, std::size_t Begin,
+            std::vector<Record>* Records, std::vector<std::uint64_t>* Offsets);
+        //取出偏移不小于From的编辑记录（跳过保存标记），返回它们的编码
+        static std::string KeepEdits(const std::vector<Record>& Records,
+            const std::vector<std::uint64_t>& Offsets, std::uint64_t From,
+            std::vector<Record>* Edits);
+        //写入编码后的记录，日志文件不存在时创建
+        bool Write(const std::string& Buffer);
+        //以原子方式用文件头和给定的记录重写日志，并重新以追加方式打开；
+        //没有记录时删除日志
+        void Rewrite(const std::string& Records);
+
+        std::string m_ModelPath;
+        std::string m_JournalPath;
+        std::ofstream m_File;
+        std::vector<Record> m_PendingRecords;
+        std::size_t m_RecordCount = 0;
+        std::size_t m_HeaderSize = 0;
+        std::uint64_t m_Size = 0;
+        std::uint64_t m_Generation = 0;
+        mutable std::mutex m_Mutex;
+};
+
+#endif // EDIT_JOURNAL_HPP
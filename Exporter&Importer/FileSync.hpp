@@ -0,0 +1,114 @@
+/*******************************************************************************
+【文件名】 FileSync.hpp
+【功能模块和目的】 定义FileSync类，把文件或目录项的修改刷新到磁盘，供原子保存与
+编辑日志共用
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 增添了MakeTempPath，为每次保存生成不重复的临时文件名
+*******************************************************************************/
+#ifndef FILE_SYNC_HPP
+#define FILE_SYNC_HPP
+
+#include <atomic>
+#include <filesystem>
+#include <string>
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#include <process.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+/*******************************************************************************
+【类名】 FileSync
+【功能】 磁盘同步工具类。流的flush与close只把数据交给操作系统，断电时仍可能丢失；
+重命名前需先同步临时文件，否则重命名可能先于数据落盘，留下被截断的目标文件
+【接口说明】
+    - static bool SyncFile(const std::string& Path)
+        把文件的内容刷新到磁盘
+    - static bool SyncParentDirectory(const std::string& Path)
+        把Path所在目录的目录项（如重命名的结果）刷新到磁盘
+    - static std::string MakeTempPath(const std::string& Path)
+        生成与Path同目录、本进程内不重复的临时文件路径
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 增添了MakeTempPath
+*******************************************************************************/
+class FileSync {
+    public:
+        /***********************************************************************
+        【函数名称】 SyncFile
+        【函数功能】 打开文件并等待其内容写入磁盘
+        【参数】
+            - const std::string& Path（输入参数）：文件路径
+        【返回值】 bool：是否同步成功
+        Created by 朱昊东 on 2026/10/18
+        【更改记录】 无
+        ***********************************************************************/
+        static bool SyncFile(const std::string& Path) {
+#ifdef _WIN32
+            int Descriptor = _open(Path.c_str(), _O_RDWR | _O_BINARY);
+            if (Descriptor < 0) {
+                return false;
+            }
+            bool IsSynced = _commit(Descriptor) == 0;
+            _close(Descriptor);
+#else
+            int Descriptor = open(Path.c_str(), O_RDONLY);
+            if (Descriptor < 0) {
+                return false;
+            }
+            bool IsSynced = fsync(Descriptor) == 0;
+            close(Descriptor);
+#endif
+            return IsSynced;
+        }
+
+        /***********************************************************************
+        【函数名称】 SyncParentDirectory
+        【函数功能】 等待Path所在目录的目录项写入磁盘；Windows不支持同步目录，
+        直接返回成功
+        【参数】
+            - const std::string& Path（输入参数）：目录中某个文件的路径
+        【返回值】 bool：是否同步成功
+        Created by 朱昊东 on 2026/10/18
+        【更改记录】 无
+        ***********************************************************************/
+        static bool SyncParentDirectory(const std::string& Path) {
+#ifdef _WIN32
+            (void)Path;
+            return true;
+#else
+            std::filesystem::path Parent
+                = std::filesystem::path(Path).parent_path();
+            return SyncFile(Parent.empty() ? "." : Parent.string());
+#endif
+        }
+
+        /***********************************************************************
+        【函数名称】 MakeTempPath
+        【函数功能】 在Path后附加进程号与递增序号作为临时文件路径；后台保存与
+        前台导出同一路径时各写各的临时文件，不会互相截断或重命名对方的文件
+        【参数】
+            - const std::string& Path（输入参数）：目标文件路径
+        【返回值】 std::string：临时文件路径，与目标文件位于同一目录
+        Created by 朱昊东 on 2026/10/18
+        【更改记录】 无
+        ***********************************************************************/
+        static std::string MakeTempPath(const std::string& Path) {
+            static std::atomic<unsigned long> Counter{0};
+#ifdef _WIN32
+            long ProcessId = _getpid();
+#else
+            long ProcessId = getpid();
+#endif
+            return Path + "." + std::to_string(ProcessId) + "."
+                + std::to_string(Counter++) + ".tmp";
+        }
+};
+
+#endif // FILE_SYNC_HPP
@@ -0,0 +1,97 @@
+/*******************************************************************************
+【文件名】 ImportProgress.hpp
+【功能模块和目的】 定义ImportProgress类，在导入线程与界面线程之间共享导入进度，
+并传递协作式的取消请求
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+#ifndef IMPORT_PROGRESS_HPP
+#define IMPORT_PROGRESS_HPP
+
+#include <atomic>
+#include <cstddef>
+#include "../Errors.hpp"
+
+/*******************************************************************************
+【类名】 ImportProgress
+【功能】 导入进度，所有成员均为原子量，可被多个线程同时读写
+【接口说明】
+    - void SetTotalBytes(std::size_t Bytes)
+        设置文件总字节数
+    - void Report(std::size_t Bytes, std::size_t Elements)
+        由导入器报告已读字节数与已解析的元素数（点、线、面）
+    - std::size_t GetBytesRead() const
+        获取已读字节数
+    - std::size_t GetTotalBytes() const
+        获取文件总字节数
+    - std::size_t GetElementsParsed() const
+        获取已解析的元素数
+    - double GetFraction() const
+        获取完成比例，范围[0, 1]
+    - void Cancel()
+        请求取消导入
+    - bool IsCancelled() const
+        是否已请求取消
+    - void ThrowIfCancelled() const
+        若已请求取消则抛出导入取消异常，供导入器定期调用
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+class ImportProgress {
+    public:
+        ImportProgress() = default;
+        ImportProgress(const ImportProgress& Other) = delete;
+        ImportProgress& operator=(const ImportProgress& Other) = delete;
+
+        void SetTotalBytes(std::size_t Bytes) {
+            m_TotalBytes.store(Bytes, std::memory_order_relaxed);
+        }
+
+        void Report(std::size_t Bytes, std::size_t Elements) {
+            m_BytesRead.store(Bytes, std::memory_order_relaxed);
+            m_ElementsParsed.store(Elements, std::memory_order_relaxed);
+        }
+
+        std::size_t GetBytesRead() const {
+            return m_BytesRead.load(std::memory_order_relaxed);
+        }
+
+        std::size_t GetTotalBytes() const {
+            return m_TotalBytes.load(std::memory_order_relaxed);
+        }
+
+        std::size_t GetElementsParsed() const {
+            return m_ElementsParsed.load(std::memory_order_relaxed);
+        }
+
+        double GetFraction() const {
+            std::size_t Total = GetTotalBytes();
+            if (Total == 0) {
+                return 0;
+            }
+            double Fraction = static_cast<double>(GetBytesRead()) / Total;
+            return Fraction > 1 ? 1 : Fraction;
+        }
+
+        void Cancel() {
+            m_Cancelled.store(true, std::memory_order_relaxed);
+        }
+
+        bool IsCancelled() const {
+            return m_Cancelled.load(std::memory_order_relaxed);
+        }
+
+        void ThrowIfCancelled() const {
+            if (IsCancelled()) {
+                throw ExceptionImportCancelled();
+            }
+        }
+
+    private:
+        std::atomic<std::size_t> m_BytesRead { 0 };
+        std::atomic<std::size_t> m_TotalBytes { 0 };
+        std::atomic<std::size_t> m_ElementsParsed { 0 };
+        std::atomic<bool> m_Cancelled { false };
+};
+
+#endif // IMPORT_PROGRESS_HPP
@@ -0,0 +1,485 @@
+/*******************************************************************************
+【文件名】 LazyObjFile.cpp
+【功能模块和目的】 实现LazyObjFile类，为.obj文件建立偏移索引并按需读取其中的
+点、线、面
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 旁路文件先写临时文件再重命名，载入时检查其结构
+    - 已构造的点按页缓存，缓存大小有上限
+*******************************************************************************/
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+#include "FileSync.hpp"
+#include "LazyObjFile.hpp"
+#include "VarintCodec.hpp"
+#include "../Errors.hpp"
+
+constexpr std::size_t LazyObjFile::PageSize;
+
+static const char IndexMagic[4] = { 'O', 'I', 'X', '1' };
+
+/*******************************************************************************
+【函数名称】 LazyObjFile
+【函数功能】 构造函数，旁路文件有效时直接载入索引，否则扫描.obj文件并写入旁路文件
+【参数】
+    - const std::string& Path（输入参数）：字符串，.obj文件路径
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+LazyObjFile::LazyObjFile(const std::string& Path): m_Path(Path) {
+    if (!CheckExtension(Path)) {
+        throw ExceptionFileExtension();
+    }
+    m_File.open(Path, std::ios::in | std::ios::binary);
+    if (!m_File.is_open()) {
+        throw ExceptionFileOpen();
+    }
+    std::error_code Error;
+    m_FileSize = std::filesystem::file_size(Path, Error);
+    m_FileTime = std::filesystem::last_write_time(Path, Error)
+        .time_since_epoch().count();
+    m_IndexReused = LoadIndex();
+    if (!m_IndexReused) {
+        Scan();
+        SaveIndex();
+    }
+}
+
+std::size_t LazyObjFile::GetPointCount() const {
+    return m_Points.Count;
+}
+
+std::size_t LazyObjFile::GetLineCount() const {
+    return m_Lines.Count;
+}
+
+std::size_t LazyObjFile::GetFaceCount() const {
+    return m_Faces.Count;
+}
+
+bool LazyObjFile::IsIndexReused() const {
+    return m_IndexReused;
+}
+
+std::size_t LazyObjFile::GetPagesRead() const {
+    return m_PagesRead;
+}
+
+/*******************************************************************************
+【函数名称】 CheckExtension
+【函数功能】 检查扩展名为.obj
+【参数】
+    - const std::string& Path（输入参数）：字符串，文件路径
+【返回值】 bool：扩展名是否正确
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+bool LazyObjFile::CheckExtension(const std::string& Path) {
+    const std::string extension = ".obj";
+    if (Path.length() >= extension.length()) {
+        return (0 == Path.compare(Path.length() - extension.length(),
+            extension.length(), extension));
+    } else {
+        return false;
+    }
+}
+
+/*******************************************************************************
+【函数名称】 Scan
+【函数功能】 以大块读取的方式扫描整个文件，只检查每行的首个非空白字符，记录各类
+记录每页的起始偏移和每个组的起始位置，不解析数值
+【参数】 无
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+void LazyObjFile::Scan() {
+    std::vector<std::uint64_t> GroupOffsets;
+    auto Register = [&](RecordIndex& Index, std::uint64_t Offset) {
+        if (Index.Count % PageSize == 0) {
+            Index.PageOffsets.push_back(Offset);
+        }
+        Index.Count++;
+    };
+
+    std::vector<char> Buffer(1 << 20);
+    std::uint64_t BufferOffset = 0;
+    std::uint64_t LineStart = 0;
+    bool AtLineStart = true;
+    bool SeekingKind = false;
+    m_File.clear();
+    m_File.seekg(0);
+    while (m_File.read(Buffer.data(), Buffer.size()) || m_File.gcount() > 0) {
+        std::size_t Length = static_cast<std::size_t>(m_File.gcount());
+        for (std::size_t i = 0; i < Length; i++) {
+            char Ch = Buffer[i];
+            if (Ch == '\n') {
+                AtLineStart = true;
+                SeekingKind = false;
+                continue;
+            }
+            if (AtLineStart) {
+                LineStart = BufferOffset + i;
+                AtLineStart = false;
+                SeekingKind = true;
+            }
+            if (!SeekingKind || Ch == ' ' || Ch == '\t' || Ch == '\r') {
+                continue;
+            }
+            SeekingKind = false;//每行只检查首个非空白字符
+            switch (Ch) {
+                case '#' : {
+                    break;
+                }
+                case 'g' : {
+                    GroupOffsets.push_back(LineStart);
+                    m_Groups.push_back(
+                        { "", m_Points.Count, m_Lines.Count, m_Faces.Count });
+                    break;
+                }
+                case 'v' : {
+                    Register(m_Points, LineStart);
+                    break;
+                }
+                case 'l' : {
+                    Register(m_Lines, LineStart);
+                    break;
+                }
+                case 'f' : {
+                    Register(m_Faces, LineStart);
+                    break;
+                }
+                default : {
+                    throw ExceptionFileFormat();
+                }
+            }
+        }
+        BufferOffset += Length;
+        if (Length < Buffer.size()) {
+            break;
+        }
+    }
+
+    for (std::size_t i = 0; i < GroupOffsets.size(); i++) {
+        m_File.clear();
+        m_File.seekg(GroupOffsets[i]);
+        std::string LineContent;
+        std::getline(m_File, LineContent);
+        std::size_t Start = LineContent.find('g') + 1;
+        if (Start < LineContent.size()) {
+            Start++;//与ObjImporter一致，跳过g后的一个字符
+        }
+        std::size_t End = LineContent.find_last_not_of("\r");
+        m_Groups[i].Name = (End == std::string::npos || End < Start)
+            ? "" : LineContent.substr(Start, End + 1 - Start);
+    }//组的数目很少，逐个回读组名
+}
+
+/*******************************************************************************
+【函数名称】 SaveIndex
+【函数功能】 将索引写入旁路文件，写入失败时忽略（下次重新扫描即可）
+【参数】 无
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 与AbstractExporter::Export相同，先写入临时文件并同步到磁盘，成功后再
+    重命名；任一步失败时删除临时文件，不会留下不完整的旁路文件
+*******************************************************************************/
+void LazyObjFile::SaveIndex() const {
+    std::string Buffer(IndexMagic, sizeof(IndexMagic));
+    VarintCodec::Write(Buffer, m_FileSize);
+    VarintCodec::Write(Buffer, VarintCodec::ZigZag(m_FileTime));
+    VarintCodec::Write(Buffer, PageSize);
+    for (const RecordIndex* Index: { &m_Points, &m_Lines, &m_Faces }) {
+        VarintCodec::Write(Buffer, Index->Count);
+        std::uint64_t Previous = 0;
+        for (std::uint64_t Offset: Index->PageOffsets) {
+            VarintCodec::Write(Buffer, Offset - Previous);
+            Previous = Offset;
+        }//偏移递增，存差值
+    }
+    VarintCodec::Write(Buffer, m_Groups.size());
+    for (const auto& G: m_Groups) {
+        VarintCodec::Write(Buffer, G.Name.size());
+        Buffer.append(G.Name);
+        VarintCodec::Write(Buffer, G.FirstPoint);
+        VarintCodec::Write(Buffer, G.FirstLine);
+        VarintCodec::Write(Buffer, G.FirstFace);
+    }
+    const std::string IndexPath = m_Path + ".idx";
+    const std::string TempPath = FileSync::MakeTempPath(IndexPath);
+    std::error_code Error;
+    std::ofstream File(TempPath,
+        std::ios::out | std::ios::trunc | std::ios::binary);
+    if (!File.is_open()) {
+        return;
+    }//例如目录只读
+    File.write(Buffer.data(), Buffer.size());
+    File.close();
+    if (File.fail() || !FileSync::SyncFile(TempPath)) {
+        std::filesystem::remove(TempPath, Error);
+        return;
+    }
+    std::filesystem::rename(TempPath, IndexPath, Error);
+    if (Error) {
+        std::filesystem::remove(TempPath, Error);
+        return;
+    }
+    FileSync::SyncParentDirectory(IndexPath);
+}
+
+/*******************************************************************************
+【函数名称】 LoadIndex
+【函数功能】 尝试从旁路文件读取索引
+【参数】 无
+【返回值】 bool：旁路文件存在、完好且与.obj文件的大小和修改时间一致时返回true
+Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 检查页数与组数不超过剩余字节数、页偏移递增且位于文件内、组的起始计数
+    递增且不超过总数、文件末尾没有多余字节，不符时视为损坏
+*******************************************************************************/
+bool LazyObjFile::LoadIndex() {
+    std::ifstream File(m_Path + ".idx", std::ios::in | std::ios::binary);
+    if (!File.is_open()) {
+        return false;
+    }
+    std::vector<char> Data(
+        (std::istreambuf_iterator<char>(File)),
+        std::istreambuf_iterator<char>());
+    const char* Cursor = Data.data();
+    const char* End = Data.data() + Data.size();
+    if (Data.size() < sizeof(IndexMagic)
+        || std::memcmp(Cursor, IndexMagic, sizeof(IndexMagic)) != 0) {
+        return false;
+    }
+    Cursor += sizeof(IndexMagic);
+    try {
+        if (VarintCodec::Read(Cursor, End) != m_FileSize
+            || VarintCodec::UnZigZag(VarintCodec::Read(Cursor, End))
+                != m_FileTime
+            || VarintCodec::Read(Cursor, End) != PageSize) {
+            return false;
+        }//.obj文件已被修改
+        for (RecordIndex* Index: { &m_Points, &m_Lines, &m_Faces }) {
+            Index->Count = VarintCodec::Read(Cursor, End);
+            std::size_t Pages = (Index->Count + PageSize - 1) / PageSize;
+            if (Pages > static_cast<std::size_t>(End - Cursor)) {
+                throw ExceptionFileFormat();
+            }//每页偏移至少占一个字节，避免按损坏的数目分配内存
+            Index->PageOffsets.resize(Pages);
+            std::uint64_t Offset = 0;
+            for (std::size_t i = 0; i < Pages; i++) {
+                std::uint64_t Delta = VarintCodec::Read(Cursor, End);
+                if ((i > 0 && Delta == 0) || Delta >= m_FileSize - Offset) {
+                    throw ExceptionFileFormat();
+                }
+                Offset += Delta;
+                Index->PageOffsets[i] = Offset;
+            }//偏移严格递增且位于文件内
+        }
+        std::size_t GroupCount = VarintCodec::Read(Cursor, End);
+        if (GroupCount > static_cast<std::size_t>(End - Cursor)) {
+            throw ExceptionFileFormat();
+        }
+        m_Groups.resize(GroupCount);
+        Group Previous{ "", 0, 0, 0 };
+        for (auto& G: m_Groups) {
+            std::uint64_t Length = VarintCodec::Read(Cursor, End);
+            if (Length > static_cast<std::uint64_t>(End - Cursor)) {
+                throw ExceptionFileFormat();
+            }
+            G.Name.assign(Cursor, Length);
+            Cursor += Length;
+            G.FirstPoint = VarintCodec::Read(Cursor, End);
+            G.FirstLine = VarintCodec::Read(Cursor, End);
+            G.FirstFace = VarintCodec::Read(Cursor, End);
+            if (G.FirstPoint < Previous.FirstPoint
+                || G.FirstLine < Previous.FirstLine
+                || G.FirstFace < Previous.FirstFace
+                || G.FirstPoint > m_Points.Count
+                || G.FirstLine > m_Lines.Count
+                || G.FirstFace > m_Faces.Count) {
+                throw ExceptionFileFormat();
+            }
+            Previous = G;
+        }//组按出现顺序排列，起始计数不减
+        if (Cursor != End) {
+            throw ExceptionFileFormat();
+        }
+    }
+    catch (ExceptionFileFormat) {
+        m_Points = RecordIndex();
+        m_Lines = RecordIndex();
+        m_Faces = RecordIndex();
+        m_Groups.clear();
+        return false;
+    }//旁路文件损坏，重新扫描
+    return true;
+}
+
+/*******************************************************************************
+【函数名称】 ReadPage
+【函数功能】 从页的起始偏移开始逐行读取，跳过其他类的记录，解析本页的Kind类记录
+【参数】
+    - char Kind（输入参数）：记录类型，'v'、'l'或'f'
+    - const RecordIndex& Index（输入参数）：该类记录的索引
+    - std::size_t Page（输入参数）：页号
+    - std::size_t Arity（输入参数）：每条记录的数值个数
+【返回值】 std::vector<T>：本页所有记录的数值，依次存放
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+template <typename T>
+std::vector<T> LazyObjFile::ReadPage(char Kind, const RecordIndex& Index,
+    std::size_t Page, std::size_t Arity) {
+    std::size_t Records = std::min(PageSize, Index.Count - Page * PageSize);
+    std::vector<T> Values;
+    Values.reserve(Records * Arity);
+    m_File.clear();
+    m_File.seekg(Index.PageOffsets[Page]);
+    std::string LineContent;
+    while (Values.size() < Records * Arity
+        && std::getline(m_File, LineContent)) {
+        const char* Cursor = LineContent.c_str();
+        while (*Cursor == ' ' || *Cursor == '\t') {
+            Cursor++;
+        }
+        if (*Cursor != Kind) {
+            continue;
+        }
+        Cursor++;
+        for (std::size_t i = 0; i < Arity; i++) {
+            char* Next = nullptr;
+            T Value = std::is_floating_point<T>::value
+                ? static_cast<T>(std::strtod(Cursor, &Next))
+                : static_cast<T>(std::strtoll(Cursor, &Next, 10));
+            if (Next == Cursor) {
+                throw ExceptionFileFormat();
+            }
+            Values.push_back(Value);
+            Cursor = Next;
+        }
+    }
+    if (Values.size() < Records * Arity) {
+        throw ExceptionFileFormat();
+    }//文件在建立索引后被截断
+    m_PagesRead++;
+    return Values;
+}
+
+/*******************************************************************************
+【函数名称】 GetPoint
+【函数功能】 获取第Index个点，只读取该点所在的页
+【参数】
+    - std::size_t Index（输入参数）：点的序号，从0开始
+【返回值】 std::shared_ptr<Point3D>：点对象
+Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 已构造的点按页存放在容量固定的PageCache中，不再无限增长；被淘汰的页
+    再次访问时重新构造点对象
+*******************************************************************************/
+std::shared_ptr<Point3D> LazyObjFile::GetPoint(std::size_t Index) {
+    if (Index >= m_Points.Count) {
+        throw ExceptionIndexOutOfBounds(Index);
+    }
+    std::size_t Page = Index / PageSize;
+    std::vector<std::shared_ptr<Point3D>>* Shared = m_Materialized.Find(Page);
+    if (Shared == nullptr) {
+        Shared = m_Materialized.Insert(Page,
+            std::vector<std::shared_ptr<Point3D>>(PageSize));
+    }
+    std::shared_ptr<Point3D>& P = (*Shared)[Index % PageSize];
+    if (P) {
+        return P;
+    }//已构造过的点直接复用，使相邻的面共享同一点对象
+    const std::vector<double>* Values = m_PointPages.Find(Page);
+    if (Values == nullptr) {
+        Values = m_PointPages.Insert(Page,
+            ReadPage<double>('v', m_Points, Page, 3));
+    }
+    P = std::make_shared<Point3D>(Values->data() + (Index % PageSize) * 3);
+    return P;
+}
+
+/*******************************************************************************
+【函数名称】 GetElementIndices
+【函数功能】 获取第Index条线或面记录中的点序号，并转换为从0开始
+【参数】
+    - char Kind（输入参数）：记录类型，'l'或'f'
+    - std::size_t Index（输入参数）：记录序号，从0开始
+【返回值】 const std::int64_t*：点序号数组，指向页缓存，下一次读页前有效
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+const std::int64_t* LazyObjFile::GetElementIndices(char Kind,
+    std::size_t Index) {
+    bool IsLine = Kind == 'l';
+    const RecordIndex& Records = IsLine ? m_Lines : m_Faces;
+    PageCache<std::int64_t>& Cache = IsLine ? m_LinePages : m_FacePages;
+    std::size_t Arity = IsLine ? 2 : 3;
+    if (Index >= Records.Count) {
+        throw ExceptionIndexOutOfBounds(Index);
+    }
+    std::size_t Page = Index / PageSize;
+    const std::vector<std::int64_t>* Values = Cache.Find(Page);
+    if (Values == nullptr) {
+        Values = Cache.Insert(Page,
+            ReadPage<std::int64_t>(Kind, Records, Page, Arity));
+    }
+    const std::int64_t* Indices = Values->data() + (Index % PageSize) * Arity;
+    for (std::size_t i = 0; i < Arity; i++) {
+        if (Indices[i] < 1
+            || static_cast<std::size_t>(Indices[i]) > m_Points.Count) {
+            throw ExceptionFileFormat();
+        }
+    }
+    return Indices;
+}
+
+/*******************************************************************************
+【函数名称】 GetLine
+【函数功能】 获取第Index条线，只读取该线及其点所在的页
+【参数】
+    - std::size_t Index（输入参数）：线的序号，从0开始
+【返回值】 std::shared_ptr<Line3D>：线对象
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+std::shared_ptr<Line3D> LazyObjFile::GetLine(std::size_t Index) {
+    const std::int64_t* Indices = GetElementIndices('l', Index);
+    std::size_t First = Indices[0] - 1;
+    std::size_t Second = Indices[1] - 1;
+    return std::make_shared<Line3D>(GetPoint(First), GetPoint(Second));
+}
+
+/*******************************************************************************
+【函数名称】 GetFace
+【函数功能】 获取第Index个面，只读取该面及其点所在的页
+【参数】
+    - std::size_t Index（输入参数）：面的序号，从0开始
+【返回值】 std::shared_ptr<Face3D>：面对象
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+std::shared_ptr<Face3D> LazyObjFile::GetFace(std::size_t Index) {
+    const std::int64_t* Indices = GetElementIndices('f', Index);
+    std::size_t First = Indices[0] - 1;
+    std::size_t Second = Indices[1] - 1;
+    std::size_t Third = Indices[2] - 1;
+    return std::make_shared<Face3D>(
+        GetPoint(First), GetPoint(Second), GetPoint(Third));
+}
@@ -0,0 +1,179 @@
+/*******************************************************************************
+【文件名】 LazyObjFile.hpp
+【功能模块和目的】 定义LazyObjFile类，为.obj文件建立偏移索引并按需读取其中的点、
+线、面，适用于只需访问大文件中少量元素的场合
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 已构造的点改为按页缓存，缓存大小有上限
+*******************************************************************************/
+#ifndef LAZY_OBJ_FILE_HPP
+#define LAZY_OBJ_FILE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "AbstractImporter.hpp"
+#include "../Models/Model.hpp"
+
+/*******************************************************************************
+【类名】 LazyObjFile
+【功能】 对.obj文件做一次快速扫描，记录每个组的起始偏移以及每PageSize个点、线、
+面记录所在页的起始偏移，并把索引保存在同名的.idx旁路文件中；之后按需只读取所需的页，
+将其中的记录解析为Point、Line、Face对象。旁路文件与.obj文件的大小或修改时间
+不符、或内容不完整时会重新扫描
+【接口说明】
+    - LazyObjFile(const std::string& Path)
+        构造函数，载入或建立索引；扩展名错误、无法打开或格式错误时抛出相应异常
+    - static constexpr std::size_t PageSize
+        每页包含的记录数
+    - struct Group
+        组信息：名称及组开始时已出现的点、线、面数目
+    - const std::string& Path
+        .obj文件路径
+    - const std::vector<Group>& Groups
+        所有组
+    - std::size_t GetPointCount() const
+        点的总数
+    - std::size_t GetLineCount() const
+        线的总数
+    - std::size_t GetFaceCount() const
+        面的总数
+    - bool IsIndexReused() const
+        索引是否直接取自旁路文件
+    - std::size_t GetPagesRead() const
+        迄今从.obj文件读取的页数
+    - std::shared_ptr<Point3D> GetPoint(std::size_t Index)
+        获取第Index个点（从0开始），所在页仍在缓存中时多次获取得到同一对象
+    - std::shared_ptr<Line3D> GetLine(std::size_t Index)
+        获取第Index条线（从0开始）
+    - std::shared_ptr<Face3D> GetFace(std::size_t Index)
+        获取第Index个面（从0开始）
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 已构造的点由无上限的散列表改为PageCache，最多保留Capacity页
+*******************************************************************************/
+class LazyObjFile {
+    public:
+        static constexpr std::size_t PageSize = 1024;
+
+        struct Group {
+            std::string Name;
+            std::size_t FirstPoint;
+            std::size_t FirstLine;
+            std::size_t FirstFace;
+        };
+
+        explicit LazyObjFile(const std::string& Path);
+        LazyObjFile(const LazyObjFile& Other) = delete;
+        LazyObjFile& operator=(const LazyObjFile& Other) = delete;
+
+        const std::string& Path { m_Path };
+        const std::vector<Group>& Groups { m_Groups };
+
+        std::size_t GetPointCount() const;
+        std::size_t GetLineCount() const;
+        std::size_t GetFaceCount() const;
+        bool IsIndexReused() const;
+        std::size_t GetPagesRead() const;
+
+        //按需获取点
+        std::shared_ptr<Point3D> GetPoint(std::size_t Index);
+        //按需获取线
+        std::shared_ptr<Line3D> GetLine(std::size_t Index);
+        //按需获取面
+        std::shared_ptr<Face3D> GetFace(std::size_t Index);
+
+    private:
+        /***********************************************************************
+        【类名】 RecordIndex
+        【功能】 某一类记录（点、线或面）的总数及每页的起始偏移
+        Created by 朱昊东 on 2026/10/18
+        【更改记录】 无
+        ***********************************************************************/
+        struct RecordIndex {
+            std::size_t Count = 0;
+            std::vector<std::uint64_t> PageOffsets;
+        };
+
+        /***********************************************************************
+        【类名】 PageCache
+        【功能】 容量固定的最近最少使用页缓存，每页存放解析后的数值
+        Created by 朱昊东 on 2026/10/18
+        【更改记录】 
+            2026/10/18
+            - Find与Insert返回可修改的页，供按页缓存已构造的点
+        ***********************************************************************/
+        template <typename T>
+        class PageCache {
+            public:
+                static constexpr std::size_t Capacity = 64;
+
+                //查找页，不存在时返回空指针
+                std::vector<T>* Find(std::size_t Page) {
+                    auto It = m_Pages.find(Page);
+                    if (It == m_Pages.end()) {
+                        return nullptr;
+                    }
+                    m_Order.splice(m_Order.begin(), m_Order, It->second.second);
+                    return &It->second.first;
+                }
+
+                //放入页，超出容量时淘汰最久未用的页
+                std::vector<T>* Insert(std::size_t Page,
+                    std::vector<T>&& Values) {
+                    if (m_Pages.size() >= Capacity) {
+                        m_Pages.erase(m_Order.back());
+                        m_Order.pop_back();
+                    }
+                    m_Order.push_front(Page);
+                    auto& Entry = m_Pages[Page];
+                    Entry.first = std::move(Values);
+                    Entry.second = m_Order.begin();
+                    return &Entry.first;
+                }
+
+            private:
+                std::list<std::size_t> m_Order;
+                std::unordered_map<std::size_t, std::pair<std::vector<T>,
+                    std::list<std::size_t>::iterator>> m_Pages;
+        };
+
+        //检查扩展名为.obj
+        static bool CheckExtension(const std::string& Path);
+        //尝试从旁路文件读取索引
+        bool LoadIndex();
+        //扫描.obj文件建立索引
+        void Scan();
+        //将索引写入旁路文件
+        void SaveIndex() const;
+        //读取Kind类记录的第Page页，每条记录取Arity个数值
+        template <typename T>
+        std::vector<T> ReadPage(char Kind, const RecordIndex& Index,
+            std::size_t Page, std::size_t Arity);
+        //获取第Index条线或面记录的点序号（从0开始）
+        const std::int64_t* GetElementIndices(char Kind, std::size_t Index);
+
+        std::string m_Path;
+        std::uint64_t m_FileSize = 0;
+        std::int64_t m_FileTime = 0;
+        bool m_IndexReused = false;
+        std::size_t m_PagesRead = 0;
+        std::ifstream m_File;
+        RecordIndex m_Points;
+        RecordIndex m_Lines;
+        RecordIndex m_Faces;
+        std::vector<Group> m_Groups;
+        PageCache<double> m_PointPages;
+        PageCache<std::int64_t> m_LinePages;
+        PageCache<std::int64_t> m_FacePages;
+        PageCache<std::shared_ptr<Point3D>> m_Materialized;
+};
+
+#endif // LAZY_OBJ_FILE_HPP
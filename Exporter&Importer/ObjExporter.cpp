@@ -5,11 +5,19 @@
 【更改记录】 
     2024/7/28 朱昊东
     - 修复了Save函数中输出模型的起始序号应该为1的问题
+    2026/10/18
+    - 重写了Save函数，使用哈希表查找点的序号、缓冲写出和最短往返浮点格式
+    - 增添了构造函数与FormatRecords，大模型由TextPipeline并行格式化
+    - Save支持导出时焊接重合的点
 *******************************************************************************/
+#include <algorithm>
+#include <charconv>
 #include <fstream>
 #include <filesystem>
 #include <string>
 #include "ObjExporter.hpp"
+#include "TextPipeline.hpp"
+#include "../Models/IndexedModel.hpp"
 #include "../Models/Model.hpp"
 
 /*******************************************************************************
@@ -31,6 +39,99 @@ bool ObjExporter::CheckExtension(std::string Path) const {
     }
 }
 
+/*******************************************************************************
+【函数名称】 AppendNumber
+【函数功能】 以最短且可无损往返的形式将浮点数追加到缓冲区
+【参数】 
+    - std::string& Buffer（输入输出参数）：缓冲区
+    - double Value（输入参数）：浮点数
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+void ObjExporter::AppendNumber(std::string& Buffer, double Value) {
+    char Digits[32];
+    auto Result = std::to_chars(Digits, Digits + sizeof(Digits), Value);
+    Buffer.append(Digits, Result.ptr);
+}
+
+/*******************************************************************************
+【函数名称】 AppendNumber
+【函数功能】 将整数追加到缓冲区
+【参数】 
+    - std::string& Buffer（输入输出参数）：缓冲区
+    - std::size_t Value（输入参数）：整数
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+void ObjExporter::AppendNumber(std::string& Buffer, std::size_t Value) {
+    char Digits[24];
+    auto Result = std::to_chars(Digits, Digits + sizeof(Digits), Value);
+    Buffer.append(Digits, Result.ptr);
+}
+
+/*******************************************************************************
+【函数名称】 ObjExporter
+【函数功能】 构造函数
+【参数】 
+    - std::size_t WorkerCount（输入参数）：格式化线程数，为0时取硬件线程数，
+    为1时按顺序格式化
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+ObjExporter::ObjExporter(std::size_t WorkerCount): m_WorkerCount(
+    WorkerCount == 0 ? TextPipeline::GetDefaultWorkerCount() : WorkerCount) {
+}
+
+/*******************************************************************************
+【函数名称】 FormatRecords
+【函数功能】 格式化第First到第Last-1条记录。记录依次为全部点、全部线、全部面
+【参数】 
+    - const IndexedModel<3>& Indexed（输入参数）：模型的索引视图
+    - std::size_t First（输入参数）：起始记录号
+    - std::size_t Last（输入参数）：结束记录号（不含）
+    - std::string& Buffer（输入输出参数）：缓冲区
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+void ObjExporter::FormatRecords(const IndexedModel<3>& Indexed,
+    std::size_t First, std::size_t Last, std::string& Buffer) {
+    const auto& Points = Indexed.Points;
+    const auto& LineIndices = Indexed.LineIndices;
+    const auto& FaceIndices = Indexed.FaceIndices;
+    std::size_t LineBegin = Points.size();
+    std::size_t FaceBegin = LineBegin + LineIndices.size() / 2;
+    for (std::size_t Record = First; Record < Last; Record++) {
+        if (Record < LineBegin) {
+            Buffer += "v ";
+            for (int i = 0; i < 3; i++) {
+                Buffer += ' ';
+                AppendNumber(Buffer, Points[Record]->GetCoordinate(i));
+            }
+        }//点，顺序与CollectPoints一致
+        else if (Record < FaceBegin) {
+            std::size_t Base = (Record - LineBegin) * 2;
+            Buffer += "l  ";
+            AppendNumber(Buffer, LineIndices[Base] + 1);
+            Buffer += ' ';
+            AppendNumber(Buffer, LineIndices[Base + 1] + 1);
+        }
+        else {
+            std::size_t Base = (Record - FaceBegin) * 3;
+            Buffer += "f  ";
+            AppendNumber(Buffer, FaceIndices[Base] + 1);
+            Buffer += ' ';
+            AppendNumber(Buffer, FaceIndices[Base + 1] + 1);
+            Buffer += ' ';
+            AppendNumber(Buffer, FaceIndices[Base + 2] + 1);
+        }//序号从1开始
+        Buffer += '\n';
+    }
+}
+
 /*******************************************************************************
 【函数名称】 Save
 【函数功能】 保存模型
@@ -42,37 +143,37 @@ Created by 朱昊东 on 2024/7/26
 【更改记录】 
     2024/7/28 朱昊东
     - 修复了输出模型的起始序号应该为1的问题
+    2026/10/18
+    - 改用IndexedModel的哈希表查找点的序号，由O(F·V)降为O(F+V)
+    - 先写入用户态缓冲区，攒满一块后整块写入文件，不再逐行刷新
+    - 浮点数改用最短往返格式，导出后重新导入的坐标与原坐标完全相同
+    - 记录多于一块且线程数大于1时，交给TextPipeline并行格式化
+    - 开启焊接时，建立索引的同时合并重合的点
+    - 线和面按序号而不是存储顺序写入
 *******************************************************************************/
 void ObjExporter::Save(std::ofstream& File, const Model3D& Model) const {
-    File << "g " << Model.Name << std::endl;//输出模型名
-    for (auto Point: Model.CollectPoints()) {
-        File << "v ";
-        for (int i = 0; i < 3; i++) {
-            File << " " << Point->GetCoordinate(i); 
-        }
-        File << std::endl;
-    }//输出点
-
-    std::vector<std::shared_ptr<Point<3>>> Points = Model.CollectPoints();
-    auto FindPointIndex = [&Points](const std::shared_ptr<Point<3>> Point)
-        -> int {
-        auto it = std::find(Points.begin(), Points.end(), Point);
-        if (it != Points.end()) {
-            return std::distance(Points.begin(), it) + 1;
-        }
-        return -1; // 如果没有找到，返回 -1
-    };//查找point在points中的序号
+    IndexedModel<3> Indexed(Model, IsWeldingPoints(), true);
+    std::size_t Count = Indexed.Points.size()
+        + Indexed.LineIndices.size() / 2 + Indexed.FaceIndices.size() / 3;
+    auto Format = [&Indexed](std::size_t First, std::size_t Last,
+        std::string& Buffer) {
+        FormatRecords(Indexed, First, Last, Buffer);
+    };
 
-    for (auto Line: Model.Lines) {
-        File << "l  ";
-        File << FindPointIndex(Line->First) << " ";
-        File << FindPointIndex(Line->Second) << std::endl;
-    }
-    for (auto Face: Model.Faces) {
-        File << "f  ";
-        File << FindPointIndex(Face->First) << " ";
-        File << FindPointIndex(Face->Second) << " ";
-        File << FindPointIndex(Face->Third) << std::endl;
+    std::string Buffer;
+    Buffer += "g ";
+    Buffer += Model.Name;
+    Buffer += '\n';//输出模型名
+    if (m_WorkerCount > 1 && Count > ChunkSize) {
+        File.write(Buffer.data(), Buffer.size());
+        TextPipeline Pipeline(m_WorkerCount);
+        Pipeline.Run(File, Count, ChunkSize, Format);
+        return;
     }
-    File.close();
+    for (std::size_t First = 0; First < Count; First += ChunkSize) {
+        Format(First, std::min(Count, First + ChunkSize), Buffer);
+        File.write(Buffer.data(), Buffer.size());
+        Buffer.clear();
+    }//按顺序格式化，与并行结果逐字节相同
+    File.write(Buffer.data(), Buffer.size());
 }
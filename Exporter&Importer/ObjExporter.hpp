@@ -2,33 +2,67 @@
 【文件名】 ObjExporter.hpp
 【功能模块和目的】 定义ObjExporter类，用于导出.obj文件，
  Created by 朱昊东 on 2024/7/27
-【更改记录】 无
+【更改记录】 
+    2026/10/18
+    - 增添了数值格式化函数AppendNumber
+    - 增添了可指定格式化线程数的构造函数
 *******************************************************************************/
 #ifndef OBJ_EXPORTER_HPP
 #define OBJ_EXPORTER_HPP
 
+#include <cstddef>
 #include <string>
 #include "AbstractExporter.hpp"
+#include "../Models/IndexedModel.hpp"
 #include "../Models/Model.hpp"
 
 /*******************************************************************************
 【类名】 ObjExporter
 【功能】 ObjExporter类，用于导出模型到.obj文件
 【接口说明】
+    - ObjExporter(std::size_t WorkerCount = 0)
+        构造函数，WorkerCount为格式化线程数，0表示取硬件线程数，1表示按顺序格式化
+    - static constexpr std::size_t ChunkSize
+        每个格式化块包含的记录数
     - bool CheckExtension(std::string Path) const override
         检查扩展名为.obj
     - void Save(std::ofstream& File, const Model3D& Model) const override
         保存模型
+    - static void AppendNumber(std::string& Buffer, double Value)
+        以最短往返格式追加浮点数
+    - static void AppendNumber(std::string& Buffer, std::size_t Value)
+        追加整数
+    - static void FormatRecords(const IndexedModel<3>& Indexed,
+        std::size_t First, std::size_t Last, std::string& Buffer)
+        格式化一段连续的点、线、面记录
  Created by 朱昊东 on 2024/7/27
    
-【更改记录】 无
+【更改记录】 
+    2026/10/18
+    - 增添了AppendNumber
+    - 增添了构造函数、ChunkSize与FormatRecords
 *******************************************************************************/
 class ObjExporter: public AbstractExporter {
+    public:
+        static constexpr std::size_t ChunkSize = 16384;
+
+        explicit ObjExporter(std::size_t WorkerCount = 0);
+
     protected:
         //检查扩展名
         bool CheckExtension(std::string Path) const override;
         //保存模型s
         void Save(std::ofstream& File, const Model3D& Model) const override;
+        //以最短往返格式追加浮点数
+        static void AppendNumber(std::string& Buffer, double Value);
+        //追加整数
+        static void AppendNumber(std::string& Buffer, std::size_t Value);
+        //格式化一段连续的记录
+        static void FormatRecords(const IndexedModel<3>& Indexed,
+            std::size_t First, std::size_t Last, std::string& Buffer);
+
+    private:
+        std::size_t m_WorkerCount;
 };
 
 #endif // OBJ_EXPORTER_HPP
\ No newline at end of file
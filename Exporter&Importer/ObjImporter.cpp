@@ -2,7 +2,9 @@
 【文件名】 ObjImporter.cpp
 【功能模块和目的】 实现ObjImporter类，用于导入.obj文件，
  Created by 朱昊东 on 2024/7/27
-【更改记录】 无
+【更改记录】 
+    2026/10/18
+    - Load增添了导入进度参数，定期报告进度并响应取消请求
 *******************************************************************************/
 #include <filesystem>
 #include <fstream>
@@ -37,15 +39,28 @@ bool ObjImporter::CheckExtension(std::string path) const {
 【参数】 
     - std::ifstream& file（输入参数）：文件流对象
     - const Model3D& model（输入参数）：Model3D对象，三维模型
+    - ImportProgress& Progress（输入输出参数）：导入进度
 【返回值】 无
 Created by 朱昊东 on 2024/7/26
-【更改记录】 无
+【更改记录】 
+    2026/10/18
+    - 每读入ReportInterval行报告一次进度，并检查是否已请求取消
 *******************************************************************************/
-void ObjImporter::Load(std::ifstream &file, Model3D& model) const {
+void ObjImporter::Load(std::ifstream &file, Model3D& model,
+    ImportProgress& Progress) const {
+    const std::size_t ReportInterval = 4096;
     std::vector<std::shared_ptr<Point3D>> Points;
+    std::size_t BytesRead = 0;
+    std::size_t LinesRead = 0;
+    std::size_t Elements = 0;
     while (!file.eof()) {
         std::string LineContent;
         std::getline(file, LineContent);
+        BytesRead += LineContent.length() + 1;
+        if (++LinesRead % ReportInterval == 0) {
+            Progress.Report(BytesRead, Elements);
+            Progress.ThrowIfCancelled();
+        }
         if (LineContent.length() == 0) continue;
         std::istringstream Stream(LineContent);
         char Kind;
@@ -65,18 +80,21 @@ void ObjImporter::Load(std::ifstream &file, Model3D& model) const {
                 double Coords[3] = {0};
                 Stream >> Coords[0] >> Coords[1] >> Coords[2];
                 Points.push_back(std::shared_ptr<Point3D>(new Point3D(Coords)));
+                Elements++;
                 break;
             }
             case 'l' : {
                 int Indices[2] = {0};
                 Stream >> Indices[0] >> Indices[1];
                 model.AddLineUnchecked(Line3D(Points[Indices[0]-1], Points[Indices[1]-1]));
+                Elements++;
                 break;
             }
             case 'f' : {
                 int Indices[3] = {0};
                 Stream >> Indices[0] >> Indices[1] >> Indices[2];
                 model.AddFaceUnchecked(Face3D(Points[Indices[0]-1], Points[Indices[1]-1], Points[Indices[2]-1]));
+                Elements++;
                 break;
             }
             default : {
@@ -84,4 +102,5 @@ void ObjImporter::Load(std::ifstream &file, Model3D& model) const {
             }
         }
     }
+    Progress.Report(Progress.GetTotalBytes(), Elements);
 }
\ No newline at end of file
@@ -2,7 +2,9 @@
 【文件名】 ObjImporter.hpp
 【功能模块和目的】 实现ObjImporter类，用于导入.obj文件
  Created by 朱昊东 on 2024/7/27
-【更改记录】 无
+【更改记录】 
+    2026/10/18
+    - Load增添了导入进度参数
 *******************************************************************************/
 #ifndef OBJ_IMPORTER_HPP
 #define OBJ_IMPORTER_HPP
@@ -18,18 +20,22 @@
 【接口说明】
     - bool CheckExtension(std::string Path) const override
         检查扩展名为.obj
-    - void Load(std::ifstream& File, Model3D& Model) const override
+    - void Load(std::ifstream& File, Model3D& Model,
+        ImportProgress& Progress) const override
         加载模型
  Created by 朱昊东 on 2024/7/27
    
-【更改记录】 无
+【更改记录】 
+    2026/10/18
+    - Load增添了导入进度参数
 *******************************************************************************/
 class ObjImporter: public AbstractImporter {
     protected:
         //检查扩展名
         bool CheckExtension(std::string Path) const override;
         //加载模型
-        void Load(std::ifstream& File, Model3D& Model) const override;
+        void Load(std::ifstream& File, Model3D& Model,
+            ImportProgress& Progress) const override;
 };
 
 #endif // OBJ_IMPORTER_HPP
\ No newline at end of file
@@ -0,0 +1,78 @@
+/*******************************************************************************
+【文件名】 PointListImporter.cpp
+【功能模块和目的】 实现PointListImporter类，逐行解析点的坐标
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include "PointListImporter.hpp"
+#include "../Errors.hpp"
+
+/*******************************************************************************
+【函数名称】 Import
+【函数功能】 读入整个文件后逐行解析：跳过行首空白与可选的"v"，用strtod依次读出
+三个数，其后只允许空白
+【参数】
+    - std::string Path（输入参数）：字符串，文件路径
+【返回值】 std::vector<double>：各点的x、y、z坐标
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+std::vector<double> PointListImporter::Import(std::string Path) const {
+    std::ifstream File(Path, std::ios::in | std::ios::binary);
+    if (!File.is_open()) {
+        throw ExceptionFileOpen();
+    }
+    std::string Content((std::istreambuf_iterator<char>(File)),
+        std::istreambuf_iterator<char>());
+    if (File.bad()) {
+        throw ExceptionFileOpen();
+    }
+
+    auto IsBlank = [](char Character) {
+        return Character == ' ' || Character == '\t' || Character == '\r';
+    };
+    std::vector<double> Coordinates;
+    const char* Cursor = Content.c_str();
+    const char* End = Cursor + Content.size();
+    while (Cursor < End) {
+        while (Cursor < End && IsBlank(*Cursor)) {
+            Cursor++;
+        }
+        if (Cursor < End && *Cursor == 'v' && Cursor + 1 < End
+            && IsBlank(Cursor[1])) {
+            Cursor++;
+        }
+        if (Cursor < End && *Cursor != '\n' && *Cursor != '#') {
+            for (int i = 0; i < 3; i++) {
+                char* Next = nullptr;
+                double Value = std::strtod(Cursor, &Next);
+                if (Next == Cursor) {
+                    throw ExceptionFileFormat();
+                }
+                for (const char* p = Cursor; p < Next; p++) {
+                    if (*p == '\n') {
+                        throw ExceptionFileFormat();
+                    }
+                }//strtod会跳过换行，不允许一个点跨行
+                Coordinates.push_back(Value);
+                Cursor = Next;
+            }
+            while (Cursor < End && IsBlank(*Cursor)) {
+                Cursor++;
+            }
+            if (Cursor < End && *Cursor != '\n') {
+                throw ExceptionFileFormat();
+            }
+        }
+        while (Cursor < End && *Cursor != '\n') {
+            Cursor++;
+        }//跳过注释行的其余部分
+        Cursor++;
+    }
+    return Coordinates;
+}
@@ -0,0 +1,31 @@
+/*******************************************************************************
+【文件名】 PointListImporter.hpp
+【功能模块和目的】 定义PointListImporter类，用于从文本文件读入一组点的坐标
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+#ifndef POINT_LIST_IMPORTER_HPP
+#define POINT_LIST_IMPORTER_HPP
+
+#include <string>
+#include <vector>
+
+/*******************************************************************************
+【类名】 PointListImporter
+【功能】 PointListImporter类，读入每行一个点的文本文件：每行为空格分隔的x、y、z
+三个坐标，可以带.obj文件中的"v"前缀；空行与以#开头的行被忽略。整个文件一次读入
+内存后逐行解析，适合数以百万计的查询点
+【接口说明】
+    - std::vector<double> Import(std::string Path) const
+        依次返回各点的x、y、z坐标；无法打开时抛出ExceptionFileOpen，某行不是
+        三个数时抛出ExceptionFileFormat
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+class PointListImporter {
+    public:
+        //读入点的坐标
+        std::vector<double> Import(std::string Path) const;
+};
+
+#endif // POINT_LIST_IMPORTER_HPP
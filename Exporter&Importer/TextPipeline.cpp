@@ -0,0 +1,152 @@
+/*******************************************************************************
+【文件名】 TextPipeline.cpp
+【功能模块和目的】 实现TextPipeline类，并行格式化文本块并按顺序写出
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "TextPipeline.hpp"
+
+/*******************************************************************************
+【函数名称】 TextPipeline
+【函数功能】 构造函数
+【参数】
+    - std::size_t WorkerCount（输入参数）：工作线程数，为0时取默认值
+    - std::size_t SlotCount（输入参数）：槽位数，为0时取工作线程数的2倍
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+TextPipeline::TextPipeline(std::size_t WorkerCount, std::size_t SlotCount):
+    m_WorkerCount(WorkerCount == 0 ? GetDefaultWorkerCount() : WorkerCount),
+    m_SlotCount(SlotCount) {
+    if (m_SlotCount < m_WorkerCount) {
+        m_SlotCount = m_WorkerCount * 2;
+    }//槽位少于工作线程时多余的线程只能空等
+}
+
+/*******************************************************************************
+【函数名称】 GetDefaultWorkerCount
+【函数功能】 获取默认的工作线程数，即硬件线程数，无法获取时为1
+【参数】 无
+【返回值】 std::size_t：工作线程数
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+std::size_t TextPipeline::GetDefaultWorkerCount() {
+    return std::max<std::size_t>(1, std::thread::hardware_concurrency());
+}
+
+/*******************************************************************************
+【函数名称】 Run
+【函数功能】 把Count条记录按ChunkSize切块，由工作线程并行格式化，调用线程按块号
+顺序写入Output
+【参数】
+    - std::ostream& Output（输入参数）：输出流
+    - std::size_t Count（输入参数）：记录总数
+    - std::size_t ChunkSize（输入参数）：每块的记录数
+    - const Formatter& Format（输入参数）：格式化函数，会被多个线程同时调用，
+    只能写入传给它的Buffer
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+void TextPipeline::Run(std::ostream& Output, std::size_t Count,
+    std::size_t ChunkSize, const Formatter& Format) const {
+    ChunkSize = std::max<std::size_t>(1, ChunkSize);
+    std::size_t ChunkCount = (Count + ChunkSize - 1) / ChunkSize;
+    if (ChunkCount == 0) {
+        return;
+    }
+
+    struct Slot {
+        std::string Buffer;
+        bool IsReady = false;
+    };
+    std::vector<Slot> Slots(m_SlotCount);
+    std::mutex Mutex;
+    std::condition_variable SlotFreed;
+    std::condition_variable SlotReady;
+    std::size_t NextChunk = 0;//下一个待领取的块号
+    std::size_t Written = 0;//已写出的块数
+    std::exception_ptr Error;
+
+    auto Work = [&]() {
+        for (;;) {
+            std::size_t Chunk;
+            {
+                std::unique_lock<std::mutex> Lock(Mutex);
+                if (NextChunk >= ChunkCount || Error) {
+                    return;
+                }
+                Chunk = NextChunk++;
+                SlotFreed.wait(Lock, [&]() {
+                    return Chunk < Written + m_SlotCount || Error;
+                });//槽位仍被未写出的块占用
+                if (Error) {
+                    return;
+                }
+            }
+            Slot& Target = Slots[Chunk % m_SlotCount];
+            try {
+                Target.Buffer.clear();
+                std::size_t First = Chunk * ChunkSize;
+                Format(First, std::min(Count, First + ChunkSize),
+                    Target.Buffer);
+            }
+            catch (...) {
+                std::lock_guard<std::mutex> Lock(Mutex);
+                if (!Error) {
+                    Error = std::current_exception();
+                }
+                SlotReady.notify_all();
+                SlotFreed.notify_all();
+                return;
+            }
+            {
+                std::lock_guard<std::mutex> Lock(Mutex);
+                Target.IsReady = true;
+            }
+            SlotReady.notify_all();
+        }
+    };
+
+    std::vector<std::thread> Workers;
+    std::size_t ThreadCount = std::min(m_WorkerCount, ChunkCount);
+    for (std::size_t i = 0; i < ThreadCount; i++) {
+        Workers.emplace_back(Work);
+    }
+    while (Written < ChunkCount) {
+        Slot& Target = Slots[Written % m_SlotCount];
+        {
+            std::unique_lock<std::mutex> Lock(Mutex);
+            SlotReady.wait(Lock, [&]() {
+                return Target.IsReady || Error;
+            });
+            if (Error) {
+                break;
+            }
+        }
+        Output.write(Target.Buffer.data(), Target.Buffer.size());
+        {
+            std::lock_guard<std::mutex> Lock(Mutex);
+            Target.IsReady = false;
+            Written++;
+        }
+        SlotFreed.notify_all();
+    }//按块号顺序写出，工作线程不会在写出期间改动该槽位
+    for (auto& Worker: Workers) {
+        Worker.join();
+    }
+    if (Error) {
+        std::rethrow_exception(Error);
+    }
+}
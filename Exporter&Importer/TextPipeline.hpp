@@ -0,0 +1,63 @@
+/*******************************************************************************
+【文件名】 TextPipeline.hpp
+【功能模块和目的】 定义TextPipeline类，由多个工作线程并行地把记录格式化为文本块，
+再由调用线程按顺序写入输出流，供文本格式的导出器共用
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+#ifndef TEXT_PIPELINE_HPP
+#define TEXT_PIPELINE_HPP
+
+#include <cstddef>
+#include <functional>
+#include <ostream>
+#include <string>
+
+/*******************************************************************************
+【类名】 TextPipeline
+【功能】 有界的并行格式化流水线。记录按ChunkSize切分为块，工作线程依次领取块号，
+把块格式化到环形缓冲区中对应的槽位；调用线程按块号顺序把槽位写入输出流并释放槽位。
+槽位数固定，领先写出位置过多的工作线程会等待，因此内存占用不超过
+SlotCount个块；输出与单线程按顺序格式化的结果逐字节相同
+【接口说明】
+    - using Formatter
+        格式化函数，把第First到第Last-1条记录追加到Buffer
+    - TextPipeline(std::size_t WorkerCount = 0, std::size_t SlotCount = 0)
+        构造函数，WorkerCount为0时取硬件线程数，SlotCount为0时取工作线程数的2倍
+    - static std::size_t GetDefaultWorkerCount()
+        默认的工作线程数
+    - const std::size_t& WorkerCount
+        工作线程数
+    - const std::size_t& SlotCount
+        环形缓冲区的槽位数
+    - void Run(std::ostream& Output, std::size_t Count, std::size_t ChunkSize,
+        const Formatter& Format) const
+        格式化并写出Count条记录；格式化函数抛出的异常会在所有线程结束后重新抛出
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+class TextPipeline {
+    public:
+        using Formatter = std::function<
+            void(std::size_t First, std::size_t Last, std::string& Buffer)>;
+
+        explicit TextPipeline(std::size_t WorkerCount = 0,
+            std::size_t SlotCount = 0);
+        TextPipeline(const TextPipeline& Other) = delete;
+        TextPipeline& operator=(const TextPipeline& Other) = delete;
+
+        static std::size_t GetDefaultWorkerCount();
+
+        const std::size_t& WorkerCount { m_WorkerCount };
+        const std::size_t& SlotCount { m_SlotCount };
+
+        //并行格式化并按顺序写出
+        void Run(std::ostream& Output, std::size_t Count,
+            std::size_t ChunkSize, const Formatter& Format) const;
+
+    private:
+        std::size_t m_WorkerCount;
+        std::size_t m_SlotCount;
+};
+
+#endif // TEXT_PIPELINE_HPP
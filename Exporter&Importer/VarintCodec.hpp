@@ -0,0 +1,87 @@
+/*******************************************************************************
+【文件名】 VarintCodec.hpp
+【功能模块和目的】 定义VarintCodec类，提供变长整数（varint）与ZigZag编码，
+供压缩模型格式的编码器与解码器共用
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+#ifndef VARINT_CODEC_HPP
+#define VARINT_CODEC_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include "../Errors.hpp"
+
+/*******************************************************************************
+【类名】 VarintCodec
+【功能】 变长整数编解码工具类，每字节低7位存数据，最高位表示后续是否还有字节
+【接口说明】
+    - static std::uint64_t ZigZag(std::int64_t Value)
+        将有符号整数映射为无符号整数，使绝对值小的数编码更短
+    - static std::int64_t UnZigZag(std::uint64_t Value)
+        ZigZag的逆变换
+    - static void Write(std::string& Buffer, std::uint64_t Value)
+        向缓冲区追加一个varint
+    - static std::uint64_t Read(const char*& Cursor, const char* End)
+        从缓冲区读取一个varint，越界时抛出文件格式异常
+    - static void WriteDouble(std::string& Buffer, double Value)
+        以8字节原样追加一个double
+    - static double ReadDouble(const char*& Cursor, const char* End)
+        读取8字节原样存放的double
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+class VarintCodec {
+    public:
+        static std::uint64_t ZigZag(std::int64_t Value) {
+            return (static_cast<std::uint64_t>(Value) << 1)
+                ^ static_cast<std::uint64_t>(Value >> 63);
+        }
+
+        static std::int64_t UnZigZag(std::uint64_t Value) {
+            return static_cast<std::int64_t>(Value >> 1)
+                ^ -static_cast<std::int64_t>(Value & 1);
+        }
+
+        static void Write(std::string& Buffer, std::uint64_t Value) {
+            while (Value >= 0x80) {
+                Buffer.push_back(static_cast<char>((Value & 0x7F) | 0x80));
+                Value >>= 7;
+            }
+            Buffer.push_back(static_cast<char>(Value));
+        }
+
+        static std::uint64_t Read(const char*& Cursor, const char* End) {
+            std::uint64_t Value = 0;
+            for (int Shift = 0; Shift < 64; Shift += 7) {
+                if (Cursor == End) {
+                    throw ExceptionFileFormat();
+                }//数据被截断
+                std::uint8_t Byte = static_cast<std::uint8_t>(*Cursor++);
+                Value |= static_cast<std::uint64_t>(Byte & 0x7F) << Shift;
+                if ((Byte & 0x80) == 0) {
+                    return Value;
+                }
+            }
+            throw ExceptionFileFormat();//超过10字节，数据损坏
+        }
+
+        static void WriteDouble(std::string& Buffer, double Value) {
+            char Bytes[sizeof(double)];
+            std::memcpy(Bytes, &Value, sizeof(double));
+            Buffer.append(Bytes, sizeof(double));
+        }
+
+        static double ReadDouble(const char*& Cursor, const char* End) {
+            if (End - Cursor < static_cast<long>(sizeof(double))) {
+                throw ExceptionFileFormat();
+            }
+            double Value;
+            std::memcpy(&Value, Cursor, sizeof(double));
+            Cursor += sizeof(double);
+            return Value;
+        }
+};
+
+#endif // VARINT_CODEC_HPP
@@ -0,0 +1,88 @@
+/*******************************************************************************
+【文件名】 VolumeExporter.cpp
+【功能模块和目的】 实现VolumeExporter类，写出.raw体数据与.nhdr说明文件
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <string>
+#include <system_error>
+#include <vector>
+#include "VolumeExporter.hpp"
+#include "../Errors.hpp"
+
+/*******************************************************************************
+【函数名称】 Export
+【函数功能】 检查扩展名后逐行写出体数据，成功后再写说明文件
+【参数】
+    - std::string Path（输入参数）：字符串，.raw文件路径
+    - const DistanceField& Field（输入参数）：距离场
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+void VolumeExporter::Export(std::string Path,
+    const DistanceField& Field) const {
+    std::filesystem::path RawPath(Path);
+    if (RawPath.extension() != ".raw") {
+        throw ExceptionFileExtension();
+    }
+    const std::string TempPath = Path + ".tmp";
+    std::error_code Error;
+    std::ofstream File(TempPath, std::ios::out | std::ios::binary
+        | std::ios::trunc);
+    if (!File.is_open()) {
+        throw ExceptionFileOpen();
+    }
+    std::vector<float> Row(Field.Size[0]);
+    for (std::size_t z = 0; z < Field.Size[2]; z++) {
+        for (std::size_t y = 0; y < Field.Size[1]; y++) {
+            for (std::size_t x = 0; x < Field.Size[0]; x++) {
+                Row[x] = Field.At(x, y, z);
+            }
+            File.write(reinterpret_cast<const char*>(Row.data()),
+                Row.size() * sizeof(float));
+        }
+    }//按本机字节序写出，说明文件中注明为小端
+    File.close();
+    if (File.fail()) {
+        std::filesystem::remove(TempPath, Error);
+        throw ExceptionFileOpen();
+    }
+    std::filesystem::rename(TempPath, Path, Error);
+    if (Error) {
+        std::filesystem::remove(TempPath, Error);
+        throw ExceptionFileOpen();
+    }
+
+    std::filesystem::path HeaderPath(RawPath);
+    HeaderPath.replace_extension(".nhdr");
+    std::ofstream Header(HeaderPath, std::ios::out | std::ios::trunc);
+    if (!Header.is_open()) {
+        throw ExceptionFileOpen();
+    }
+    const double Spacing = Field.Spacing;
+    Header << std::setprecision(17);
+    Header << "NRRD0004\n"
+        << "# signed distance field, negative inside, band width "
+        << Field.BandWidth << "\n"
+        << "type: float\n"
+        << "dimension: 3\n"
+        << "sizes: " << Field.Size[0] << " " << Field.Size[1] << " "
+        << Field.Size[2] << "\n"
+        << "space dimension: 3\n"
+        << "space directions: (" << Spacing << ",0,0) (0," << Spacing
+        << ",0) (0,0," << Spacing << ")\n"
+        << "space origin: (" << Field.Origin[0] << "," << Field.Origin[1]
+        << "," << Field.Origin[2] << ")\n"
+        << "encoding: raw\n"
+        << "endian: little\n"
+        << "data file: " << RawPath.filename().string() << "\n";
+    Header.close();
+    if (Header.fail()) {
+        throw ExceptionFileOpen();
+    }
+}
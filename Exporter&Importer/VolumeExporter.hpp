@@ -0,0 +1,32 @@
+/*******************************************************************************
+【文件名】 VolumeExporter.hpp
+【功能模块和目的】 定义VolumeExporter类，用于把有向距离场导出为原始二进制体数据
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+#ifndef VOLUME_EXPORTER_HPP
+#define VOLUME_EXPORTER_HPP
+
+#include <string>
+#include "../Models/DistanceField.hpp"
+
+/*******************************************************************************
+【类名】 VolumeExporter
+【功能】 VolumeExporter类，把距离场展开为稠密网格，按x、y、z的顺序逐行写出
+小端32位浮点数到.raw文件，并在同名的.nhdr文件中写入NRRD格式的说明（尺寸、间距、
+原点与数据文件名），可由ParaView、3D Slicer等直接打开。.raw文件先写入临时文件再
+重命名，逐行写出，不需要整个稠密网格的内存
+【接口说明】
+    - void Export(std::string Path, const DistanceField& Field) const
+        导出距离场，Path的扩展名须为.raw；扩展名错误时抛出
+        ExceptionFileExtension，无法写入时抛出ExceptionFileOpen
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+class VolumeExporter {
+    public:
+        //导出距离场
+        void Export(std::string Path, const DistanceField& Field) const;
+};
+
+#endif // VOLUME_EXPORTER_HPP
@@ -0,0 +1,97 @@
+/*******************************************************************************
+【文件名】 DistanceField.hpp
+【功能模块和目的】 定义DistanceField结构体，以稀疏块的形式存放规则网格上的有向
+距离场
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+#ifndef DISTANCE_FIELD_HPP
+#define DISTANCE_FIELD_HPP
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+/*******************************************************************************
+【结构体名】 DistanceField
+【功能】 结构体，表示规则网格上的窄带有向距离场：表面内部为负、外部为正，绝对值
+不超过BandWidth。网格按BrickSize³个格点分块，离表面较远的块内各格点的值相同，只
+存一个值；靠近表面的块才存放全部格点的值，因此内存与表面积而非体积成正比
+【接口说明】
+    - static constexpr std::size_t BrickSize
+        块的边长（格点数）
+    - static constexpr std::size_t NoVoxels
+        BrickOffsets中表示块只存一个值的标记
+    - std::size_t Size[3]
+        各轴的格点数，为0时距离场为空
+    - double Origin[3]
+        格点(0, 0, 0)的坐标
+    - double Spacing
+        相邻格点的间距
+    - double BandWidth
+        窄带宽度，超出的距离截断为该值
+    - std::size_t BrickCounts[3]
+        各轴的块数
+    - std::vector<float> BrickValues
+        每个块的统一值，仅对只存一个值的块有意义
+    - std::vector<std::size_t> BrickOffsets
+        每个块的格点值在Values中的起始块号，只存一个值的块为NoVoxels
+    - std::vector<float> Values
+        存放全部格点值的块，块内按x、y、z的顺序排列，超出网格的格点为BandWidth
+    - float At(std::size_t X, std::size_t Y, std::size_t Z) const
+        求格点(X, Y, Z)的值
+    - std::size_t GetStoredBrickCount() const
+        返回存放全部格点值的块数
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+struct DistanceField {
+    static constexpr std::size_t BrickSize = 8;
+    static constexpr std::size_t NoVoxels =
+        std::numeric_limits<std::size_t>::max();
+
+    std::size_t Size[3];
+    double Origin[3];
+    double Spacing;
+    double BandWidth;
+    std::size_t BrickCounts[3];
+    std::vector<float> BrickValues;
+    std::vector<std::size_t> BrickOffsets;
+    std::vector<float> Values;
+
+    /***************************************************************************
+    【函数名称】 At
+    【函数功能】 求格点的值：先找到所在的块，块只存一个值时直接返回，否则在块内取值
+    【参数】
+        - std::size_t X（输入参数）：x方向的格点序号，小于Size[0]
+        - std::size_t Y（输入参数）：y方向的格点序号，小于Size[1]
+        - std::size_t Z（输入参数）：z方向的格点序号，小于Size[2]
+    【返回值】 float：格点的有向距离
+    Created by 朱昊东 on 2026/10/18
+    【更改记录】 无
+    ***************************************************************************/
+    float At(std::size_t X, std::size_t Y, std::size_t Z) const {
+        std::size_t Brick = ((Z / BrickSize) * BrickCounts[1]
+            + Y / BrickSize) * BrickCounts[0] + X / BrickSize;
+        if (BrickOffsets[Brick] == NoVoxels) {
+            return BrickValues[Brick];
+        }
+        return Values[BrickOffsets[Brick] * BrickSize * BrickSize * BrickSize
+            + ((Z % BrickSize) * BrickSize + Y % BrickSize) * BrickSize
+            + X % BrickSize];
+    }
+
+    /***************************************************************************
+    【函数名称】 GetStoredBrickCount
+    【函数功能】 返回存放全部格点值的块数
+    【参数】 无
+    【返回值】 std::size_t：块数
+    Created by 朱昊东 on 2026/10/18
+    【更改记录】 无
+    ***************************************************************************/
+    std::size_t GetStoredBrickCount() const {
+        return Values.size() / (BrickSize * BrickSize * BrickSize);
+    }
+};
+
+#endif // DISTANCE_FIELD_HPP
@@ -0,0 +1,437 @@
+/*******************************************************************************
+【文件名】 FaceAttributeCache.hpp
+【功能模块和目的】 定义FaceAttributeCache类模板，以结构数组的形式缓存每个面的法向、
+面积与包围盒，按面失效并分批并行地重新计算
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 增添了Transform方法，仿射变换后增量更新缓存
+*******************************************************************************/
+#ifndef FACE_ATTRIBUTE_CACHE_HPP
+#define FACE_ATTRIBUTE_CACHE_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "Face.hpp"
+#include "Point.hpp"
+
+/*******************************************************************************
+【类名】 FaceAttributeCache
+【功能】 面属性缓存。每种属性各占一个与面一一对应的数组（结构数组），按序遍历某一
+属性时只读取这一个数组；每个面有一个有效标记，修改或新增的面只标记为无效，下次
+Refresh时才重新计算，无效的面较多时分批交给多个线程。三维面的面积由两条边的叉积
+求得，与法向一起算出；其他维数的面使用Face::GetArea，不计算法向
+【接口说明】
+    - FaceAttributeCache()
+        构造函数，缓存为空
+    - const std::vector<double>& Areas
+        面积
+    - const std::vector<double>& Normals[3]
+        单位法向的x、y、z分量（仅三维），退化面的法向为零向量
+    - const std::vector<double>& Min[N]
+        包围盒各维的最小坐标
+    - const std::vector<double>& Max[N]
+        包围盒各维的最大坐标
+    - std::size_t GetInvalidCount() const
+        返回无效的面数
+    - void Append()
+        在末尾追加一个无效的面
+    - void Invalidate(std::size_t Index)
+        标记一个面为无效
+    - void Erase(std::size_t Index)
+        删除一个面的缓存，其后的面前移
+    - void Reset(std::size_t Count)
+        把缓存调整为Count个面并全部标记为无效
+    - void Swap(FaceAttributeCache<N>& Other)
+        与另一个缓存交换全部数据
+    - void Refresh(const std::vector<std::shared_ptr<Face<N>>>& Faces)
+        重新计算所有无效的面
+    - void Transform(const double* Matrix,
+        const std::vector<std::shared_ptr<Face<N>>>& Faces)
+        面的点经过仿射变换后，直接换算有效的面的属性
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 增添了Transform
+*******************************************************************************/
+template <std::size_t N>
+class FaceAttributeCache {
+    public:
+        FaceAttributeCache() = default;
+        FaceAttributeCache(const FaceAttributeCache<N>& Other) = delete;
+        FaceAttributeCache<N>& operator=(
+            const FaceAttributeCache<N>& Other) = delete;
+
+        const std::vector<double>& Areas { m_Areas };
+        const std::vector<double> (&Normals)[3] { m_Normals };
+        const std::vector<double> (&Min)[N] { m_Min };
+        const std::vector<double> (&Max)[N] { m_Max };
+
+        /***********************************************************************
+        【函数名称】 GetInvalidCount
+        【函数功能】 返回无效的面数
+        【参数】 无
+        【返回值】 std::size_t：无效的面数
+        Created by 朱昊东 on 2026/10/18
+        【更改记录】 无
+        ***********************************************************************/
+        std::size_t GetInvalidCount() const {
+            return m_InvalidCount;
+        }
+
+        /***********************************************************************
+        【函数名称】 Append
+        【函数功能】 在末尾追加一个无效的面
+        【参数】 无
+        【返回值】 无
+        Created by 朱昊东 on 2026/10/18
+        【更改记录】 无
+        ***********************************************************************/
+        void Append() {
+            Reset(m_IsValid.size() + 1, false);
+        }
+
+        /***********************************************************************
+        【函数名称】 Invalidate
+        【函数功能】 标记一个面为无效，越界时忽略
+        【参数】
+            - std::size_t Index（输入参数）：面的序号
+        【返回值】 无
+        Created by 朱昊东 on 2026/10/18
+        【更改记录】 无
+        ***********************************************************************/
+        void Invalidate(std::size_t Index) {
+            if (Index < m_IsValid.size() && m_IsValid[Index]) {
+                m_IsValid[Index] = false;
+                m_InvalidCount++;
+            }
+        }
+
+        /***********************************************************************
+        【函数名称】 Erase
+        【函数功能】 删除一个面的缓存，其后的面前移，越界时忽略
+        【参数】
+            - std::size_t Index（输入参数）：面的序号
+        【返回值】 无
+        Created by 朱昊东 on 2026/10/18
+        【更改记录】 无
+        ***********************************************************************/
+        void Erase(std::size_t Index) {
+            if (Index >= m_IsValid.size()) {
+                return;
+            }
+            if (!m_IsValid[Index]) {
+                m_InvalidCount--;
+            }
+            ForEachArray([Index](std::vector<double>& Array) {
+                Array.erase(Array.begin() + Index);
+            });
+            m_IsValid.erase(m_IsValid.begin() + Index);
+        }
+
+        /***********************************************************************
+        【函数名称】 Reset
+        【函数功能】 把缓存调整为Count个面并全部标记为无效
+        【参数】
+            - std::size_t Count（输入参数）：面数
+        【返回值】 无
+        Created by 朱昊东 on 2026/10/18
+        【更改记录】 无
+        ***********************************************************************/
+        void Reset(std::size_t Count) {
+            Reset(Count, true);
+        }
+
+        /***********************************************************************
+        【函数名称】 Swap
+        【函数功能】 与另一个缓存交换全部数据
+        【参数】
+            - FaceAttributeCache<N>& Other（输入输出参数）：另一个缓存
+        【返回值】 无
+        Created by 朱昊东 on 2026/10/18
+        【更改记录】 无
+        ***********************************************************************/
+        void Swap(FaceAttributeCache<N>& Other) {
+            m_Areas.swap(Other.m_Areas);
+            for (std::size_t i = 0; i < 3; i++) {
+                m_Normals[i].swap(Other.m_Normals[i]);
+            }
+            for (std::size_t i = 0; i < N; i++) {
+                m_Min[i].swap(Other.m_Min[i]);
+                m_Max[i].swap(Other.m_Max[i]);
+            }
+            m_IsValid.swap(Other.m_IsValid);
+            std::swap(m_InvalidCount, Other.m_InvalidCount);
+        }
+
+        /***********************************************************************
+        【函数名称】 Refresh
+        【函数功能】 重新计算所有无效的面。无效的面不多时在调用线程上逐个计算，
+        否则把所有面均分成若干段，每个线程只计算自己那一段中无效的面
+        【参数】
+            - const std::vector<std::shared_ptr<Face<N>>>& Faces（输入参数）：
+            与缓存一一对应的面
+        【返回值】 无
+        Created by 朱昊东 on 2026/10/18
+        【更改记录】 无
+        ***********************************************************************/
+        void Refresh(const std::vector<std::shared_ptr<Face<N>>>& Faces) {
+            if (m_InvalidCount == 0) {
+                return;
+            }
+            const std::size_t Count = m_IsValid.size();
+            auto Work = [&](std::size_t First, std::size_t Last) {
+                for (std::size_t f = First; f < Last; f++) {
+                    if (!m_IsValid[f]) {
+                        Compute(f, *Faces[f]);
+                        m_IsValid[f] = true;
+                    }
+                }
+            };
+            std::size_t Workers = std::min<std::size_t>(
+                std::max(1u, std::thread::hardware_concurrency()),
+                m_InvalidCount / MinFacesPerWorker);
+            if (Workers <= 1) {
+                Work(0, Count);
+            }
+            else {
+                std::vector<std::thread> Threads;
+                for (std::size_t w = 1; w < Workers; w++) {
+                    Threads.emplace_back(Work, Count * w / Workers,
+                        Count * (w + 1) / Workers);
+                }
+                Work(0, Count / Workers);
+                for (auto& Thread: Threads) {
+                    Thread.join();
+                }
+            }//每段的有效标记由各自的线程写入，互不重叠
+            m_InvalidCount = 0;
+        }
+
+        /***********************************************************************
+        【函数名称】 Transform
+        【函数功能】 在面的点都经过Matrix变换之后调用，直接换算有效的面的属性，
+        无效的面仍留给Refresh。三维时叉积满足(LU)×(LV) = cof(L)(U×V)，L为线性
+        部分，cof(L)为其余子式矩阵，因此新法向与cof(L)·n同向，面积乘以|cof(L)·n|；
+        其他维数的面积没有这样的关系，全部标记为无效。L的每行至多一个非零元（缩放、
+        镜像、交换坐标轴与平移）时每个新坐标只由一个旧坐标单调决定，包围盒由旧的
+        两端直接换算；否则由已经变换的点重新求出包围盒。面较多时分段交给多个线程
+        【参数】
+            - const double* Matrix（输入参数）：(N + 1)×(N + 1)的仿射矩阵，
+            按行存放，最后一行不被读取
+            - const std::vector<std::shared_ptr<Face<N>>>& Faces（输入参数）：
+            与缓存一一对应的面
+        【返回值】 无
+        Created by 朱昊东 on 2026/10/18
+        【更改记录】 无
+        ***********************************************************************/
+        void Transform(const double* Matrix,
+            const std::vector<std::shared_ptr<Face<N>>>& Faces) {
+            const std::size_t Count = m_IsValid.size();
+            if constexpr (N != 3) {
+                Reset(Count);
+                return;
+            }
+            auto L = [Matrix](std::size_t Row, std::size_t Column) {
+                return Matrix[Row * (N + 1) + Column];
+            };
+            double Cofactor[3][3];
+            for (std::size_t r = 0; r < 3; r++) {
+                for (std::size_t c = 0; c < 3; c++) {
+                    std::size_t r1 = (r + 1) % 3;
+                    std::size_t r2 = (r + 2) % 3;
+                    std::size_t c1 = (c + 1) % 3;
+                    std::size_t c2 = (c + 2) % 3;
+                    Cofactor[r][c] = L(r1, c1) * L(r2, c2)
+                        - L(r1, c2) * L(r2, c1);
+                }
+            }//循环下标使余子式自带符号
+            bool IsAxisAligned = true;
+            std::size_t Source[N];//每个新坐标所依赖的旧坐标
+            for (std::size_t r = 0; r < N; r++) {
+                std::size_t NonZeros = 0;
+                Source[r] = 0;
+                for (std::size_t c = 0; c < N; c++) {
+                    if (L(r, c) != 0) {
+                        NonZeros++;
+                        Source[r] = c;
+                    }
+                }
+                IsAxisAligned = IsAxisAligned && NonZeros <= 1;
+            }
+            auto Work = [&](std::size_t First, std::size_t Last) {
+                std::vector<double> OldMin(N);
+                std::vector<double> OldMax(N);
+                for (std::size_t f = First; f < Last; f++) {
+                    if (!m_IsValid[f]) {
+                        continue;
+                    }
+                    double Normal[3];
+                    double Length = 0;
+                    for (std::size_t r = 0; r < 3; r++) {
+                        Normal[r] = Cofactor[r][0] * m_Normals[0][f]
+                            + Cofactor[r][1] * m_Normals[1][f]
+                            + Cofactor[r][2] * m_Normals[2][f];
+                        Length += Normal[r] * Normal[r];
+                    }
+                    Length = std::sqrt(Length);
+                    m_Areas[f] *= Length;
+                    for (std::size_t r = 0; r < 3; r++) {
+                        m_Normals[r][f] = Length > 0 ? Normal[r] / Length : 0;
+                    }
+                    if (!IsAxisAligned) {
+                        const Point<N>* Points[3] = { Faces[f]->First.get(),
+                            Faces[f]->Second.get(), Faces[f]->Third.get() };
+                        for (std::size_t i = 0; i < N; i++) {
+                            double A = Points[0]->GetCoordinate(i);
+                            double B = Points[1]->GetCoordinate(i);
+                            double C = Points[2]->GetCoordinate(i);
+                            m_Min[i][f] = std::min({ A, B, C });
+                            m_Max[i][f] = std::max({ A, B, C });
+                        }
+                        continue;
+                    }
+                    for (std::size_t i = 0; i < N; i++) {
+                        OldMin[i] = m_Min[i][f];
+                        OldMax[i] = m_Max[i][f];
+                    }
+                    for (std::size_t r = 0; r < N; r++) {
+                        double Low = L(r, Source[r]) * OldMin[Source[r]];
+                        double High = L(r, Source[r]) * OldMax[Source[r]];
+                        m_Min[r][f] = std::min(Low, High) + L(r, N);
+                        m_Max[r][f] = std::max(Low, High) + L(r, N);
+                    }//整行为0时两端都为0，新坐标恒为平移量
+                }
+            };
+            std::size_t Workers = std::min<std::size_t>(
+                std::max(1u, std::thread::hardware_concurrency()),
+                Count / MinFacesPerWorker);
+            if (Workers <= 1) {
+                Work(0, Count);
+            }
+            else {
+                std::vector<std::thread> Threads;
+                for (std::size_t w = 1; w < Workers; w++) {
+                    Threads.emplace_back(Work, Count * w / Workers,
+                        Count * (w + 1) / Workers);
+                }
+                Work(0, Count / Workers);
+                for (auto& Thread: Threads) {
+                    Thread.join();
+                }
+            }
+        }
+
+    private:
+        //每个线程至少重新计算的面数
+        static constexpr std::size_t MinFacesPerWorker = 1 << 14;
+
+        /***********************************************************************
+        【函数名称】 Reset
+        【函数功能】 把缓存调整为Count个面，IsAllInvalid为真时全部标记为无效，
+        否则只有新增的面无效
+        【参数】
+            - std::size_t Count（输入参数）：面数
+            - bool IsAllInvalid（输入参数）：是否全部标记为无效
+        【返回值】 无
+        Created by 朱昊东 on 2026/10/18
+        【更改记录】 无
+        ***********************************************************************/
+        void Reset(std::size_t Count, bool IsAllInvalid) {
+            if (IsAllInvalid) {
+                m_IsValid.assign(Count, false);
+                m_InvalidCount = Count;
+            }
+            else {
+                if (Count > m_IsValid.size()) {
+                    m_InvalidCount += Count - m_IsValid.size();
+                }
+                m_IsValid.resize(Count, false);
+            }
+            ForEachArray([Count](std::vector<double>& Array) {
+                Array.resize(Count);
+            });
+        }
+
+        /***********************************************************************
+        【函数名称】 ForEachArray
+        【函数功能】 对每个属性数组执行同一操作
+        【参数】
+            - const Function& Action（输入参数）：接受std::vector<double>&的操作
+        【返回值】 无
+        Created by 朱昊东 on 2026/10/18
+        【更改记录】 无
+        ***********************************************************************/
+        template <typename Function>
+        void ForEachArray(const Function& Action) {
+            Action(m_Areas);
+            if constexpr (N == 3) {
+                for (std::size_t i = 0; i < 3; i++) {
+                    Action(m_Normals[i]);
+                }
+            }
+            for (std::size_t i = 0; i < N; i++) {
+                Action(m_Min[i]);
+                Action(m_Max[i]);
+            }
+        }
+
+        /***********************************************************************
+        【函数名称】 Compute
+        【函数功能】 计算一个面的各项属性并写入缓存
+        【参数】
+            - std::size_t Index（输入参数）：面的序号
+            - const Face<N>& F（输入参数）：面
+        【返回值】 无
+        Created by 朱昊东 on 2026/10/18
+        【更改记录】 无
+        ***********************************************************************/
+        void Compute(std::size_t Index, const Face<N>& F) {
+            const Point<N>* Points[3] = {
+                F.First.get(), F.Second.get(), F.Third.get() };
+            for (std::size_t i = 0; i < N; i++) {
+                double A = Points[0]->GetCoordinate(i);
+                double B = Points[1]->GetCoordinate(i);
+                double C = Points[2]->GetCoordinate(i);
+                m_Min[i][Index] = std::min({ A, B, C });
+                m_Max[i][Index] = std::max({ A, B, C });
+            }
+            if constexpr (N == 3) {
+                double U[3];
+                double V[3];
+                for (std::size_t i = 0; i < 3; i++) {
+                    U[i] = Points[1]->GetCoordinate(i)
+                        - Points[0]->GetCoordinate(i);
+                    V[i] = Points[2]->GetCoordinate(i)
+                        - Points[0]->GetCoordinate(i);
+                }
+                double Cross[3] = {
+                    U[1] * V[2] - U[2] * V[1],
+                    U[2] * V[0] - U[0] * V[2],
+                    U[0] * V[1] - U[1] * V[0] };
+                double Length = std::sqrt(Cross[0] * Cross[0]
+                    + Cross[1] * Cross[1] + Cross[2] * Cross[2]);
+                m_Areas[Index] = Length / 2;
+                for (std::size_t i = 0; i < 3; i++) {
+                    m_Normals[i][Index] = Length > 0 ? Cross[i] / Length : 0;
+                }
+            }
+            else {
+                m_Areas[Index] = F.GetArea();
+            }
+        }
+
+        std::vector<double> m_Areas;
+        std::vector<double> m_Normals[3];
+        std::vector<double> m_Min[N];
+        std::vector<double> m_Max[N];
+        //用char而非bool，使不同线程写相邻的标记时互不干扰
+        std::vector<char> m_IsValid;
+        std::size_t m_InvalidCount { 0 };
+};
+
+#endif // FACE_ATTRIBUTE_CACHE_HPP
@@ -0,0 +1,148 @@
+/*******************************************************************************
+【文件名】 IndexedModel.hpp
+【功能模块和目的】 定义IndexedModel类模板，为Model建立"去重点数组+元素索引"形式的
+索引视图，供编码、导出及各类网格算法使用
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 构造函数可选地在建立索引时焊接重合的点
+    - 构造函数可选地按线和面的序号而不是存储顺序遍历
+*******************************************************************************/
+#ifndef INDEXED_MODEL_HPP
+#define INDEXED_MODEL_HPP
+
+#include <cstddef>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include "Model.hpp"
+#include "Point.hpp"
+#include "PointWelder.hpp"
+
+/*******************************************************************************
+【类名】 IndexedModel
+【功能】 以点对象的地址为键，用哈希表在线性时间内为Model中的点分配从0开始的序号，
+点的顺序与遍历的顺序一致（先线后面、按首次出现排序）
+【接口说明】
+    - IndexedModel(const Model<N>& Model, bool WeldPoints = false,
+        bool InIndexOrder = false)
+        构造函数，对模型建立索引；WeldPoints为真时，相距在Point::IsSame容差以内的
+        不同点对象共用同一序号，因此退化的线或面不出现在索引中，模型本身不被
+        修改；InIndexOrder为真时按线和面的序号遍历（导出时使文件中的顺序与序号
+        一致），否则按存储顺序遍历，与Model::Lines和Model::Faces一一对应
+    - const std::vector<std::shared_ptr<Point<N>>>& Points
+        去重后的点数组
+    - const std::vector<std::size_t>& LineIndices
+        每条线的两个点序号，依次存放
+    - const std::vector<std::size_t>& FaceIndices
+        每个面的三个点序号，依次存放
+    - std::size_t IndexOf(const Point<N>* Point) const
+        查找点的序号，不存在时返回NotFound
+    - static constexpr std::size_t NotFound
+        未找到时的返回值
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 构造函数增添了WeldPoints参数
+    - 构造函数增添了InIndexOrder参数
+*******************************************************************************/
+template <std::size_t N>
+class IndexedModel {
+    public:
+        static constexpr std::size_t NotFound = static_cast<std::size_t>(-1);
+
+        /***********************************************************************
+        【函数名称】 IndexedModel
+        【函数功能】 构造函数，遍历模型的线和面，建立点的序号
+        【参数】
+            - const Model<N>& Model（输入参数）：模型
+            - bool WeldPoints（输入参数）：是否焊接重合的点
+            - bool InIndexOrder（输入参数）：是否按线和面的序号遍历
+        【返回值】 无
+        Created by 朱昊东 on 2026/10/18
+        【更改记录】 
+            2026/10/18
+            - 增添了WeldPoints参数，焊接后退化的元素不计入索引
+            - 增添了InIndexOrder参数
+        ***********************************************************************/
+        explicit IndexedModel(const Model<N>& Model, bool WeldPoints = false,
+            bool InIndexOrder = false) {
+            if (WeldPoints) {
+                m_Welder.reset(new PointWelder<N>());
+            }
+            m_Index.reserve(
+                Model.Lines.size() * 2 + Model.Faces.size() * 3);
+            m_LineIndices.reserve(Model.Lines.size() * 2);
+            m_FaceIndices.reserve(Model.Faces.size() * 3);
+            for (std::size_t i = 0; i < Model.Lines.size(); i++) {
+                const auto& Line = Model.Lines[
+                    InIndexOrder ? Model.GetLineSlot(i) : i];
+                std::size_t First = AddPoint(Line->First);
+                std::size_t Second = AddPoint(Line->Second);
+                if (First != Second) {
+                    m_LineIndices.push_back(First);
+                    m_LineIndices.push_back(Second);
+                }//只有焊接时才会出现相同的序号
+            }
+            for (std::size_t i = 0; i < Model.Faces.size(); i++) {
+                const auto& Face = Model.Faces[
+                    InIndexOrder ? Model.GetFaceSlot(i) : i];
+                std::size_t First = AddPoint(Face->First);
+                std::size_t Second = AddPoint(Face->Second);
+                std::size_t Third = AddPoint(Face->Third);
+                if (First != Second && Second != Third && Third != First) {
+                    m_FaceIndices.push_back(First);
+                    m_FaceIndices.push_back(Second);
+                    m_FaceIndices.push_back(Third);
+                }
+            }
+        }
+
+        IndexedModel(const IndexedModel<N>& Other) = delete;
+        IndexedModel<N>& operator=(const IndexedModel<N>& Other) = delete;
+
+        const std::vector<std::shared_ptr<Point<N>>>& Points { m_Points };
+        const std::vector<std::size_t>& LineIndices { m_LineIndices };
+        const std::vector<std::size_t>& FaceIndices { m_FaceIndices };
+
+        /***********************************************************************
+        【函数名称】 IndexOf
+        【函数功能】 查找点的序号
+        【参数】
+            - const Point<N>* Point（输入参数）：点对象的地址
+        【返回值】 std::size_t：点的序号，不存在时返回NotFound
+        Created by 朱昊东 on 2026/10/18
+        【更改记录】 无
+        ***********************************************************************/
+        std::size_t IndexOf(const Point<N>* Point) const {
+            auto It = m_Index.find(Point);
+            if (It == m_Index.end()) {
+                return NotFound;
+            }
+            return It->second;
+        }
+
+    private:
+        //登记一个点，返回其序号
+        std::size_t AddPoint(const std::shared_ptr<Point<N>>& P) {
+            auto Inserted = m_Index.emplace(P.get(), m_Points.size());
+            if (!Inserted.second) {
+                return Inserted.first->second;
+            }
+            if (m_Welder) {
+                Inserted.first->second = m_Welder->Weld(P);
+            }//焊接器的代表点与m_Points一一对应
+            if (Inserted.first->second == m_Points.size()) {
+                m_Points.push_back(P);
+            }//首次出现的点追加到末尾
+            return Inserted.first->second;
+        }
+
+        std::vector<std::shared_ptr<Point<N>>> m_Points;
+        std::vector<std::size_t> m_LineIndices;
+        std::vector<std::size_t> m_FaceIndices;
+        std::unordered_map<const Point<N>*, std::size_t> m_Index;
+        std::unique_ptr<PointWelder<N>> m_Welder;
+};
+
+#endif // INDEXED_MODEL_HPP
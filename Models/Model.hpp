@@ -7,6 +7,18 @@
 【更改记录】 
     2024/8/17
     - 修改了一些缩进问题
+    2026/10/18
+    - 增添了Swap方法
+    - CollectPoints改用哈希集合去重
+    - 增添了WeldPoints方法
+    - 增添了CopyFrom方法
+    - 增添了ReorderFaces方法
+    - 增添了Compact方法
+    - 增添了面属性缓存与GetFaceAttributes方法
+    - 增添了Assign方法
+    - 增添了MovePoints方法
+    - 增添了TransformPoints方法
+    - 增添了编号到存储位置的映射，Compact按给定顺序重排线和面的存储
 *******************************************************************************/
 #ifndef MODEL_HPP
 #define MODEL_HPP
@@ -15,16 +27,23 @@
 #include <memory>
 #include <limits>
 #include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include "Face.hpp"
+#include "FaceAttributeCache.hpp"
 #include "Line.hpp"
 #include "Point.hpp"
+#include "PointWelder.hpp"
 #include "../Errors.hpp"
 
 /*******************************************************************************
 【类名】 Model
 【功能】 Model类模板含有一个Line类对象的动态数组和一个Face类对象的动态数组，提供了
 获取所有Point类对象构成的动态数组、添加、修改、删除、清空、获取最小包围盒体积等方法
+Lines与Faces按存储顺序排列；线和面的序号（编号减1）经一个映射对应到存储位置，
+Compact重排存储后序号不变，ModifyLine等按序号访问的方法经映射找到元素
 【接口说明】
     - Model(std::string Name = "")
         构造函数，传入名称，默认为空
@@ -67,10 +86,55 @@
         清空所有存储的数据
     - double GetMinBoxVolume() const
         获取最小包围盒体积
+    - void Swap(Model<N>& Other)
+        与另一个模型交换全部数据
+    - WeldReport WeldPoints(double Tolerance)
+        合并相距在容差以内的点
+    - void CopyFrom(const Model<N>& Other)
+        深拷贝另一个模型，保留点的共享关系
+    - void ReorderFaces(const std::vector<std::size_t>& Order)
+        按给定的排列重排面
+    - void Compact(const std::vector<std::size_t>& LineOrder,
+        const std::vector<std::size_t>& FaceOrder,
+        const std::vector<std::shared_ptr<Point<N>>>& PointOrder)
+        按给定的顺序把线、面和点分别搬到连续的内存中，线和面的序号不变
+    - std::size_t GetLineSlot(std::size_t Index) const
+        获取第Index条线的存储位置
+    - std::size_t GetFaceSlot(std::size_t Index) const
+        获取第Index个面的存储位置
+    - std::vector<std::size_t> GetLineIndicesBySlot() const
+        获取各存储位置上的线的序号
+    - std::vector<std::size_t> GetFaceIndicesBySlot() const
+        获取各存储位置上的面的序号
+    - void Assign(const std::vector<double>& Coordinates,
+        const std::vector<std::size_t>& LineIndices,
+        const std::vector<std::size_t>& FaceIndices)
+        由坐标数组与点序号数组整体替换模型的线和面
+    - template <typename Locator> void MovePoints(const Locator& NewCoordinates)
+        原地修改各点的坐标，点对象及其共享关系不变
+    - void TransformPoints(
+        const std::vector<std::shared_ptr<Point<N>>>& Points,
+        const std::vector<double>& Coordinates, const double* Matrix)
+        写入仿射变换后的坐标，增量更新面属性缓存
+    - const FaceAttributeCache<N>& GetFaceAttributes() const
+        获取与面一一对应的面属性缓存（法向、面积、包围盒）
 Created by 朱昊东 on 2024/7/26
 【更改记录】 
     2024/8/17
     - 修改了一些缩进问题
+    2026/10/18
+    - 增添了Swap方法
+    - CollectPoints改用哈希集合去重
+    - 增添了WeldPoints方法
+    - 增添了CopyFrom方法
+    - 增添了ReorderFaces方法
+    - 增添了Compact方法
+    - 增添了面属性缓存与GetFaceAttributes方法，修改面的方法随之维护缓存
+    - 增添了Assign方法
+    - 增添了MovePoints方法
+    - 增添了TransformPoints方法
+    - 增添了GetLineSlot、GetFaceSlot、GetLineIndicesBySlot与
+    GetFaceIndicesBySlot，Compact按给定顺序重排线和面的存储而编号不变
 *******************************************************************************/
 template <std::size_t N>
 class Model {
@@ -123,18 +187,19 @@ class Model {
         【更改记录】 
             2024/8/17
             - 修改了一些缩进问题
+            2026/10/18
+            - 改用哈希集合判断点是否已出现，由O(V^2)降为线性时间，顺序不变
         ***********************************************************************/
         std::vector<std::shared_ptr<Point<N>>> CollectPoints() const{
             std::vector<std::shared_ptr<Point<N>>> Points;
+            std::unordered_set<const Point<N>*> Seen;
+            Seen.reserve(m_Lines.size() * 2 + m_Faces.size() * 3);
             auto AddUniquePoints = [&](const auto& Elements) {
                 for (const auto& Element : Elements) {
                     //遍历Elements的所有Element
                     for (const auto& Point : Element->GetPointsVector()) {
                         //遍历Element 的 PointsVector
-                        if (std::none_of(
-                            Points.begin(),
-                            Points.end(), 
-                            [&](const auto& p) {return p == Point;})) {
+                        if (Seen.insert(Point.get()).second) {
                             Points.push_back(Point);// 添加不重复的点
                         }
                     }
@@ -216,9 +281,14 @@ class Model {
             - const Line<N>& Line（输入参数）：线对象
         【返回值】 无
         Created by 朱昊东 on 2024/7/26
-        【更改记录】 无
+        【更改记录】 
+            2026/10/18
+            - 存储顺序被重排过时，为新线登记存储位置
         ***********************************************************************/
         void AddLineUnchecked(const Line<N>& L){
+            if (!m_LineSlots.empty()) {
+                m_LineSlots.push_back(m_Lines.size());
+            }
             m_Lines.push_back(std::make_shared<Line<N>>(L));
         }
 
@@ -229,10 +299,17 @@ class Model {
             - const Face<N>& Face（输入参数）：面对象
         【返回值】 无
         Created by 朱昊东 on 2024/7/26
-        【更改记录】 无
+        【更改记录】 
+            2026/10/18
+            - 在面属性缓存中追加一个无效的面
+            - 存储顺序被重排过时，为新面登记存储位置
         ***********************************************************************/
         void AddFaceUnchecked(const Face<N>& F){
+            if (!m_FaceSlots.empty()) {
+                m_FaceSlots.push_back(m_Faces.size());
+            }
             m_Faces.push_back(std::make_shared<Face<N>>(F));
+            m_FaceCache.Append();
         }
 
         /***********************************************************************
@@ -247,6 +324,9 @@ class Model {
         【更改记录】 
             2024/8/17
             - 修改了一些缩进问题
+            2026/10/18
+            - Index为线的序号，经映射找到存储位置
+            - 与其他线相同时先恢复原来的点再抛出异常，线保持不变
         ***********************************************************************/
         void ModifyLine(
             std::size_t Index,
@@ -255,10 +335,13 @@ class Model {
             if (Index >= m_Lines.size()) {
                 throw ExceptionIndexOutOfBounds(Index);
             }
-            m_Lines[Index]->ChangePoint(
+            std::size_t Slot = GetLineSlot(Index);
+            std::shared_ptr<Point<N>> Old = m_Lines[Slot]->GetPoint(PointIndex);
+            m_Lines[Slot]->ChangePoint(
                 PointIndex, std::make_shared<Point<N>>(P));
             for (int i = 0; i < m_Lines.size(); i++) {
-                if (i != Index && m_Lines[i]->IsSame(*m_Lines[Index])) {
+                if (i != Slot && m_Lines[i]->IsSame(*m_Lines[Slot])) {
+                    m_Lines[Slot]->SetPoint(PointIndex, Old);
                     throw ExceptionIdenticalElement();
                 }
             }
@@ -277,6 +360,10 @@ class Model {
         【更改记录】 
             2024/8/17
             - 修改了一些缩进问题
+            2026/10/18
+            - 使该面的属性缓存失效
+            - Index为面的序号，经映射找到存储位置
+            - 与其他面相同时先恢复原来的点再抛出异常，面保持不变
         ***********************************************************************/
         void ModifyFace(
             std::size_t Index,
@@ -285,13 +372,17 @@ class Model {
             if (Index >= m_Faces.size()) {
                 throw ExceptionIndexOutOfBounds(Index);
             }
-            m_Faces[Index]->ChangePoint(PointIndex, 
+            std::size_t Slot = GetFaceSlot(Index);
+            std::shared_ptr<Point<N>> Old = m_Faces[Slot]->GetPoint(PointIndex);
+            m_Faces[Slot]->ChangePoint(PointIndex, 
                 std::make_shared<Point<N>>(P));
             for (int i = 0; i < m_Faces.size(); i++) {
-                if (i != Index && m_Faces[i]->IsSame(*m_Faces[Index])) {
+                if (i != Slot && m_Faces[i]->IsSame(*m_Faces[Slot])) {
+                    m_Faces[Slot]->SetPoint(PointIndex, Old);
                     throw ExceptionIdenticalElement();
                 }
             }
+            m_FaceCache.Invalidate(Slot);
         }
 
         /***********************************************************************
@@ -301,13 +392,16 @@ class Model {
             - std::size_t Index（输入参数）：线的索引
         【返回值】 bool：删除是否成功
         Created by 朱昊东 on 2024/7/26
-        【更改记录】 无
+        【更改记录】 
+            2026/10/18
+            - Index为线的序号，经映射找到存储位置，其后的序号前移
         ***********************************************************************/
         bool RemoveLine(std::size_t Index) {
             if (Index >= m_Lines.size()) {
                 return false;
             }
-            m_Lines.erase(m_Lines.begin() + Index);
+            m_Lines.erase(m_Lines.begin() + GetLineSlot(Index));
+            EraseSlot(m_LineSlots, Index);
             return true;
         }
 
@@ -318,13 +412,19 @@ class Model {
             - std::size_t Index（输入参数）：面的索引
         【返回值】 bool：删除是否成功
         Created by 朱昊东 on 2024/7/26
-        【更改记录】 无
+        【更改记录】 
+            2026/10/18
+            - 同时删除该面的属性缓存
+            - Index为面的序号，经映射找到存储位置，其后的序号前移
         ***********************************************************************/
         bool RemoveFace(std::size_t Index) {
             if (Index >= m_Faces.size()) {
                 return false;
             }
-            m_Faces.erase(m_Faces.begin() + Index);
+            std::size_t Slot = GetFaceSlot(Index);
+            m_Faces.erase(m_Faces.begin() + Slot);
+            m_FaceCache.Erase(Slot);
+            EraseSlot(m_FaceSlots, Index);
             return true;
         }
 
@@ -334,11 +434,17 @@ class Model {
         【参数】 无
         【返回值】 无
         Created by 朱昊东 on 2024/7/26
-        【更改记录】 无
+        【更改记录】 
+            2026/10/18
+            - 同时清空面属性缓存
+            - 同时清空编号到存储位置的映射
         ***********************************************************************/
         void Clear() {
             m_Lines.clear();
             m_Faces.clear();
+            m_LineSlots.clear();
+            m_FaceSlots.clear();
+            m_FaceCache.Reset(0);
         }
 
         /***********************************************************************
@@ -374,10 +480,538 @@ class Model {
             return Volume;
         }
 
+        /***********************************************************************
+        【函数名称】 Swap
+        【函数功能】 与另一个模型交换全部数据，用于整体替换后台加载好的模型
+        【参数】 
+            - Model<N>& Other（输入输出参数）：另一个模型
+        【返回值】 无
+        Created by 朱昊东 on 2026/10/18
+        【更改记录】 
+            2026/10/18
+            - 同时交换面属性缓存
+            - 同时交换编号到存储位置的映射
+        ***********************************************************************/
+        void Swap(Model<N>& Other) {
+            m_Name.swap(Other.m_Name);
+            m_Lines.swap(Other.m_Lines);
+            m_Faces.swap(Other.m_Faces);
+            m_LineSlots.swap(Other.m_LineSlots);
+            m_FaceSlots.swap(Other.m_FaceSlots);
+            m_FaceCache.Swap(Other.m_FaceCache);
+        }
+
+        /***********************************************************************
+        【函数名称】 CopyFrom
+        【函数功能】 深拷贝另一个模型，替换当前全部数据。被多个元素共享的点在副本中
+        仍被共享，副本与原模型之间不共享任何对象，可交给其他线程只读使用
+        【参数】 
+            - const Model<N>& Other（输入参数）：另一个模型
+        【返回值】 无
+        Created by 朱昊东 on 2026/10/18
+        【更改记录】 
+            2026/10/18
+            - 副本的面属性缓存全部标记为无效
+            - 副本沿用原模型的存储顺序与编号
+        ***********************************************************************/
+        void CopyFrom(const Model<N>& Other) {
+            if (&Other == this) {
+                return;
+            }
+            std::unordered_map<const Point<N>*, std::shared_ptr<Point<N>>>
+                Copies;
+            Copies.reserve(
+                Other.m_Lines.size() * 2 + Other.m_Faces.size() * 3);
+            auto CopyElements = [&](const auto& Source, auto& Target) {
+                Target.clear();
+                Target.reserve(Source.size());
+                for (const auto& Element : Source) {
+                    auto Copy = std::make_shared<
+                        typename std::decay_t<decltype(*Element)>>(*Element);
+                    auto Points = Element->GetPointsVector();
+                    for (std::size_t i = 0; i < Points.size(); i++) {
+                        auto& PointCopy = Copies[Points[i].get()];
+                        if (!PointCopy) {
+                            PointCopy = std::make_shared<Point<N>>(*Points[i]);
+                        }//每个点只复制一次
+                        Copy->SetPoint(i, PointCopy);
+                    }
+                    Target.push_back(Copy);
+                }
+            };
+            m_Name = Other.m_Name;
+            CopyElements(Other.m_Lines, m_Lines);
+            CopyElements(Other.m_Faces, m_Faces);
+            m_LineSlots = Other.m_LineSlots;
+            m_FaceSlots = Other.m_FaceSlots;
+            m_FaceCache.Reset(m_Faces.size());
+        }
+
+        /***********************************************************************
+        【函数名称】 WeldPoints
+        【函数功能】 合并相距在容差以内的点，使线和面共享同一个点对象；
+        两个顶点被合并到同一点而退化的元素会被删除
+        【参数】 
+            - double Tolerance（输入参数）：容差，默认与Point::IsSame一致
+        【返回值】 WeldReport：焊接结果
+        Created by 朱昊东 on 2026/10/18
+        【更改记录】 
+            2026/10/18
+            - 点被移到代表点上，面属性缓存全部标记为无效
+            - 删除退化的元素后，其余元素的序号保持原来的相对顺序
+        ***********************************************************************/
+        WeldReport WeldPoints(
+            double Tolerance = PointWelder<N>::DefaultTolerance) {
+            PointWelder<N> Welder(Tolerance);
+            std::unordered_map<const Point<N>*, std::size_t> Welded;
+            Welded.reserve(m_Lines.size() * 2 + m_Faces.size() * 3);
+            std::size_t DegenerateElements = 0;
+            auto WeldElements = [&](auto& Elements, auto& Slots) {
+                for (const auto& Element : Elements) {
+                    auto Points = Element->GetPointsVector();
+                    for (std::size_t i = 0; i < Points.size(); i++) {
+                        auto It = Welded.find(Points[i].get());
+                        if (It == Welded.end()) {
+                            It = Welded.emplace(Points[i].get(),
+                                Welder.Weld(Points[i])).first;
+                        }//每个点对象只查找一次网格
+                        Element->SetPoint(i,
+                            Welder.Representatives[It->second]);
+                    }
+                }
+                auto IsDegenerate = [](const auto& Element) {
+                    auto Points = Element->GetPointsVector();
+                    for (std::size_t i = 0; i < Points.size(); i++) {
+                        if (Points[i] == Points[(i + 1) % Points.size()]) {
+                            return true;
+                        }
+                    }
+                    return false;
+                };
+                std::vector<bool> IsRemoved(Elements.size(), false);
+                std::size_t Kept = 0;
+                for (std::size_t i = 0; i < Elements.size(); i++) {
+                    if (IsDegenerate(Elements[i])) {
+                        IsRemoved[i] = true;
+                    }
+                    else {
+                        Elements[Kept++] = std::move(Elements[i]);
+                    }
+                }
+                DegenerateElements += Elements.size() - Kept;
+                Elements.resize(Kept);
+                RemoveSlots(Slots, IsRemoved);
+            };
+            WeldElements(m_Lines, m_LineSlots);
+            WeldElements(m_Faces, m_FaceSlots);
+            m_FaceCache.Reset(m_Faces.size());
+            WeldReport Report;
+            Report.PointsBefore = Welded.size();
+            Report.PointsAfter = Welder.Representatives.size();
+            Report.BytesSaved = (Report.PointsBefore - Report.PointsAfter)
+                * PointWelder<N>::BytesPerPoint;
+            Report.DegenerateElements = DegenerateElements;
+            return Report;
+        }
+
+        /***********************************************************************
+        【函数名称】 ReorderFaces
+        【函数功能】 重排面，重排后存储位置i上的面为原来存储位置Order[i]上的面；
+        面的序号随之改变，与存储位置一致
+        【参数】 
+            - const std::vector<std::size_t>& Order（输入参数）：存储位置的排列
+        【返回值】 无
+        Created by 朱昊东 on 2026/10/18
+        【更改记录】 
+            2026/10/18
+            - 面属性缓存全部标记为无效
+            - 清空面的编号到存储位置的映射
+        ***********************************************************************/
+        void ReorderFaces(const std::vector<std::size_t>& Order) {
+            if (Order.size() != m_Faces.size()) {
+                throw ExceptionIndexOutOfBounds(Order.size());
+            }
+            std::vector<std::shared_ptr<Face<N>>> Reordered;
+            Reordered.reserve(m_Faces.size());
+            for (std::size_t Index : Order) {
+                if (Index >= m_Faces.size()) {
+                    throw ExceptionIndexOutOfBounds(Index);
+                }
+                Reordered.push_back(m_Faces[Index]);
+            }
+            m_Faces.swap(Reordered);
+            m_FaceSlots.clear();
+            m_FaceCache.Reset(m_Faces.size());
+        }
+
+        /***********************************************************************
+        【函数名称】 Compact
+        【函数功能】 按LineOrder与FaceOrder重排线和面的存储（重排后存储位置i上
+        的元素为原来存储位置Order[i]上的元素），并把线、面各复制到一块连续的
+        内存中；点按PointOrder的顺序（未列出的点按在新存储顺序中首次出现的顺序
+        排在后面）复制到一块连续的内存中。模型持有指向其中对象的别名shared_ptr，
+        按存储顺序遍历时访问的内存也是连续的。线和面的序号不变，只改变它们对应的
+        存储位置；点的共享关系保持不变。此前取得的对象仍然有效，但不再属于模型，
+        整块内存在其中所有对象都被释放后才会释放
+        【参数】 
+            - const std::vector<std::size_t>& LineOrder（输入参数）：线的存储
+            位置的排列
+            - const std::vector<std::size_t>& FaceOrder（输入参数）：面的存储
+            位置的排列
+            - const std::vector<std::shared_ptr<Point<N>>>& PointOrder（输入参数）：
+            点的排列顺序
+        【返回值】 无
+        Created by 朱昊东 on 2026/10/18
+        【更改记录】 无
+        ***********************************************************************/
+        void Compact(const std::vector<std::size_t>& LineOrder,
+            const std::vector<std::size_t>& FaceOrder,
+            const std::vector<std::shared_ptr<Point<N>>>& PointOrder) {
+            if (LineOrder.size() != m_Lines.size()) {
+                throw ExceptionIndexOutOfBounds(LineOrder.size());
+            }
+            if (FaceOrder.size() != m_Faces.size()) {
+                throw ExceptionIndexOutOfBounds(FaceOrder.size());
+            }
+            for (std::size_t Slot : LineOrder) {
+                if (Slot >= m_Lines.size()) {
+                    throw ExceptionIndexOutOfBounds(Slot);
+                }
+            }
+            for (std::size_t Slot : FaceOrder) {
+                if (Slot >= m_Faces.size()) {
+                    throw ExceptionIndexOutOfBounds(Slot);
+                }
+            }
+            std::unordered_map<const Point<N>*, std::size_t> Slots;
+            std::vector<const Point<N>*> Sources;
+            Slots.reserve(PointOrder.size());
+            auto AddSource = [&](const Point<N>* P) {
+                if (Slots.emplace(P, Sources.size()).second) {
+                    Sources.push_back(P);
+                }
+            };
+            for (const auto& P : PointOrder) {
+                AddSource(P.get());
+            }
+            for (std::size_t Slot : LineOrder) {
+                AddSource(m_Lines[Slot]->First.get());
+                AddSource(m_Lines[Slot]->Second.get());
+            }
+            for (std::size_t Slot : FaceOrder) {
+                AddSource(m_Faces[Slot]->First.get());
+                AddSource(m_Faces[Slot]->Second.get());
+                AddSource(m_Faces[Slot]->Third.get());
+            }
+            auto Points = std::make_shared<std::vector<Point<N>>>();
+            Points->reserve(Sources.size());
+            for (const Point<N>* P : Sources) {
+                Points->push_back(*P);
+            }
+            auto CompactElements = [&](auto& Elements,
+                const std::vector<std::size_t>& Order, auto& IndexSlots) {
+                using ElementType = typename std::decay_t<
+                    decltype(Elements)>::value_type::element_type;
+                auto Pool = std::make_shared<std::vector<ElementType>>();
+                Pool->reserve(Elements.size());
+                std::decay_t<decltype(Elements)> Reordered;
+                Reordered.reserve(Elements.size());
+                std::vector<std::size_t> NewSlot(Elements.size());
+                for (std::size_t i = 0; i < Order.size(); i++) {
+                    const auto& Element = Elements[Order[i]];
+                    Pool->push_back(*Element);
+                    ElementType& Copy = Pool->back();
+                    auto ElementPoints = Element->GetPointsVector();
+                    for (std::size_t k = 0; k < ElementPoints.size(); k++) {
+                        Copy.SetPoint(k, std::shared_ptr<Point<N>>(Points,
+                            &(*Points)[Slots[ElementPoints[k].get()]]));
+                    }//别名指针共享整块点内存的引用计数
+                    Reordered.emplace_back(Pool, &Copy);
+                    NewSlot[Order[i]] = i;
+                }//已预留容量，Copy的地址不会改变
+                bool IsIdentity = true;
+                std::vector<std::size_t> NewIndexSlots(Elements.size());
+                for (std::size_t Index = 0; Index < Elements.size(); Index++) {
+                    NewIndexSlots[Index] = NewSlot[
+                        IndexSlots.empty() ? Index : IndexSlots[Index]];
+                    IsIdentity = IsIdentity && NewIndexSlots[Index] == Index;
+                }
+                if (IsIdentity) {
+                    NewIndexSlots.clear();
+                }//序号与存储位置一致时不保留映射
+                Elements.swap(Reordered);
+                IndexSlots.swap(NewIndexSlots);
+            };
+            CompactElements(m_Lines, LineOrder, m_LineSlots);
+            CompactElements(m_Faces, FaceOrder, m_FaceSlots);
+            m_FaceCache.Reset(m_Faces.size());
+        }
+
+        /***********************************************************************
+        【函数名称】 GetLineSlot
+        【函数功能】 获取线的存储位置
+        【参数】 
+            - std::size_t Index（输入参数）：线的序号，应小于线数
+        【返回值】 std::size_t：该线在Lines中的位置
+        Created by 朱昊东 on 2026/10/18
+        【更改记录】 无
+        ***********************************************************************/
+        std::size_t GetLineSlot(std::size_t Index) const {
+            return m_LineSlots.empty() ? Index : m_LineSlots[Index];
+        }
+
+        /***********************************************************************
+        【函数名称】 GetFaceSlot
+        【函数功能】 获取面的存储位置
+        【参数】 
+            - std::size_t Index（输入参数）：面的序号，应小于面数
+        【返回值】 std::size_t：该面在Faces与面属性缓存中的位置
+        Created by 朱昊东 on 2026/10/18
+        【更改记录】 无
+        ***********************************************************************/
+        std::size_t GetFaceSlot(std::size_t Index) const {
+            return m_FaceSlots.empty() ? Index : m_FaceSlots[Index];
+        }
+
+        /***********************************************************************
+        【函数名称】 GetLineIndicesBySlot
+        【函数功能】 获取各存储位置上的线的序号，用于把按Lines得到的结果换算为
+        序号
+        【参数】 无
+        【返回值】 std::vector<std::size_t>：第i项为Lines[i]的序号
+        Created by 朱昊东 on 2026/10/18
+        【更改记录】 无
+        ***********************************************************************/
+        std::vector<std::size_t> GetLineIndicesBySlot() const {
+            return InvertSlots(m_LineSlots, m_Lines.size());
+        }
+
+        /***********************************************************************
+        【函数名称】 GetFaceIndicesBySlot
+        【函数功能】 获取各存储位置上的面的序号，用于把按Faces得到的结果换算为
+        序号
+        【参数】 无
+        【返回值】 std::vector<std::size_t>：第i项为Faces[i]的序号
+        Created by 朱昊东 on 2026/10/18
+        【更改记录】 无
+        ***********************************************************************/
+        std::vector<std::size_t> GetFaceIndicesBySlot() const {
+            return InvertSlots(m_FaceSlots, m_Faces.size());
+        }
+
+        /***********************************************************************
+        【函数名称】 Assign
+        【函数功能】 用索引形式的数据替换模型的全部线和面（名称不变）：点、线、面
+        各构造在一块连续的内存中，模型持有指向其中对象的别名shared_ptr，不为每个
+        对象单独分配内存。同一序号的点被所有引用它的元素共享；不被任何元素引用的
+        点也占用内存，直到整块释放。构造元素时抛出异常（如相同的点）则模型不变
+        【参数】 
+            - const std::vector<double>& Coordinates（输入参数）：各点的坐标，
+            每N个为一个点
+            - const std::vector<std::size_t>& LineIndices（输入参数）：每条线的
+            两个点序号，依次存放
+            - const std::vector<std::size_t>& FaceIndices（输入参数）：每个面的
+            三个点序号，依次存放
+        【返回值】 无
+        Created by 朱昊东 on 2026/10/18
+        【更改记录】 无
+        ***********************************************************************/
+        void Assign(const std::vector<double>& Coordinates,
+            const std::vector<std::size_t>& LineIndices,
+            const std::vector<std::size_t>& FaceIndices) {
+            const std::size_t PointCount = Coordinates.size() / N;
+            auto Points = std::make_shared<std::vector<Point<N>>>();
+            Points->reserve(PointCount);
+            for (std::size_t i = 0; i < PointCount; i++) {
+                Points->emplace_back(&Coordinates[i * N]);
+            }
+            auto Alias = [&Points](std::size_t Index) {
+                return std::shared_ptr<Point<N>>(Points, &(*Points)[Index]);
+            };
+            auto Lines = std::make_shared<std::vector<Line<N>>>();
+            Lines->reserve(LineIndices.size() / 2);
+            std::vector<std::shared_ptr<Line<N>>> NewLines;
+            NewLines.reserve(LineIndices.size() / 2);
+            for (std::size_t i = 0; i + 1 < LineIndices.size(); i += 2) {
+                Lines->emplace_back(Alias(LineIndices[i]),
+                    Alias(LineIndices[i + 1]));
+                NewLines.emplace_back(Lines, &Lines->back());
+            }//已预留容量，元素的地址不会改变
+            auto Faces = std::make_shared<std::vector<Face<N>>>();
+            Faces->reserve(FaceIndices.size() / 3);
+            std::vector<std::shared_ptr<Face<N>>> NewFaces;
+            NewFaces.reserve(FaceIndices.size() / 3);
+            for (std::size_t i = 0; i + 2 < FaceIndices.size(); i += 3) {
+                Faces->emplace_back(Alias(FaceIndices[i]),
+                    Alias(FaceIndices[i + 1]), Alias(FaceIndices[i + 2]));
+                NewFaces.emplace_back(Faces, &Faces->back());
+            }
+            m_Lines.swap(NewLines);
+            m_Faces.swap(NewFaces);
+            m_LineSlots.clear();
+            m_FaceSlots.clear();
+            m_FaceCache.Reset(m_Faces.size());
+        }
+
+        /***********************************************************************
+        【函数名称】 MovePoints
+        【函数功能】 对线和面引用的每个点对象调用NewCoordinates，返回非空时把点的
+        坐标改为其指向的N个值。点对象不被替换，共享同一点的元素仍然相连；被多个
+        元素共享的点会被调用多次，NewCoordinates对同一点应返回相同的坐标。
+        完成后面属性缓存全部标记为无效
+        【参数】 
+            - const Locator& NewCoordinates（输入参数）：可调用对象，参数为
+            const Point<N>*，返回const double*，为nullptr时该点不动
+        【返回值】 无
+        Created by 朱昊东 on 2026/10/18
+        【更改记录】 无
+        ***********************************************************************/
+        template <typename Locator>
+        void MovePoints(const Locator& NewCoordinates) {
+            auto MoveElements = [&](auto& Elements) {
+                for (const auto& Element : Elements) {
+                    for (const auto& P : Element->GetPointsVector()) {
+                        const double* Coordinates = NewCoordinates(
+                            static_cast<const Point<N>*>(P.get()));
+                        if (Coordinates != nullptr) {
+                            P->SetCoordinates(Coordinates);
+                        }
+                    }
+                }
+            };
+            MoveElements(m_Lines);
+            MoveElements(m_Faces);
+            m_FaceCache.Reset(m_Faces.size());
+        }
+
+        /***********************************************************************
+        【函数名称】 TransformPoints
+        【函数功能】 把Coordinates中的坐标依次写入Points中的点对象，点对象与其
+        共享关系不变；再按Matrix换算面属性缓存中有效的项，不重新计算。
+        Points应包含模型的所有点且各不相同（如IndexedModel::Points），
+        Coordinates应为它们经Matrix变换后的坐标，否则缓存与模型不一致
+        【参数】 
+            - const std::vector<std::shared_ptr<Point<N>>>& Points（输入参数）：
+            模型的所有点
+            - const std::vector<double>& Coordinates（输入参数）：各点的新坐标，
+            每N个为一个点
+            - const double* Matrix（输入参数）：(N + 1)×(N + 1)的仿射矩阵，按行存放
+        【返回值】 无
+        Created by 朱昊东 on 2026/10/18
+        【更改记录】 无
+        ***********************************************************************/
+        void TransformPoints(
+            const std::vector<std::shared_ptr<Point<N>>>& Points,
+            const std::vector<double>& Coordinates, const double* Matrix) {
+            for (std::size_t i = 0; i < Points.size(); i++) {
+                Points[i]->SetCoordinates(&Coordinates[i * N]);
+            }
+            m_FaceCache.Transform(Matrix, m_Faces);
+        }
+
+        /***********************************************************************
+        【函数名称】 GetFaceAttributes
+        【函数功能】 重新计算失效的面属性后返回缓存，第i项对应Faces[i]。
+        只经由本类的方法修改面时缓存才能保持正确；首次调用会写缓存，
+        不能与其他调用或修改并发
+        【参数】 无
+        【返回值】 const FaceAttributeCache<N>&：面属性缓存
+        Created by 朱昊东 on 2026/10/18
+        【更改记录】 无
+        ***********************************************************************/
+        const FaceAttributeCache<N>& GetFaceAttributes() const {
+            m_FaceCache.Refresh(m_Faces);
+            return m_FaceCache;
+        }
+
     private:
+        /***********************************************************************
+        【函数名称】 EraseSlot
+        【函数功能】 删除第Index项的映射，存储位置在其后的项前移一位
+        【参数】 
+            - std::vector<std::size_t>& Slots（输入输出参数）：序号到存储位置的
+            映射，为空时不变
+            - std::size_t Index（输入参数）：被删除元素的序号
+        【返回值】 无
+        Created by 朱昊东 on 2026/10/18
+        【更改记录】 无
+        ***********************************************************************/
+        static void EraseSlot(std::vector<std::size_t>& Slots,
+            std::size_t Index) {
+            if (Slots.empty()) {
+                return;
+            }
+            std::size_t Erased = Slots[Index];
+            Slots.erase(Slots.begin() + Index);
+            for (std::size_t& Slot : Slots) {
+                if (Slot > Erased) {
+                    Slot--;
+                }
+            }
+        }
+
+        /***********************************************************************
+        【函数名称】 RemoveSlots
+        【函数功能】 删除存储位置被标记的项，其余项按删除后的存储位置重新编排
+        【参数】 
+            - std::vector<std::size_t>& Slots（输入输出参数）：序号到存储位置的
+            映射，为空时不变
+            - const std::vector<bool>& IsRemoved（输入参数）：各存储位置上的元素
+            是否被删除
+        【返回值】 无
+        Created by 朱昊东 on 2026/10/18
+        【更改记录】 无
+        ***********************************************************************/
+        static void RemoveSlots(std::vector<std::size_t>& Slots,
+            const std::vector<bool>& IsRemoved) {
+            if (Slots.empty()) {
+                return;
+            }
+            std::vector<std::size_t> Shifted(IsRemoved.size());
+            std::size_t Kept = 0;
+            for (std::size_t i = 0; i < IsRemoved.size(); i++) {
+                Shifted[i] = Kept;
+                if (!IsRemoved[i]) {
+                    Kept++;
+                }
+            }
+            std::size_t Count = 0;
+            for (std::size_t Slot : Slots) {
+                if (!IsRemoved[Slot]) {
+                    Slots[Count++] = Shifted[Slot];
+                }
+            }
+            Slots.resize(Count);
+        }
+
+        /***********************************************************************
+        【函数名称】 InvertSlots
+        【函数功能】 求序号到存储位置映射的逆映射
+        【参数】 
+            - const std::vector<std::size_t>& Slots（输入参数）：序号到存储位置
+            的映射，为空表示二者一致
+            - std::size_t Count（输入参数）：元素数
+        【返回值】 std::vector<std::size_t>：第i项为存储位置i上的元素的序号
+        Created by 朱昊东 on 2026/10/18
+        【更改记录】 无
+        ***********************************************************************/
+        static std::vector<std::size_t> InvertSlots(
+            const std::vector<std::size_t>& Slots, std::size_t Count) {
+            std::vector<std::size_t> Indices(Count);
+            for (std::size_t i = 0; i < Count; i++) {
+                Indices[Slots.empty() ? i : Slots[i]] = i;
+            }
+            return Indices;
+        }
+
         std::string m_Name;
         std::vector<std::shared_ptr<Line<N>>> m_Lines;
         std::vector<std::shared_ptr<Face<N>>> m_Faces;
+        //线和面的序号到存储位置的映射，为空时序号即存储位置
+        std::vector<std::size_t> m_LineSlots;
+        std::vector<std::size_t> m_FaceSlots;
+        //面属性缓存，在const方法中按需重新计算
+        mutable FaceAttributeCache<N> m_FaceCache;
 };
 
 #endif // MODEL_HPP
\ No newline at end of file
@@ -0,0 +1,179 @@
+/*******************************************************************************
+【文件名】 PointWelder.hpp
+【功能模块和目的】 定义PointWelder类模板与WeldReport结构体，借助空间哈希网格在线性
+时间内把彼此距离在容差以内的点合并为同一个点对象
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+#ifndef POINT_WELDER_HPP
+#define POINT_WELDER_HPP
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include "Point.hpp"
+
+/*******************************************************************************
+【结构体名】 WeldReport
+【功能】 结构体，表示一次焊接的结果
+【接口说明】
+    - std::size_t PointsBefore
+        焊接前不同点对象的个数
+    - std::size_t PointsAfter
+        焊接后不同点对象的个数
+    - std::size_t BytesSaved
+        释放的点对象及其引用计数块所占的字节数（估计值）
+    - std::size_t DegenerateElements
+        因两个顶点被合并而退化、已被删除的线或面的个数
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+struct WeldReport {
+    std::size_t PointsBefore;
+    std::size_t PointsAfter;
+    std::size_t BytesSaved;
+    std::size_t DegenerateElements;
+};
+
+/*******************************************************************************
+【类名】 PointWelder
+【功能】 点焊接器。以容差为边长把空间划分为网格，每个网格单元记录落在其中的代表点；
+查找时只检查点所在单元及相邻的3^N个单元，各坐标之差均不超过容差的点（与
+Point::IsSame的判定一致）归并到最先出现的代表点上
+【接口说明】
+    - static constexpr double DefaultTolerance
+        默认容差，与Point::IsSame一致
+    - PointWelder(double Tolerance = DefaultTolerance)
+        构造函数，传入容差
+    - std::size_t Weld(const std::shared_ptr<Point<N>>& P)
+        返回P对应的代表点序号；没有可合并的代表点时P自身成为新的代表点
+    - const std::vector<std::shared_ptr<Point<N>>>& Representatives
+        按出现顺序排列的代表点
+    - static constexpr std::size_t BytesPerPoint
+        每个点对象及其引用计数块大致占用的字节数
+ Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+template <std::size_t N>
+class PointWelder {
+    public:
+        static constexpr double DefaultTolerance = 1e-6;
+        //点对象加上shared_ptr控制块（虚表指针与两个引用计数）
+        static constexpr std::size_t BytesPerPoint = sizeof(Point<N>)
+            + sizeof(void*) + 2 * sizeof(long);
+
+        /***********************************************************************
+        【函数名称】 PointWelder
+        【函数功能】 构造函数
+        【参数】
+            - double Tolerance（输入参数）：容差，同时作为网格单元的边长
+        【返回值】 无
+        Created by 朱昊东 on 2026/10/18
+        【更改记录】 无
+        ***********************************************************************/
+        explicit PointWelder(double Tolerance = DefaultTolerance):
+            m_Tolerance(Tolerance) {}
+
+        PointWelder(const PointWelder<N>& Other) = delete;
+        PointWelder<N>& operator=(const PointWelder<N>& Other) = delete;
+
+        const std::vector<std::shared_ptr<Point<N>>>& Representatives {
+            m_Representatives };
+
+        /***********************************************************************
+        【函数名称】 Weld
+        【函数功能】 查找与P相距在容差以内的代表点，找不到时登记P为新的代表点
+        【参数】
+            - const std::shared_ptr<Point<N>>& P（输入参数）：点
+        【返回值】 std::size_t：代表点在Representatives中的序号
+        Created by 朱昊东 on 2026/10/18
+        【更改记录】 无
+        ***********************************************************************/
+        std::size_t Weld(const std::shared_ptr<Point<N>>& P) {
+            Cell Home = GetCell(*P);
+            Cell Neighbor;
+            std::size_t Combinations = 1;
+            for (std::size_t i = 0; i < N; i++) {
+                Combinations *= 3;
+            }
+            for (std::size_t Code = 0; Code < Combinations; Code++) {
+                std::size_t Rest = Code;
+                for (std::size_t i = 0; i < N; i++) {
+                    Neighbor[i] = Home[i] + static_cast<std::int64_t>(Rest % 3)
+                        - 1;
+                    Rest /= 3;
+                }//以三进制枚举各维偏移-1、0、1
+                auto It = m_Cells.find(Neighbor);
+                if (It == m_Cells.end()) {
+                    continue;
+                }
+                for (std::size_t Index: It->second) {
+                    if (IsWithinTolerance(*m_Representatives[Index], *P)) {
+                        return Index;
+                    }
+                }
+            }
+            m_Cells[Home].push_back(m_Representatives.size());
+            m_Representatives.push_back(P);
+            return m_Representatives.size() - 1;
+        }
+
+    private:
+        using Cell = std::array<std::int64_t, N>;
+
+        /***********************************************************************
+        【类名】 CellHash
+        【功能】 网格单元坐标的哈希函数
+        Created by 朱昊东 on 2026/10/18
+        【更改记录】 无
+        ***********************************************************************/
+        struct CellHash {
+            std::size_t operator()(const Cell& C) const {
+                std::uint64_t Hash = 1469598103934665603ULL;
+                for (std::size_t i = 0; i < N; i++) {
+                    Hash ^= static_cast<std::uint64_t>(C[i]);
+                    Hash *= 1099511628211ULL;
+                    Hash ^= Hash >> 29;
+                }
+                return static_cast<std::size_t>(Hash);
+            }
+        };
+
+        //计算点所在的网格单元，过大的坐标被截断到同一单元，仍会逐一比较
+        Cell GetCell(const Point<N>& P) const {
+            const double Limit = 4e18;
+            Cell Result;
+            for (std::size_t i = 0; i < N; i++) {
+                double Scaled = std::floor(P.GetCoordinate(i) / m_Tolerance);
+                if (!(Scaled > -Limit)) {
+                    Scaled = -Limit;
+                }//同时处理NaN
+                if (Scaled > Limit) {
+                    Scaled = Limit;
+                }
+                Result[i] = static_cast<std::int64_t>(Scaled);
+            }
+            return Result;
+        }
+
+        //各坐标之差均不超过容差
+        bool IsWithinTolerance(const Point<N>& P1, const Point<N>& P2) const {
+            for (std::size_t i = 0; i < N; i++) {
+                if (std::fabs(P1.GetCoordinate(i) - P2.GetCoordinate(i))
+                    > m_Tolerance) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        double m_Tolerance;
+        std::vector<std::shared_ptr<Point<N>>> m_Representatives;
+        std::unordered_map<Cell, std::vector<std::size_t>, CellHash> m_Cells;
+};
+
+#endif // POINT_WELDER_HPP
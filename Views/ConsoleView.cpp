@@ -7,10 +7,41 @@
     - 修改了Run方法，使得用户可以在文件加载失败时重新输入文件路径
     2024/8/17
     - 修改了一些缩进问题
+    2026/10/18
+    - 增添了压缩格式测评命令
+    - 启动时以后台加载的方式显示加载进度，增添了后台加载、查看进度与取消加载命令
+    - 增添了按需读取.obj文件的惰性模式命令
+    - 增添了焊接重合点的命令
+    - 保存改为在后台进行
+    - 增添了检查点命令，加载后显示重放的编辑数
+    - 增添了简化模型的命令
+    - 增添了顶点缓存优化的命令
+    - 增添了空间重排的命令
+    - 增添了连通部分的命令
+    - 列出面时从面属性缓存读取面积并显示法向
+    - 统计信息增添了体积、质心与惯性张量
+    - 统计信息增添了有向包围盒
+    - 增添了凸包的导出与测评命令
+    - 增添了导出有向距离场的命令
+    - 增添了自相交与模型间相交的检测命令
+    - 增添了批量判断点是否在模型内部的命令
+    - 增添了线与面的相交检测命令
+    - 增添了Loop细分的命令
+    - 增添了Taubin光顺的命令
+    - 增添了面质量分析的命令
+    - 增添了仿射变换的命令
+    - 增添了测地最短路径的命令
+    - 增添了形状属性的命令
 *******************************************************************************/
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
 #include <iostream>
+#include <thread>
 #include "ConsoleView.hpp"
 #include "../Controllers/Controller.hpp"
+#include "../Exporter&Importer/LazyObjFile.hpp"
 
 #include "ConsoleView.hpp"
 #include <iostream>
@@ -28,6 +59,29 @@ Created by 朱昊东 on 2024/7/29
     - 修改了Run方法，使得用户可以在文件加载失败时重新输入文件路径
     2024/8/17
     - 修改了一些缩进问题
+    2026/10/18
+    - 增添了命令15
+    - 增添了命令16~18，每次读取命令前收取已结束的后台加载
+    - 增添了命令19~21
+    - 增添了命令22~23
+    - 每次读取命令前收取已结束的后台保存，退出前等待保存完成
+    - 增添了命令24
+    - 增添了命令25
+    - 增添了命令26
+    - 增添了命令27
+    - 增添了命令28~29
+    - 增添了命令30~31
+    - 增添了命令32
+    - 增添了命令33~34
+    - 增添了命令35
+    - 增添了命令36
+    - 增添了命令37
+    - 增添了命令38
+    - 增添了命令39
+    - 增添了命令40~43
+    - 增添了命令44~45
+    - 有未保存的修改时退出前请用户确认
+    - 增添了命令46
 *******************************************************************************/
 void ConsoleView::Run(Controller& Controller) const {
     std::string Command;
@@ -45,6 +99,8 @@ void ConsoleView::Run(Controller& Controller) const {
     }
 
     while (true) {
+        CollectBackgroundLoad(Controller, &FilePath);
+        CollectBackgroundSave(Controller, false);
         std::cout
             << "Please enter a Command "
             << "(use 'help' to display available commands): ";
@@ -92,7 +148,107 @@ void ConsoleView::Run(Controller& Controller) const {
             ShowHelp();
             continue;
         } else if (Command == "14") {
+            CollectBackgroundSave(Controller, true);
+            if (!ConfirmExit(Controller)) {
+                continue;
+            }
             break;
+        } else if (Command == "15") {
+            BenchmarkCompression(Controller);
+            continue;
+        } else if (Command == "16") {
+            LoadModelInBackground(Controller);
+            continue;
+        } else if (Command == "17") {
+            ShowLoadProgress(Controller);
+            continue;
+        } else if (Command == "18") {
+            CancelLoad(Controller);
+            continue;
+        } else if (Command == "19") {
+            OpenModelLazy(Controller);
+            continue;
+        } else if (Command == "20") {
+            ListLazyFaces(Controller);
+            continue;
+        } else if (Command == "21") {
+            ListLazyFace_sPoints(Controller);
+            continue;
+        } else if (Command == "22") {
+            WeldPoints(Controller);
+            continue;
+        } else if (Command == "23") {
+            SetWelding(Controller);
+            continue;
+        } else if (Command == "24") {
+            Checkpoint(Controller);
+            continue;
+        } else if (Command == "25") {
+            SimplifyModel(Controller);
+            continue;
+        } else if (Command == "26") {
+            OptimizeVertexCache(Controller);
+            continue;
+        } else if (Command == "27") {
+            ReorderSpatially(Controller);
+            continue;
+        } else if (Command == "28") {
+            ListComponents(Controller);
+            continue;
+        } else if (Command == "29") {
+            ExportComponents(Controller);
+            continue;
+        } else if (Command == "30") {
+            ExportConvexHull(Controller);
+            continue;
+        } else if (Command == "31") {
+            BenchmarkConvexHull(Controller);
+            continue;
+        } else if (Command == "32") {
+            ExportDistanceField(Controller);
+            continue;
+        } else if (Command == "33") {
+            FindSelfIntersections(Controller);
+            continue;
+        } else if (Command == "34") {
+            FindIntersectionsWith(Controller);
+            continue;
+        } else if (Command == "35") {
+            ClassifyPoints(Controller);
+            continue;
+        } else if (Command == "36") {
+            FindLineFaceHits(Controller);
+            continue;
+        } else if (Command == "37") {
+            SubdivideModel(Controller);
+            continue;
+        } else if (Command == "38") {
+            SmoothModel(Controller);
+            continue;
+        } else if (Command == "39") {
+            AnalyzeQuality(Controller);
+            continue;
+        } else if (Command == "40") {
+            TranslateModel(Controller);
+            continue;
+        } else if (Command == "41") {
+            RotateModel(Controller);
+            continue;
+        } else if (Command == "42") {
+            ScaleModel(Controller);
+            continue;
+        } else if (Command == "43") {
+            TransformModel(Controller);
+            continue;
+        } else if (Command == "44") {
+            FindGeodesicPath(Controller);
+            continue;
+        } else if (Command == "45") {
+            GeodesicDistances(Controller);
+            continue;
+        } else if (Command == "46") {
+            ShowShapeProperties(Controller);
+            continue;
         } else {
             std::cout << "unknown Command: " << Command << std::endl;
         }
@@ -101,7 +257,7 @@ void ConsoleView::Run(Controller& Controller) const {
 
 /*******************************************************************************
 【函数名称】 LoadModel
-【函数功能】 加载模型
+【函数功能】 加载模型，加载期间持续显示进度
 【参数】 
     - Controller& Controller（输入参数）：Controller对象，控制器
     - std::string* Path（输入参数）：字符串指针，文件路径
@@ -110,9 +266,44 @@ Created by 朱昊东 on 2024/7/29
 【更改记录】 
     2024/8/17
     - 修改了一些缩进问题
+    2026/10/18
+    - 改为后台加载并显示进度，结果的输出移至ShowLoadResult
+    - 显示从编辑日志重放的编辑数
 *******************************************************************************/
 bool ConsoleView::LoadModel(Controller& Controller, std::string* Path) const {
-    auto Result = Controller.LoadModel(*Path);
+    std::shared_ptr<Controller::LoadTask> Task;
+    auto Result = Controller.LoadModelAsync(*Path, &Task);
+    if (Result == Controller::Result::R_BUSY) {
+        std::cout << "error: Another model is still loading." << std::endl;
+        return false;
+    }
+    while (!Task->IsReady()) {
+        PrintProgress(*Task);
+        std::cout << "\r" << std::flush;
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+    PrintProgress(*Task);
+    std::cout << std::endl;
+    Controller.CollectLoadedModel(&Result);
+    if (!ShowLoadResult(Result, *Path)) {
+        return false;
+    }
+    ShowReplayedEdits(Controller);
+    return true;
+}
+
+/*******************************************************************************
+【函数名称】 ShowLoadResult
+【函数功能】 显示加载结果
+【参数】 
+    - Controller::Result Result（输入参数）：加载结果
+    - const std::string& Path（输入参数）：字符串，文件路径
+【返回值】 bool ：是否成功加载
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+bool ConsoleView::ShowLoadResult(Controller::Result Result,
+    const std::string& Path) const {
     if (Result == Controller::Result::R_FILE_EXTENSION_ERROR) {
         std::cout << "error: Invalid file extension." << std::endl;
         return false;
@@ -120,40 +311,182 @@ bool ConsoleView::LoadModel(Controller& Controller, std::string* Path) const {
     else if (Result == Controller::Result::R_FILE_OPEN_ERROR) {
         std::cout 
             << "error: Cannot open file '"
-            << *Path << "'." << std::endl;
+            << Path << "'." << std::endl;
         return false;
     }
     else if (Result == Controller::Result::R_FILE_FORMAT_ERROR) {
         std::cout 
             << "error: File '"
-            << *Path << "' has invalid format." << std::endl;
+            << Path << "' has invalid format." << std::endl;
         return false;
     }
     else if (Result == Controller::Result::R_IDENTICAL_POINTS) {
         std::cout 
             << "error: File '"
-            << *Path << "' contains invalid elements." << std::endl;
+            << Path << "' contains invalid elements." << std::endl;
+        return false;
+    }
+    else if (Result == Controller::Result::R_CANCELLED) {
+        std::cout 
+            << "Loading of '"
+            << Path << "' was cancelled." << std::endl;
         return false;
     }
     std::cout 
         << "Successfully loaded '"
-        << *Path << "'." << std::endl;
+        << Path << "'." << std::endl;
     return true;
 }
 
+/*******************************************************************************
+【函数名称】 ShowReplayedEdits
+【函数功能】 若加载模型时从编辑日志重放了编辑，显示重放的编辑数
+【参数】 
+    - const Controller& Controller（输入参数）：Controller对象，控制器
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+void ConsoleView::ShowReplayedEdits(const Controller& Controller) const {
+    if (Controller.GetReplayedEditCount() > 0) {
+        std::cout
+            << "Replayed " << Controller.GetReplayedEditCount()
+            << " unsaved edit(s) from the journal." << std::endl;
+    }
+}
+
+/*******************************************************************************
+【函数名称】 PrintProgress
+【函数功能】 在当前行输出加载进度（不换行）
+【参数】 
+    - const Controller::LoadTask& Task（输入参数）：后台加载任务
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+void ConsoleView::PrintProgress(const Controller::LoadTask& Task) const {
+    const auto& Progress = Task.GetProgress();
+    std::cout
+        << "Loading '" << Task.Path << "': "
+        << static_cast<int>(Progress.GetFraction() * 100) << "% ("
+        << Progress.GetBytesRead() << "/" << Progress.GetTotalBytes()
+        << " bytes, " << Progress.GetElementsParsed() << " elements)";
+}
+
+/*******************************************************************************
+【函数名称】 CollectBackgroundLoad
+【函数功能】 若后台加载已结束，显示其结果；加载成功时更新默认保存路径
+【参数】 
+    - Controller& Controller（输入参数）：Controller对象，控制器
+    - std::string* Path（输出参数）：字符串指针，当前模型的文件路径
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 显示从编辑日志重放的编辑数
+    - 当前模型有未保存的修改时先请用户确认，拒绝时放弃加载的模型
+*******************************************************************************/
+void ConsoleView::CollectBackgroundLoad(Controller& Controller,
+    std::string* Path) const {
+    auto Task = Controller.GetPendingLoad();
+    Controller::Result Result;
+    if (!Task || !Controller.CollectLoadedModel(&Result)) {
+        return;
+    }
+    if (Result == Controller::Result::R_UNSAVED_CHANGES) {
+        if (!ConfirmReplace(Task->Path)) {
+            Controller.DiscardLoadedModel();
+            std::cout << "Kept the current model, discarded '"
+                << Task->Path << "'." << std::endl;
+            return;
+        }
+        Controller.CollectLoadedModel(&Result, true);
+    }
+    if (ShowLoadResult(Result, Task->Path)) {
+        *Path = Task->Path;
+        ShowReplayedEdits(Controller);
+    }
+}
+
+/*******************************************************************************
+【函数名称】 LoadModelInBackground
+【函数功能】 在后台加载新模型，加载期间仍可对当前模型执行其他命令
+【参数】 
+    - Controller& Controller（输入参数）：Controller对象，控制器
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+void ConsoleView::LoadModelInBackground(Controller& Controller) const {
+    std::cout << "Load model from: ";
+    std::string FileName;
+    std::cin >> FileName;
+    std::shared_ptr<Controller::LoadTask> Task;
+    auto Result = Controller.LoadModelAsync(FileName, &Task);
+    if (Result == Controller::Result::R_BUSY) {
+        std::cout << "error: Another model is still loading." << std::endl;
+        return;
+    }
+    std::cout
+        << "Loading '" << FileName << "' in background, "
+        << "the current model stays available until it finishes."
+        << std::endl;
+}
+
+/*******************************************************************************
+【函数名称】 ShowLoadProgress
+【函数功能】 显示后台加载的进度
+【参数】 
+    - const Controller& Controller（输入参数）：Controller对象，控制器
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+void ConsoleView::ShowLoadProgress(const Controller& Controller) const {
+    auto Task = Controller.GetPendingLoad();
+    if (!Task) {
+        std::cout << "No model is loading." << std::endl;
+        return;
+    }
+    PrintProgress(*Task);
+    std::cout << std::endl;
+}
+
+/*******************************************************************************
+【函数名称】 CancelLoad
+【函数功能】 取消后台加载，当前模型保持不变
+【参数】 
+    - Controller& Controller（输入参数）：Controller对象，控制器
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+void ConsoleView::CancelLoad(Controller& Controller) const {
+    auto Task = Controller.GetPendingLoad();
+    if (!Task) {
+        std::cout << "No model is loading." << std::endl;
+        return;
+    }
+    Task->Cancel();
+    Task->Wait();
+    std::cout << "Cancel requested for '" << Task->Path << "'." << std::endl;
+}
+
 /*******************************************************************************
 【函数名称】 SaveModel
 【函数功能】 保存模型
 【参数】 
-    - const Controller& Controller（输入参数）：Controller对象，控制器
+    - Controller& Controller（输入参数）：Controller对象，控制器
     - std::string DefaultPath（输入参数）：字符串，默认路径
-【返回值】 bool ：是否成功保存
+【返回值】 无
 Created by 朱昊东 on 2024/7/29
 【更改记录】 
     2024/8/17
     - 修改了一些缩进问题
+    2026/10/18
+    - 改为在后台保存当前模型的快照，结果由CollectBackgroundSave显示
 *******************************************************************************/
-void ConsoleView::SaveModel(const Controller& Controller, std::string DefaultPath) const {
+void ConsoleView::SaveModel(Controller& Controller, std::string DefaultPath) const {
     std::cout << "(Enter nothing to use default value '" << DefaultPath << "')" << std::endl;
     std::cout << "Save to: ";
     std::string FileName;
@@ -161,20 +494,72 @@ void ConsoleView::SaveModel(const Controller& Controller, std::string DefaultPat
     if (FileName.empty()) {
         FileName = DefaultPath;
     }
-    auto Result = Controller.SaveModel(FileName);
+    std::shared_ptr<Controller::SaveTask> Task;
+    auto Result = Controller.SaveModelAsync(FileName, &Task);
+    if (Result == Controller::Result::R_BUSY) {
+        std::cout
+            << "error: Still saving '"
+            << Controller.GetPendingSave()->Path << "'." << std::endl;
+        return;
+    }
+    std::cout
+        << "Saving to '" << FileName << "' in background, "
+        << "you can keep editing the model." << std::endl;
+}
+
+/*******************************************************************************
+【函数名称】 ShowSaveResult
+【函数功能】 显示保存结果
+【参数】 
+    - Controller::Result Result（输入参数）：保存结果
+    - const std::string& Path（输入参数）：字符串，文件路径
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+void ConsoleView::ShowSaveResult(Controller::Result Result,
+    const std::string& Path) const {
     if (Result == Controller::Result::R_FILE_EXTENSION_ERROR) {
         std::cout << "error: Invalid file extension." << std::endl;
         return;
     }
     else if (Result == Controller::Result::R_FILE_OPEN_ERROR) {
         std::cout
-            << "error: Cannot open file '"
-            << FileName << "'." << std::endl;
+            << "error: Cannot write file '"
+            << Path << "'." << std::endl;
         return;
     }
     std::cout
         << "Successfully saved to '"
-        << FileName << "'." << std::endl;
+        << Path << "'." << std::endl;
+}
+
+/*******************************************************************************
+【函数名称】 CollectBackgroundSave
+【函数功能】 若后台保存已结束，显示其结果；Wait为真时先等待保存结束
+【参数】 
+    - Controller& Controller（输入参数）：Controller对象，控制器
+    - bool Wait（输入参数）：是否等待尚未结束的保存
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+void ConsoleView::CollectBackgroundSave(Controller& Controller,
+    bool Wait) const {
+    auto Task = Controller.GetPendingSave();
+    if (!Task) {
+        return;
+    }
+    if (Wait && !Task->IsReady()) {
+        std::cout
+            << "Waiting for saving '" << Task->Path << "' to finish..."
+            << std::endl;
+        Task->Wait();
+    }
+    Controller::Result Result;
+    if (Controller.CollectSavedModel(&Result)) {
+        ShowSaveResult(Result, Task->Path);
+    }
 }
 
 /*******************************************************************************
@@ -186,6 +571,25 @@ Created by 朱昊东 on 2024/7/29
 【更改记录】 
     2024/8/17
     - 修改了一些缩进问题
+    2026/10/18
+    - 增添了命令15~21
+    - 增添了命令22~23
+    - 增添了命令24
+    - 增添了命令25
+    - 增添了命令26
+    - 增添了命令27
+    - 增添了命令28~29
+    - 增添了命令30~31
+    - 增添了命令32
+    - 增添了命令33~34
+    - 增添了命令35
+    - 增添了命令36
+    - 增添了命令37
+    - 增添了命令38
+    - 增添了命令39
+    - 增添了命令40~43
+    - 增添了命令44~45
+    - 增添了命令46
 *******************************************************************************/
 void ConsoleView::ShowHelp() const {
     std::cout 
@@ -203,7 +607,39 @@ void ConsoleView::ShowHelp() const {
         << "11 modify_line         - Modify line\n"
         << "12 statistics          - Show statistics\n"
         << "13 help                - Show available commands\n"
-        << "14 exit                - exit the program\n";
+        << "14 exit                - exit the program\n"
+        << "15 compress_benchmark  - Benchmark the compressed .cmf format\n"
+        << "16 load                - Load another model in background\n"
+        << "17 load_progress       - Show background loading progress\n"
+        << "18 cancel_load         - Cancel background loading\n"
+        << "19 lazy_open           - Index a large .obj file for lazy access\n"
+        << "20 lazy_list_faces     - List a range of faces of the lazy file\n"
+        << "21 lazy_face's_points  - List points of a face of the lazy file\n"
+        << "22 weld                - Merge coincident points of the model\n"
+        << "23 weld_options        - Toggle welding on load and save\n"
+        << "24 checkpoint          - Fold the edit journal into the model file\n"
+        << "25 simplify            - Simplify faces by quadric edge collapse\n"
+        << "26 optimize_cache      - Vertex cache face order on export\n"
+        << "27 spatial_reorder     - Reorder storage along a Morton curve\n"
+        << "28 components          - List disconnected parts of the model\n"
+        << "29 export_components   - Save each disconnected part to its own file\n"
+        << "30 convex_hull         - Save the convex hull of the model\n"
+        << "31 hull_benchmark      - Benchmark convex hull on point clouds\n"
+        << "32 distance_field      - Save a signed distance field volume\n"
+        << "33 self_intersections  - List faces that cut through each other\n"
+        << "34 intersect_with      - List faces intersecting another model\n"
+        << "35 inside_test         - Test which points in a file are inside\n"
+        << "36 line_hits           - List faces pierced by the model's lines\n"
+        << "37 subdivide           - Refine the model by Loop subdivision\n"
+        << "38 smooth              - Remove noise by Taubin smoothing\n"
+        << "39 quality             - Histogram face angles and aspect ratios\n"
+        << "40 translate           - Move the whole model by an offset\n"
+        << "41 rotate              - Rotate the model about a coordinate axis\n"
+        << "42 scale               - Scale or mirror the model along the axes\n"
+        << "43 transform           - Apply a general affine matrix\n"
+        << "44 geodesic_path       - Add the shortest edge path as lines\n"
+        << "45 geodesic_field      - Edge distances from a point\n"
+        << "46 shape               - Volume, inertia and oriented boxes\n";
 }
 
 /*******************************************************************************
@@ -216,6 +652,10 @@ Created by 朱昊东 on 2024/7/29
 【更改记录】 
     2024/8/17
     - 修改了一些缩进问题
+    2026/10/18
+    - 增添了体积、质心与惯性张量
+    - 增添了有向包围盒
+    - 体积、质心、惯性张量与有向包围盒移至ShowShapeProperties
 *******************************************************************************/
 void ConsoleView::ShowStatistics(const Controller& Controller) const {
     auto stat = Controller.GetStatistics();
@@ -248,15 +688,23 @@ void ConsoleView::ShowStatistics(const Controller& Controller) const {
     - const Controller& Controller（输入参数）：Controller对象，控制器
 【返回值】 无
 Created by 朱昊东 on 2024/7/29
-【更改记录】 无
+【更改记录】 
+    2026/10/18
+    - 面积与法向从面属性缓存中读取
+    - 按面在缓存中的位置读取属性
 *******************************************************************************/
 void ConsoleView::ListFaces(const Controller& Controller) const {
     const auto& Faces = Controller.GetFaces();
+    const auto& Attributes = Controller.GetFaceAttributes();
     for (size_t i = 0; i < Faces.size(); i++) {
         const auto& Face = Faces[i];
+        std::size_t Slot = Controller.GetFaceSlotById(i + 1);
         std::cout << "Face " << i + 1 << ": ";
         std::cout << *Face << std::endl;
-        std::cout << "    Area: " << Face->GetArea() << std::endl;
+        std::cout << "    Area: " << Attributes.Areas[Slot] << std::endl;
+        std::cout << "    Normal: (" << Attributes.Normals[0][Slot] << ", "
+            << Attributes.Normals[1][Slot] << ", "
+            << Attributes.Normals[2][Slot] << ")" << std::endl;
     }
 }
 
@@ -362,7 +810,9 @@ void ConsoleView::RemoveFace(Controller& Controller) const {
     - Controller& Controller（输入参数）：Controller对象，控制器
 【返回值】 无
 Created by 朱昊东 on 2024/7/29
-【更改记录】 无
+【更改记录】
+    2026/10/18
+    - 输出点重合与面重复的错误信息
 *******************************************************************************/
 void ConsoleView::ModifyFace(Controller& Controller) const {
     std::cout << "Select a face to modify" << std::endl;
@@ -392,6 +842,12 @@ void ConsoleView::ModifyFace(Controller& Controller) const {
     else if (Result == Controller::Result::R_POINT_INDEX_ERROR) {
         std::cout << "error: Invalid point index '" << PointIndex << "'." << std::endl;
     }
+    else if (Result == Controller::Result::R_IDENTICAL_POINTS) {
+        std::cout << "error: Identical points within element." << std::endl;
+    }
+    else if (Result == Controller::Result::R_IDENTICAL_ELEMENTS) {
+        std::cout << "error: Identical elements within model." << std::endl;
+    }
     else {
         std::cout << "Successfully modified face #" << ID << "." << std::endl;
     }
@@ -515,7 +971,9 @@ void ConsoleView::RemoveLine(Controller& Controller) const {
     - Controller& Controller（输入参数）：Controller对象，控制器
 【返回值】 无
 Created by 朱昊东 on 2024/7/29
-【更改记录】 无
+【更改记录】
+    2026/10/18
+    - 输出点重合与线重复的错误信息
 *******************************************************************************/
 void ConsoleView::ModifyLine(Controller& Controller) const {
     std::cout << "Select a Line to modify" << std::endl;
@@ -546,7 +1004,1230 @@ void ConsoleView::ModifyLine(Controller& Controller) const {
     else if (Result == Controller::Result::R_POINT_INDEX_ERROR) {
         std::cout << "error: Invalid point index '" << PointIndex << "'." << std::endl;
     }
+    else if (Result == Controller::Result::R_IDENTICAL_POINTS) {
+        std::cout << "error: Identical points within element." << std::endl;
+    }
+    else if (Result == Controller::Result::R_IDENTICAL_ELEMENTS) {
+        std::cout << "error: Identical elements within model." << std::endl;
+    }
     else {
         std::cout << "Successfully modified Line #" << ID << "." << std::endl;
     }
-}
\ No newline at end of file
+}
+
+/*******************************************************************************
+【函数名称】 BenchmarkCompression
+【函数功能】 以.cmf格式保存并重新读入模型，显示压缩率与编解码吞吐量
+【参数】 
+    - const Controller& Controller（输入参数）：Controller对象，控制器
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 显示读回的文件含有无效元素的错误
+    - 显示开启焊接时的读回检查结果
+*******************************************************************************/
+void ConsoleView::BenchmarkCompression(const Controller& Controller) const {
+    std::cout << "Save compressed model to (.cmf): ";
+    std::string FileName;
+    std::cin >> FileName;
+    Controller::CompressionReport Report;
+    auto Result = Controller.BenchmarkCompression(FileName, &Report);
+    if (Result == Controller::Result::R_FILE_EXTENSION_ERROR) {
+        std::cout << "error: Invalid file extension." << std::endl;
+        return;
+    }
+    else if (Result == Controller::Result::R_FILE_OPEN_ERROR) {
+        std::cout
+            << "error: Cannot open file '"
+            << FileName << "'." << std::endl;
+        return;
+    }
+    else if (Result == Controller::Result::R_FILE_FORMAT_ERROR) {
+        std::cout
+            << "error: File '"
+            << FileName << "' has invalid format." << std::endl;
+        return;
+    }
+    else if (Result == Controller::Result::R_IDENTICAL_POINTS
+        || Result == Controller::Result::R_IDENTICAL_ELEMENTS) {
+        std::cout
+            << "error: File '"
+            << FileName << "' contains invalid elements." << std::endl;
+        return;
+    }
+    double MegaBytes = Report.Bytes / 1e6;
+    std::cout << "Compression benchmark:\n";
+    std::cout
+        << "  Triangles:" << "\t\t"
+        << Report.TriangleCount << std::endl;
+    std::cout
+        << "  File Size (bytes):" << "\t"
+        << Report.Bytes << std::endl;
+    std::cout
+        << "  Bytes per Triangle:" << "\t"
+        << Report.BytesPerTriangle << std::endl;
+    std::cout
+        << "  Encode:" << "\t\t"
+        << Report.EncodeSeconds << " s, "
+        << Report.TriangleCount / Report.EncodeSeconds << " tri/s, "
+        << MegaBytes / Report.EncodeSeconds << " MB/s" << std::endl;
+    std::cout
+        << "  Decode:" << "\t\t"
+        << Report.DecodeSeconds << " s, "
+        << Report.TriangleCount / Report.DecodeSeconds << " tri/s, "
+        << MegaBytes / Report.DecodeSeconds << " MB/s" << std::endl;
+    std::cout
+        << "  Welded Round Trip:" << "\t"
+        << (Report.IsWeldedRoundTripValid ? "ok" : "FAILED") << std::endl;
+}
+
+/*******************************************************************************
+【函数名称】 ShowLazyResult
+【函数功能】 显示惰性模式操作的错误信息
+【参数】 
+    - Controller::Result Result（输入参数）：操作结果
+    - std::size_t ID（输入参数）：面的ID
+【返回值】 bool：操作是否成功
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+bool ConsoleView::ShowLazyResult(Controller::Result Result,
+    std::size_t ID) const {
+    if (Result == Controller::Result::R_ID_OUT_OF_BOUNDS) {
+        std::cout << "error: #" << ID << " is not a valid face ID." << std::endl;
+        return false;
+    }
+    else if (Result == Controller::Result::R_FILE_FORMAT_ERROR) {
+        std::cout << "error: The lazy file has invalid format." << std::endl;
+        return false;
+    }
+    else if (Result == Controller::Result::R_IDENTICAL_POINTS) {
+        std::cout << "error: Face #" << ID << " is invalid." << std::endl;
+        return false;
+    }
+    return true;
+}
+
+/*******************************************************************************
+【函数名称】 OpenModelLazy
+【函数功能】 以惰性模式打开.obj文件，显示元素数目与分组信息
+【参数】 
+    - Controller& Controller（输入参数）：Controller对象，控制器
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+void ConsoleView::OpenModelLazy(Controller& Controller) const {
+    std::cout << "Open .obj file lazily: ";
+    std::string FileName;
+    std::cin >> FileName;
+    auto Result = Controller.OpenModelLazy(FileName);
+    if (Result != Controller::Result::R_OK) {
+        ShowLoadResult(Result, FileName);
+        return;
+    }
+    const LazyObjFile* File = Controller.GetLazyModel();
+    std::cout
+        << (File->IsIndexReused() ? "Reused" : "Built")
+        << " index of '" << FileName << "'." << std::endl;
+    std::cout
+        << "  Points: " << File->GetPointCount()
+        << ", Lines: " << File->GetLineCount()
+        << ", Faces: " << File->GetFaceCount() << std::endl;
+    for (std::size_t i = 0; i < File->Groups.size(); i++) {
+        const auto& Group = File->Groups[i];
+        std::size_t LastFace = i + 1 < File->Groups.size()
+            ? File->Groups[i + 1].FirstFace : File->GetFaceCount();
+        std::cout
+            << "  Group '" << Group.Name << "': faces "
+            << Group.FirstFace + 1 << "~" << LastFace << std::endl;
+    }
+}
+
+/*******************************************************************************
+【函数名称】 ListLazyFaces
+【函数功能】 列出惰性模式文件中指定范围的面，只读取所需的页
+【参数】 
+    - Controller& Controller（输入参数）：Controller对象，控制器
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+void ConsoleView::ListLazyFaces(Controller& Controller) const {
+    if (Controller.GetLazyModel() == nullptr) {
+        std::cout << "No file is opened lazily." << std::endl;
+        return;
+    }
+    std::cout << "First face ID and count : ";
+    std::size_t FirstID = 0;
+    std::size_t Count = 0;
+    std::cin >> FirstID >> Count;
+    std::vector<std::shared_ptr<Face3D>> Faces;
+    auto Result = Controller.GetLazyFaces(FirstID, Count, &Faces);
+    if (!ShowLazyResult(Result, FirstID)) {
+        return;
+    }
+    for (std::size_t i = 0; i < Faces.size(); i++) {
+        std::cout << "Face " << FirstID + i << ": ";
+        std::cout << *Faces[i] << std::endl;
+        std::cout << "    Area: " << Faces[i]->GetArea() << std::endl;
+    }
+    std::cout
+        << "(" << Controller.GetLazyModel()->GetPagesRead()
+        << " pages read from file so far)" << std::endl;
+}
+
+/*******************************************************************************
+【函数名称】 ListLazyFace_sPoints
+【函数功能】 列出惰性模式文件中指定面的点
+【参数】 
+    - Controller& Controller（输入参数）：Controller对象，控制器
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+void ConsoleView::ListLazyFace_sPoints(Controller& Controller) const {
+    if (Controller.GetLazyModel() == nullptr) {
+        std::cout << "No file is opened lazily." << std::endl;
+        return;
+    }
+    std::cout << "Face ID : ";
+    std::size_t ID = 0;
+    std::cin >> ID;
+    std::vector<std::shared_ptr<Point3D>> Points;
+    auto Result = Controller.GetLazyFacePointsById(ID, &Points);
+    if (!ShowLazyResult(Result, ID)) {
+        return;
+    }
+    std::cout << "Points in face #" << ID << ":" << std::endl;
+    for (int i = 0; i < 3; i++) {
+        std::cout << "  #" << i << Points[i]->ToString() << std::endl;
+    }
+}
+
+/*******************************************************************************
+【函数名称】 WeldPoints
+【函数功能】 合并当前模型中相距在容差以内的点，显示合并前后的点数与节省的内存
+【参数】 
+    - Controller& Controller（输入参数）：Controller对象，控制器
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+void ConsoleView::WeldPoints(Controller& Controller) const {
+    WeldReport Report;
+    Controller.WeldPoints(&Report);
+    std::cout << "Weld points:\n";
+    std::cout
+        << "  Points Before:" << "\t\t"
+        << Report.PointsBefore << std::endl;
+    std::cout
+        << "  Points After:" << "\t\t"
+        << Report.PointsAfter << std::endl;
+    std::cout
+        << "  Memory Saved (bytes):" << "\t"
+        << Report.BytesSaved << std::endl;
+    if (Report.DegenerateElements > 0) {
+        std::cout
+            << "warning: " << Report.DegenerateElements
+            << " degenerate element(s) were removed." << std::endl;
+    }
+}
+
+/*******************************************************************************
+【函数名称】 SetWelding
+【函数功能】 设置加载与保存模型时是否自动焊接重合的点
+【参数】 
+    - Controller& Controller（输入参数）：Controller对象，控制器
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+void ConsoleView::SetWelding(Controller& Controller) const {
+    std::string Answer;
+    std::cout
+        << "Weld points after loading? (y/n, now "
+        << (Controller.IsWeldingOnImport() ? "y" : "n") << "): ";
+    std::cin >> Answer;
+    Controller.SetWeldOnImport(Answer == "y" || Answer == "Y");
+    std::cout
+        << "Weld points when saving? (y/n, now "
+        << (Controller.IsWeldingOnExport() ? "y" : "n") << "): ";
+    std::cin >> Answer;
+    Controller.SetWeldOnExport(Answer == "y" || Answer == "Y");
+    std::cout
+        << "Welding on load: "
+        << (Controller.IsWeldingOnImport() ? "on" : "off")
+        << ", on save: "
+        << (Controller.IsWeldingOnExport() ? "on" : "off") << std::endl;
+}
+
+/*******************************************************************************
+【函数名称】 Checkpoint
+【函数功能】 把当前模型完整写回模型文件，清空编辑日志
+【参数】 
+    - Controller& Controller（输入参数）：Controller对象，控制器
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 批量修改之后显示写回了未保存的修改
+*******************************************************************************/
+void ConsoleView::Checkpoint(Controller& Controller) const {
+    std::size_t Pending = Controller.GetJournalLength();
+    bool HadUnsavedChanges = Controller.HasUnsavedChanges();
+    auto Result = Controller.Checkpoint();
+    if (Result != Controller::Result::R_OK) {
+        std::cout << "error: Cannot write the model file." << std::endl;
+        return;
+    }
+    if (HadUnsavedChanges) {
+        std::cout
+            << "Checkpoint done, unsaved changes written to the model file."
+            << std::endl;
+        return;
+    }
+    std::cout
+        << "Checkpoint done, " << Pending
+        << " journaled edit(s) folded into the model file." << std::endl;
+}
+
+/*******************************************************************************
+【函数名称】 ConfirmExit
+【函数功能】 批量修改之后的修改既不在模型文件中也不在编辑日志中，退出会丢失它们；
+此时提醒用户并请其确认
+【参数】 
+    - const Controller& Controller（输入参数）：Controller对象，控制器
+【返回值】 bool：是否退出，输入结束时也退出
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+bool ConsoleView::ConfirmExit(const Controller& Controller) const {
+    if (!Controller.HasUnsavedChanges()) {
+        return true;
+    }
+    std::cout
+        << "warning: The model has unsaved changes, "
+        << "use '1' to save or '24' to write the model file." << std::endl
+        << "Exit anyway? (y/n): ";
+    std::string Answer;
+    if (!(std::cin >> Answer)) {
+        return true;
+    }
+    return Answer == "y" || Answer == "Y";
+}
+
+/*******************************************************************************
+【函数名称】 ConfirmReplace
+【函数功能】 有未保存的修改时请用户确认是否以后台加载的模型替换当前模型
+【参数】
+    - const std::string& Path（输入参数）：字符串，后台加载的文件路径
+【返回值】 bool：是否替换，输入结束时不替换
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+bool ConsoleView::ConfirmReplace(const std::string& Path) const {
+    std::cout
+        << "warning: The model has unsaved changes, "
+        << "use '1' to save or '24' to write the model file." << std::endl
+        << "Replace it with '" << Path << "' anyway? (y/n): ";
+    std::string Answer;
+    if (!(std::cin >> Answer)) {
+        return false;
+    }
+    return Answer == "y" || Answer == "Y";
+}
+
+/*******************************************************************************
+【函数名称】 SimplifyModel
+【函数功能】 读入目标面数与误差上限，简化模型并显示结果
+【参数】 
+    - Controller& Controller（输入参数）：Controller对象，控制器
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+void ConsoleView::SimplifyModel(Controller& Controller) const {
+    std::size_t TargetFaceCount;
+    double MaxError;
+    std::cout << "Target face count: ";
+    std::cin >> TargetFaceCount;
+    std::cout << "Max error (0 for unlimited): ";
+    std::cin >> MaxError;
+    if (std::cin.fail()) {
+        std::cin.clear();
+        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+        std::cout << "error: Invalid input." << std::endl;
+        return;
+    }
+    if (MaxError <= 0) {
+        MaxError = std::numeric_limits<double>::infinity();
+    }
+    SimplifyReport Report;
+    Controller.SimplifyModel(TargetFaceCount, MaxError, &Report);
+    std::cout << "Simplify model:\n";
+    std::cout
+        << "  Faces:" << "\t\t"
+        << Report.FacesBefore << " -> " << Report.FacesAfter << std::endl;
+    std::cout
+        << "  Points:" << "\t\t"
+        << Report.PointsBefore << " -> " << Report.PointsAfter << std::endl;
+    std::cout
+        << "  Collapses:" << "\t\t"
+        << Report.Collapses << std::endl;
+    std::cout
+        << "  Max Error:" << "\t\t"
+        << Report.MaxError << std::endl;
+}
+
+/*******************************************************************************
+【函数名称】 OptimizeVertexCache
+【函数功能】 显示按顶点缓存优化的顺序导出时重排前后的ACMR，并设置保存到其他文件时
+是否采用该顺序
+【参数】 
+    - Controller& Controller（输入参数）：Controller对象，控制器
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 不再重排当前模型，改为设置导出时是否优化
+*******************************************************************************/
+void ConsoleView::OptimizeVertexCache(Controller& Controller) const {
+    CacheReport Report;
+    Controller.OptimizeVertexCache(&Report);
+    std::cout << "Optimize vertex cache:\n";
+    std::cout
+        << "  Faces:" << "\t\t"
+        << Report.FaceCount << std::endl;
+    std::cout
+        << "  ACMR Before:" << "\t\t"
+        << Report.AcmrBefore << std::endl;
+    std::cout
+        << "  ACMR After:" << "\t\t"
+        << Report.AcmrAfter << std::endl;
+    std::string Answer;
+    std::cout
+        << "Use this face order when saving to other files? (y/n, now "
+        << (Controller.IsOptimizingOnExport() ? "y" : "n") << "): ";
+    std::cin >> Answer;
+    Controller.SetOptimizeOnExport(Answer == "y" || Answer == "Y");
+    std::cout
+        << "Vertex cache ordering on export: "
+        << (Controller.IsOptimizingOnExport() ? "on" : "off") << std::endl;
+}
+
+/*******************************************************************************
+【函数名称】 ReorderSpatially
+【函数功能】 按Morton码重排模型的存储，显示重排前后遍历模型的耗时及是否保留
+重排后的顺序
+【参数】 
+    - Controller& Controller（输入参数）：Controller对象，控制器
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 
+    2026/10/18
+    - 显示是否保留重排后的顺序
+*******************************************************************************/
+void ConsoleView::ReorderSpatially(Controller& Controller) const {
+    Controller::LocalityReport Report;
+    Controller.ReorderSpatially(&Report);
+    std::cout << "Spatial reorder:\n";
+    std::cout
+        << "  Lines / Faces:" << "\t\t"
+        << Report.LineCount << " / " << Report.FaceCount << std::endl;
+    std::cout
+        << "  Statistics (ms):" << "\t"
+        << Report.StatisticsSecondsBefore * 1000 << " -> "
+        << Report.StatisticsSecondsAfter * 1000 << std::endl;
+    std::cout
+        << "  Indexing (ms):" << "\t\t"
+        << Report.IndexingSecondsBefore * 1000 << " -> "
+        << Report.IndexingSecondsAfter * 1000 << std::endl;
+    std::cout
+        << "  Layout:" << "\t\t"
+        << (Report.IsKept ? "reordered" : "restored (no speedup)")
+        << std::endl;
+}
+
+/*******************************************************************************
+【函数名称】 ListComponents
+【函数功能】 显示模型各个连通部分的线数、面数、面积与包围盒
+【参数】 
+    - const Controller& Controller（输入参数）：Controller对象，控制器
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+void ConsoleView::ListComponents(const Controller& Controller) const {
+    std::vector<ComponentInfo> Components;
+    Controller.LabelComponents(&Components);
+    std::cout << "Components: " << Components.size() << std::endl;
+    for (std::size_t i = 0; i < Components.size(); i++) {
+        const ComponentInfo& Info = Components[i];
+        std::cout
+            << "Component " << i + 1 << ": "
+            << Info.LineCount << " line(s), "
+            << Info.FaceCount << " face(s)" << std::endl;
+        std::cout << "    Area: " << Info.Area << std::endl;
+        std::cout
+            << "    Box: [ " << Info.Min[0] << " " << Info.Min[1] << " "
+            << Info.Min[2] << " ] - [ " << Info.Max[0] << " " << Info.Max[1]
+            << " " << Info.Max[2] << " ]" << std::endl;
+    }
+}
+
+/*******************************************************************************
+【函数名称】 ExportComponents
+【函数功能】 读入文件路径模板，把每个连通部分分别保存
+【参数】 
+    - const Controller& Controller（输入参数）：Controller对象，控制器
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+void ConsoleView::ExportComponents(const Controller& Controller) const {
+    std::cout << "Save components as (e.g. part.obj -> part_1.obj, ...): ";
+    std::string FileName;
+    std::cin >> FileName;
+    std::size_t Count;
+    auto Result = Controller.ExportComponents(FileName, &Count);
+    if (Result != Controller::Result::R_OK) {
+        ShowSaveResult(Result, FileName);
+        return;
+    }
+    std::cout << "Saved " << Count << " component(s)." << std::endl;
+}
+
+/*******************************************************************************
+【函数名称】 ExportConvexHull
+【函数功能】 求模型或其一个连通部分的凸包并保存，显示凸包的信息
+【参数】 
+    - const Controller& Controller（输入参数）：Controller对象，控制器
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+void ConsoleView::ExportConvexHull(const Controller& Controller) const {
+    std::cout << "Save convex hull as: ";
+    std::string FileName;
+    std::cin >> FileName;
+    std::cout << "Component (0 for the whole model): ";
+    std::size_t Component = 0;
+    std::cin >> Component;
+    Controller::HullReport Report;
+    auto Result = Controller.ExportConvexHull(FileName, Component, &Report);
+    if (Result == Controller::Result::R_ID_OUT_OF_BOUNDS) {
+        std::cout << "error: #" << Component
+            << " is not a valid component." << std::endl;
+        return;
+    }
+    std::cout << "Convex hull:\n";
+    std::cout
+        << "  Input Points:" << "\t\t"
+        << Report.PointCount << std::endl;
+    std::cout
+        << "  Hull Points:" << "\t\t"
+        << Report.HullPointCount << std::endl;
+    std::cout
+        << "  Hull Faces:" << "\t\t"
+        << Report.HullFaceCount << std::endl;
+    std::cout
+        << "  Area:" << "\t\t\t"
+        << Report.Area << std::endl;
+    std::cout
+        << "  Volume:" << "\t\t"
+        << Report.Volume << std::endl;
+    std::cout
+        << "  Time:" << "\t\t\t"
+        << Report.Seconds << " s" << std::endl;
+    ShowSaveResult(Result, FileName);
+}
+
+/*******************************************************************************
+【函数名称】 BenchmarkConvexHull
+【函数功能】 在随机点云上测评单线程与多线程求凸包的耗时
+【参数】 
+    - const Controller& Controller（输入参数）：Controller对象，控制器
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+void ConsoleView::BenchmarkConvexHull(const Controller& Controller) const {
+    std::cout << "Number of points (e.g. 10000000): ";
+    std::size_t PointCount = 0;
+    std::cin >> PointCount;
+    std::vector<Controller::HullBenchmark> Results;
+    Controller.BenchmarkConvexHull(PointCount, &Results);
+    std::cout << "Convex hull benchmark:\n";
+    for (const auto& Entry: Results) {
+        std::cout
+            << "  " << Entry.Cloud << ":\t"
+            << Entry.PointCount << " points, "
+            << Entry.HullPointCount << " on hull, serial "
+            << Entry.SerialSeconds << " s, "
+            << Entry.WorkerCount << " thread(s) "
+            << Entry.ParallelSeconds << " s, speedup "
+            << Entry.SerialSeconds / Entry.ParallelSeconds << std::endl;
+    }
+}
+
+/*******************************************************************************
+【函数名称】 ExportDistanceField
+【函数功能】 求模型的有向距离场并保存，显示网格尺寸、内存与耗时
+【参数】 
+    - const Controller& Controller（输入参数）：Controller对象，控制器
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+void ConsoleView::ExportDistanceField(const Controller& Controller) const {
+    std::cout << "Save distance field as (.raw, header goes to .nhdr): ";
+    std::string FileName;
+    std::cin >> FileName;
+    std::cout << "Resolution along the longest axis (e.g. 512): ";
+    std::size_t Resolution = 0;
+    std::cin >> Resolution;
+    std::cout << "Band width in voxels (e.g. 3): ";
+    double BandVoxels = 0;
+    std::cin >> BandVoxels;
+    Controller::FieldReport Report;
+    auto Result = Controller.ExportDistanceField(FileName, Resolution,
+        BandVoxels, &Report);
+    if (Report.Size[0] == 0) {
+        std::cout << "error: The model has no faces." << std::endl;
+        return;
+    }
+    std::cout << "Signed distance field:\n";
+    std::cout
+        << "  Grid:" << "\t\t\t"
+        << Report.Size[0] << " x " << Report.Size[1] << " x "
+        << Report.Size[2] << std::endl;
+    std::cout
+        << "  Spacing:" << "\t\t"
+        << Report.Spacing << std::endl;
+    std::cout
+        << "  Band Width:" << "\t\t"
+        << Report.BandWidth << std::endl;
+    std::cout
+        << "  Stored Bricks:" << "\t"
+        << Report.StoredBrickCount << " / " << Report.BrickCount << std::endl;
+    std::cout
+        << "  Memory (bytes):" << "\t"
+        << Report.MemoryBytes << std::endl;
+    std::cout
+        << "  Time:" << "\t\t\t"
+        << Report.Seconds << " s" << std::endl;
+    ShowSaveResult(Result, FileName);
+}
+
+/*******************************************************************************
+【函数名称】 FindSelfIntersections
+【函数功能】 检测模型的自相交，显示穿插的面对数与前若干对的面ID
+【参数】 
+    - const Controller& Controller（输入参数）：Controller对象，控制器
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+void ConsoleView::FindSelfIntersections(const Controller& Controller) const {
+    std::vector<std::pair<std::size_t, std::size_t>> Pairs;
+    Controller.FindSelfIntersections(&Pairs);
+    if (Pairs.empty()) {
+        std::cout << "No self-intersections found." << std::endl;
+        return;
+    }
+    std::cout << Pairs.size() << " intersecting face pair(s):" << std::endl;
+    const std::size_t MaxShown = 20;
+    for (std::size_t i = 0; i < Pairs.size() && i < MaxShown; i++) {
+        std::cout
+            << "  Face #" << Pairs[i].first + 1
+            << " x Face #" << Pairs[i].second + 1 << std::endl;
+    }
+    if (Pairs.size() > MaxShown) {
+        std::cout << "  ..." << std::endl;
+    }
+}
+
+/*******************************************************************************
+【函数名称】 FindIntersectionsWith
+【函数功能】 读入另一个模型，检测它与当前模型之间的相交，显示相交的面对数与前
+若干对的面ID
+【参数】 
+    - const Controller& Controller（输入参数）：Controller对象，控制器
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+void ConsoleView::FindIntersectionsWith(const Controller& Controller) const {
+    std::cout << "Other model file: ";
+    std::string FileName;
+    std::cin >> FileName;
+    std::vector<std::pair<std::size_t, std::size_t>> Pairs;
+    auto Result = Controller.FindIntersectionsWith(FileName, &Pairs);
+    if (Result != Controller::Result::R_OK) {
+        ShowLoadResult(Result, FileName);
+        return;
+    }
+    if (Pairs.empty()) {
+        std::cout << "The models do not intersect." << std::endl;
+        return;
+    }
+    std::cout << Pairs.size() << " intersecting face pair(s):" << std::endl;
+    const std::size_t MaxShown = 20;
+    for (std::size_t i = 0; i < Pairs.size() && i < MaxShown; i++) {
+        std::cout
+            << "  Face #" << Pairs[i].first + 1
+            << " x Other Face #" << Pairs[i].second + 1 << std::endl;
+    }
+    if (Pairs.size() > MaxShown) {
+        std::cout << "  ..." << std::endl;
+    }
+}
+
+/*******************************************************************************
+【函数名称】 ClassifyPoints
+【函数功能】 从文件读入查询点，判断它们是否在模型内部，显示在内部的点数与前若干个
+点的结果
+【参数】 
+    - const Controller& Controller（输入参数）：Controller对象，控制器
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+void ConsoleView::ClassifyPoints(const Controller& Controller) const {
+    std::cout << "Point file: ";
+    std::string FileName;
+    std::cin >> FileName;
+    std::vector<double> Coordinates;
+    std::vector<std::uint64_t> Mask;
+    auto Result = Controller.ClassifyPointsFrom(FileName, &Coordinates, &Mask);
+    if (Result != Controller::Result::R_OK) {
+        ShowLoadResult(Result, FileName);
+        return;
+    }
+    const std::size_t Count = Coordinates.size() / 3;
+    std::size_t InsideCount = 0;
+    for (std::uint64_t Word: Mask) {
+        for (; Word != 0; Word &= Word - 1) {
+            InsideCount++;
+        }
+    }
+    std::cout
+        << InsideCount << " of " << Count
+        << " point(s) inside the model." << std::endl;
+    const std::size_t MaxShown = 20;
+    for (std::size_t i = 0; i < Count && i < MaxShown; i++) {
+        std::cout
+            << "  Point #" << i + 1 << " ("
+            << Coordinates[3 * i] << ", " << Coordinates[3 * i + 1] << ", "
+            << Coordinates[3 * i + 2] << "): "
+            << (ContainmentTester::IsInside(Mask, i) ? "inside" : "outside")
+            << std::endl;
+    }
+    if (Count > MaxShown) {
+        std::cout << "  ..." << std::endl;
+    }
+}
+
+/*******************************************************************************
+【函数名称】 FindLineFaceHits
+【函数功能】 检测模型中各条线穿过的面，显示交点数与前若干个交点的线ID、面ID、
+参数和坐标
+【参数】 
+    - const Controller& Controller（输入参数）：Controller对象，控制器
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+void ConsoleView::FindLineFaceHits(const Controller& Controller) const {
+    std::vector<IntersectionFinder::LineHit> Hits;
+    Controller.FindLineFaceHits(&Hits);
+    if (Hits.empty()) {
+        std::cout << "No line passes through a face." << std::endl;
+        return;
+    }
+    std::cout << Hits.size() << " line-face hit(s):" << std::endl;
+    const auto& Lines = Controller.GetLines();
+    const std::size_t MaxShown = 20;
+    for (std::size_t i = 0; i < Hits.size() && i < MaxShown; i++) {
+        const auto& Line = Lines[Hits[i].Line];
+        const double Parameter = Hits[i].Parameter;
+        std::cout
+            << "  Line #" << Hits[i].Line + 1
+            << " x Face #" << Hits[i].Face + 1
+            << " at t = " << Parameter << " (";
+        for (std::size_t Axis = 0; Axis < 3; Axis++) {
+            double Start = Line->First->GetCoordinate(Axis);
+            double End = Line->Second->GetCoordinate(Axis);
+            std::cout
+                << Start + Parameter * (End - Start)
+                << (Axis < 2 ? ", " : ")");
+        }
+        std::cout << std::endl;
+    }
+    if (Hits.size() > MaxShown) {
+        std::cout << "  ..." << std::endl;
+    }
+}
+
+/*******************************************************************************
+【函数名称】 SubdivideModel
+【函数功能】 读入细分级数，用Loop细分规则细分模型并显示结果
+【参数】 
+    - Controller& Controller（输入参数）：Controller对象，控制器
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+void ConsoleView::SubdivideModel(Controller& Controller) const {
+    std::size_t Levels;
+    std::cout << "Levels (each one quadruples the faces): ";
+    std::cin >> Levels;
+    if (std::cin.fail()) {
+        std::cin.clear();
+        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+        std::cout << "error: Invalid input." << std::endl;
+        return;
+    }
+    SubdivisionReport Report;
+    Controller.SubdivideModel(Levels, &Report);
+    std::cout << "Loop subdivision:\n";
+    std::cout
+        << "  Levels:" << "\t\t"
+        << Report.Levels << std::endl;
+    std::cout
+        << "  Faces:" << "\t\t"
+        << Report.FacesBefore << " -> " << Report.FacesAfter << std::endl;
+    std::cout
+        << "  Points:" << "\t\t"
+        << Report.PointsBefore << " -> " << Report.PointsAfter << std::endl;
+    std::cout
+        << "  Boundary Edges:" << "\t"
+        << Report.BoundaryEdges << std::endl;
+    std::cout
+        << "  Time:" << "\t\t\t"
+        << Report.Seconds << " s" << std::endl;
+}
+
+/*******************************************************************************
+【函数名称】 SmoothModel
+【函数功能】 读入迭代次数，用Taubin方法光顺模型并显示结果
+【参数】 
+    - Controller& Controller（输入参数）：Controller对象，控制器
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+void ConsoleView::SmoothModel(Controller& Controller) const {
+    std::size_t Iterations;
+    std::cout << "Iterations: ";
+    std::cin >> Iterations;
+    if (std::cin.fail()) {
+        std::cin.clear();
+        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+        std::cout << "error: Invalid input." << std::endl;
+        return;
+    }
+    SmoothingReport Report;
+    Controller.SmoothModel(Iterations, &Report);
+    std::cout << "Taubin smoothing:\n";
+    std::cout
+        << "  Iterations:" << "\t\t"
+        << Report.Iterations << std::endl;
+    std::cout
+        << "  Points:" << "\t\t"
+        << Report.PointCount << std::endl;
+    std::cout
+        << "  Pinned Points:" << "\t"
+        << Report.PinnedPoints << std::endl;
+    std::cout
+        << "  Max Displacement:" << "\t"
+        << Report.MaxDisplacement << std::endl;
+    std::cout
+        << "  Time:" << "\t\t\t"
+        << Report.Seconds << " s" << std::endl;
+}
+
+/*******************************************************************************
+【函数名称】 AnalyzeQuality
+【函数功能】 读入阈值，分析面的质量，显示统计、内角与长宽比的直方图以及前若干个
+被标记的面ID
+【参数】 
+    - const Controller& Controller（输入参数）：Controller对象，控制器
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+void ConsoleView::AnalyzeQuality(const Controller& Controller) const {
+    QualityThresholds Thresholds;
+    std::cout << "Max aspect ratio, min angle and max angle in degrees "
+        << "(e.g. 10 5 170): ";
+    std::cin >> Thresholds.MaxAspectRatio >> Thresholds.MinAngle
+        >> Thresholds.MaxAngle;
+    if (std::cin.fail()) {
+        std::cin.clear();
+        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+        std::cout << "error: Invalid input." << std::endl;
+        return;
+    }
+    QualityReport Report;
+    Controller.AnalyzeQuality(Thresholds, &Report);
+    std::cout << "Face quality:\n";
+    std::cout
+        << "  Faces:" << "\t\t"
+        << Report.FaceCount << std::endl;
+    std::cout
+        << "  Degenerate Faces:" << "\t"
+        << Report.DegenerateFaces << std::endl;
+    std::cout
+        << "  Poor Faces:" << "\t\t"
+        << Report.PoorFaces << std::endl;
+    std::cout
+        << "  Angle Range:" << "\t\t"
+        << Report.MinAngle << " ~ " << Report.MaxAngle << " deg" << std::endl;
+    std::cout
+        << "  Aspect Ratio:" << "\t\t"
+        << "mean " << Report.MeanAspectRatio
+        << ", max " << Report.MaxAspectRatio << std::endl;
+    std::cout
+        << "  Min Shape Quality:" << "\t"
+        << Report.MinShapeQuality << std::endl;
+    std::cout
+        << "  Time:" << "\t\t\t"
+        << Report.Seconds << " s" << std::endl;
+
+    const std::size_t BarWidth = 40;
+    auto Bar = [&](std::size_t Count, const std::vector<std::size_t>& Counts) {
+        std::size_t Largest = std::max<std::size_t>(1,
+            *std::max_element(Counts.begin(), Counts.end()));
+        return std::string(Count * BarWidth / Largest, '#');
+    };//最多的一格画满BarWidth个字符
+    std::cout << "Angle histogram (deg):" << std::endl;
+    for (std::size_t b = 0; b < Report.AngleHistogram.size(); b++) {
+        std::cout
+            << "  [" << b * 10 << ", " << b * 10 + 10 << ")\t"
+            << Report.AngleHistogram[b] << "\t"
+            << Bar(Report.AngleHistogram[b], Report.AngleHistogram)
+            << std::endl;
+    }
+    std::cout << "Aspect ratio histogram:" << std::endl;
+    for (std::size_t b = 0; b < Report.AspectHistogram.size(); b++) {
+        std::cout << "  ";
+        if (b + 1 < Report.AspectBounds.size()) {
+            std::cout << "<= " << Report.AspectBounds[b];
+        } else {
+            std::cout << "> " << Report.AspectBounds[b - 1];
+        }
+        std::cout
+            << "\t\t" << Report.AspectHistogram[b] << "\t"
+            << Bar(Report.AspectHistogram[b], Report.AspectHistogram)
+            << std::endl;
+    }
+
+    const std::size_t MaxShown = 20;
+    for (std::size_t i = 0; i < Report.FlaggedFaces.size() && i < MaxShown;
+        i++) {
+        std::cout
+            << "  Flagged Face #" << Report.FlaggedFaces[i] + 1 << std::endl;
+    }
+    if (Report.FlaggedFaces.size() > MaxShown) {
+        std::cout << "  ..." << std::endl;
+    }
+}
+
+/*******************************************************************************
+【函数名称】 ShowTransformResult
+【函数功能】 显示仿射变换的结果
+【参数】 
+    - Controller::Result Result（输入参数）：操作结果
+    - const TransformReport& Report（输入参数）：变换结果
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+void ConsoleView::ShowTransformResult(Controller::Result Result,
+    const TransformReport& Report) const {
+    if (Result == Controller::Result::R_SINGULAR_TRANSFORM) {
+        std::cout
+            << "error: The transform is not invertible and would collapse "
+            << "the model." << std::endl;
+        return;
+    }
+    std::cout << "Affine transform:\n";
+    std::cout
+        << "  Points:" << "\t\t"
+        << Report.PointCount << std::endl;
+    std::cout
+        << "  Volume Scale:" << "\t\t"
+        << Report.Determinant << std::endl;
+    std::cout
+        << "  Time:" << "\t\t\t"
+        << Report.Seconds << " s" << std::endl;
+}
+
+/*******************************************************************************
+【函数名称】 TranslateModel
+【函数功能】 读入平移量并平移模型
+【参数】 
+    - Controller& Controller（输入参数）：Controller对象，控制器
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+void ConsoleView::TranslateModel(Controller& Controller) const {
+    double X;
+    double Y;
+    double Z;
+    std::cout << "Offset (x y z): ";
+    std::cin >> X >> Y >> Z;
+    if (std::cin.fail()) {
+        std::cin.clear();
+        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+        std::cout << "error: Invalid input." << std::endl;
+        return;
+    }
+    TransformReport Report;
+    auto Result = Controller.TranslateModel(X, Y, Z, &Report);
+    ShowTransformResult(Result, Report);
+}
+
+/*******************************************************************************
+【函数名称】 RotateModel
+【函数功能】 读入旋转轴与角度并旋转模型
+【参数】 
+    - Controller& Controller（输入参数）：Controller对象，控制器
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+void ConsoleView::RotateModel(Controller& Controller) const {
+    std::string Axis;
+    double Degrees;
+    std::cout << "Axis (x, y or z) and counterclockwise degrees: ";
+    std::cin >> Axis >> Degrees;
+    if (std::cin.fail() || (Axis != "x" && Axis != "y" && Axis != "z")) {
+        std::cin.clear();
+        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+        std::cout << "error: Invalid input." << std::endl;
+        return;
+    }
+    TransformReport Report;
+    auto Result = Controller.RotateModel(
+        static_cast<std::size_t>(Axis[0] - 'x'), Degrees, &Report);
+    ShowTransformResult(Result, Report);
+}
+
+/*******************************************************************************
+【函数名称】 ScaleModel
+【函数功能】 读入各轴的倍数并缩放模型
+【参数】 
+    - Controller& Controller（输入参数）：Controller对象，控制器
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+void ConsoleView::ScaleModel(Controller& Controller) const {
+    double X;
+    double Y;
+    double Z;
+    std::cout << "Factors (x y z, negative to mirror): ";
+    std::cin >> X >> Y >> Z;
+    if (std::cin.fail()) {
+        std::cin.clear();
+        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+        std::cout << "error: Invalid input." << std::endl;
+        return;
+    }
+    TransformReport Report;
+    auto Result = Controller.ScaleModel(X, Y, Z, &Report);
+    ShowTransformResult(Result, Report);
+}
+
+/*******************************************************************************
+【函数名称】 TransformModel
+【函数功能】 读入4×4仿射矩阵的前三行并变换模型
+【参数】 
+    - Controller& Controller（输入参数）：Controller对象，控制器
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+void ConsoleView::TransformModel(Controller& Controller) const {
+    std::array<double, 16> Matrix = { 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 1 };
+    std::cout << "First three rows of the 4x4 matrix (12 numbers): ";
+    for (std::size_t i = 0; i < 12; i++) {
+        std::cin >> Matrix[i];
+    }
+    if (std::cin.fail()) {
+        std::cin.clear();
+        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+        std::cout << "error: Invalid input." << std::endl;
+        return;
+    }
+    TransformReport Report;
+    auto Result = Controller.TransformModel(Matrix, &Report);
+    ShowTransformResult(Result, Report);
+}
+/*******************************************************************************
+【函数名称】 FindGeodesicPath
+【函数功能】 读入起点与终点位置，沿网格的边求最短路径并作为线加入模型
+【参数】 
+    - Controller& Controller（输入参数）：Controller对象，控制器
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+void ConsoleView::FindGeodesicPath(Controller& Controller) const {
+    double From[3];
+    double To[3];
+    std::cout << "Start (x y z): ";
+    std::cin >> From[0] >> From[1] >> From[2];
+    std::cout << "End (x y z): ";
+    std::cin >> To[0] >> To[1] >> To[2];
+    if (std::cin.fail()) {
+        std::cin.clear();
+        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+        std::cout << "error: Invalid input." << std::endl;
+        return;
+    }
+    GeodesicPath Path;
+    std::size_t AddedLines;
+    auto Result = Controller.FindGeodesicPath(From, To, &Path, &AddedLines);
+    if (Result == Controller::Result::R_ID_OUT_OF_BOUNDS) {
+        std::cout << "error: The model has no points." << std::endl;
+        return;
+    }
+    if (Path.Vertices.empty()) {
+        std::cout << "The end is not reachable from the start along edges."
+            << std::endl;
+        return;
+    }
+    std::cout << "Geodesic path:\n";
+    std::cout
+        << "  Length:" << "\t\t"
+        << Path.Length << std::endl;
+    std::cout
+        << "  Edges:" << "\t\t"
+        << Path.Vertices.size() - 1 << std::endl;
+    std::cout
+        << "  Settled:" << "\t\t"
+        << Path.SettledVertices << std::endl;
+    std::cout
+        << "  Lines Added:" << "\t\t"
+        << AddedLines << std::endl;
+    std::cout
+        << "  Time:" << "\t\t\t"
+        << Path.Seconds << " s" << std::endl;
+}
+
+/*******************************************************************************
+【函数名称】 GeodesicDistances
+【函数功能】 读入源位置，沿网格的边求各顶点的距离并显示统计信息
+【参数】 
+    - const Controller& Controller（输入参数）：Controller对象，控制器
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+void ConsoleView::GeodesicDistances(const Controller& Controller) const {
+    double From[3];
+    std::cout << "Source (x y z): ";
+    std::cin >> From[0] >> From[1] >> From[2];
+    if (std::cin.fail()) {
+        std::cin.clear();
+        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+        std::cout << "error: Invalid input." << std::endl;
+        return;
+    }
+    std::vector<double> Positions;
+    std::vector<double> Distances;
+    auto Result = Controller.GeodesicDistances(From, &Positions, &Distances);
+    if (Result == Controller::Result::R_ID_OUT_OF_BOUNDS) {
+        std::cout << "error: The model has no points." << std::endl;
+        return;
+    }
+    std::size_t Reachable = 0;
+    std::size_t Farthest = 0;
+    double Sum = 0;
+    for (std::size_t v = 0; v < Distances.size(); v++) {
+        if (!std::isfinite(Distances[v])) {
+            continue;
+        }
+        Reachable++;
+        Sum += Distances[v];
+        if (Reachable == 1 || Distances[v] > Distances[Farthest]) {
+            Farthest = v;
+        }
+    }//源顶点总是可达，Reachable至少为1
+    std::cout << "Geodesic distance field:\n";
+    std::cout
+        << "  Vertices:" << "\t\t"
+        << Distances.size() << std::endl;
+    std::cout
+        << "  Reachable:" << "\t\t"
+        << Reachable << std::endl;
+    std::cout
+        << "  Mean Distance:" << "\t"
+        << Sum / Reachable << std::endl;
+    std::cout
+        << "  Max Distance:" << "\t\t"
+        << Distances[Farthest] << std::endl;
+    std::cout
+        << "  Farthest Point:" << "\t("
+        << Positions[3 * Farthest] << ", "
+        << Positions[3 * Farthest + 1] << ", "
+        << Positions[3 * Farthest + 2] << ")" << std::endl;
+}
+
+/*******************************************************************************
+【函数名称】 ShowShapeProperties
+【函数功能】 显示面所围的体积、质心与惯性张量，以及主成分包围盒与最小体积有向
+包围盒
+【参数】 
+    - const Controller& Controller（输入参数）：Controller对象，控制器
+【返回值】 无
+Created by 朱昊东 on 2026/10/18
+【更改记录】 无
+*******************************************************************************/
+void ConsoleView::ShowShapeProperties(const Controller& Controller) const {
+    Controller::ShapeProperties Properties;
+    Controller.GetShapeProperties(&Properties);
+    std::cout << "Shape properties:\n";
+    const auto& Mass = Properties.Mass;
+    std::cout
+        << "  Enclosed Volume:" << "\t"
+        << Mass.SignedVolume << std::endl;
+    auto ShowVector = [](const double* Values) {
+        std::cout << "(" << Values[0] << ", " << Values[1] << ", "
+            << Values[2] << ")" << std::endl;
+    };
+    std::cout << "  Surface Centroid:" << "\t";
+    ShowVector(Mass.SurfaceCentroid);
+    std::cout << "  Volume Centroid:" << "\t";
+    ShowVector(Mass.VolumeCentroid);
+    std::cout << "  Inertia Tensor:" << std::endl;
+    for (const auto& Row: Mass.Inertia) {
+        std::cout << "\t\t\t";
+        ShowVector(Row);
+    }
+    const auto& Boxes = Properties.OrientedBoxes;
+    std::cout
+        << "  PCA Box Volume:" << "\t"
+        << Boxes.Pca.Volume << std::endl;
+    std::cout
+        << "  Min Oriented Box:" << "\t"
+        << Boxes.Minimum.Volume << " (" << Boxes.CandidateCount
+        << " directions over " << Boxes.HullPointCount
+        << " hull points)" << std::endl;
+    std::cout << "  Box Center:" << "\t\t";
+    ShowVector(Boxes.Minimum.Center);
+    std::cout << "  Box Extents:" << "\t\t";
+    ShowVector(Boxes.Minimum.Extents);
+    std::cout << "  Box Axes:" << std::endl;
+    for (const auto& Axis: Boxes.Minimum.Axes) {
+        std::cout << "\t\t\t";
+        ShowVector(Axis);
+    }
+}
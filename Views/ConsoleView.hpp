@@ -2,7 +2,29 @@
 【文件名】ConsoleView.hpp
 【功能模块和目的】 控制台视图类，通过console实现controller与用户的交互
  Created by 朱昊东 on 2024/7/29
-【更改记录】 无
+【更改记录】 
+    2026/10/18
+    - 增添了压缩格式测评命令
+    - 增添了后台加载相关命令
+    - 增添了惰性模式相关命令
+    - 增添了焊接重合点的命令
+    - 保存改为在后台进行
+    - 增添了检查点命令，加载后显示重放的编辑数
+    - 增添了简化模型的命令
+    - 增添了顶点缓存优化的命令
+    - 增添了空间重排的命令
+    - 增添了连通部分的命令
+    - 增添了凸包的导出与测评命令
+    - 增添了导出有向距离场的命令
+    - 增添了自相交与模型间相交的检测命令
+    - 增添了批量判断点是否在模型内部的命令
+    - 增添了线与面的相交检测命令
+    - 增添了Loop细分的命令
+    - 增添了Taubin光顺的命令
+    - 增添了面质量分析的命令
+    - 增添了仿射变换的命令
+    - 增添了测地最短路径的命令
+    - 增添了形状属性的命令
 *******************************************************************************/
 #ifndef CONSOLE_VIEW_HPP
 #define CONSOLE_VIEW_HPP
@@ -18,9 +40,38 @@
     - void Run(Controller& Controller) const
         运行方法，实现controller与用户的交互
     - bool LoadModel(Controller& Controller, std::string* path) const
-        加载模型
-    - void SaveModel(const Controller& Controller, std::string defaultPath) const
-        保存模型
+        加载模型，加载期间显示进度
+    - bool ShowLoadResult(Controller::Result Result,
+        const std::string& Path) const
+        显示加载结果
+    - void ShowReplayedEdits(const Controller& Controller) const
+        显示从编辑日志重放的编辑数
+    - void PrintProgress(const Controller::LoadTask& Task) const
+        输出加载进度
+    - void CollectBackgroundLoad(Controller& Controller,
+        std::string* Path) const
+        收取已结束的后台加载并显示结果
+    - void LoadModelInBackground(Controller& Controller) const
+        在后台加载新模型
+    - void ShowLoadProgress(const Controller& Controller) const
+        显示后台加载进度
+    - void CancelLoad(Controller& Controller) const
+        取消后台加载
+    - bool ShowLazyResult(Controller::Result Result, std::size_t ID) const
+        显示惰性模式操作的错误信息
+    - void OpenModelLazy(Controller& Controller) const
+        以惰性模式打开.obj文件
+    - void ListLazyFaces(Controller& Controller) const
+        列出惰性模式文件中指定范围的面
+    - void ListLazyFace_sPoints(Controller& Controller) const
+        列出惰性模式文件中指定面的点
+    - void SaveModel(Controller& Controller, std::string defaultPath) const
+        在后台保存模型
+    - void ShowSaveResult(Controller::Result Result,
+        const std::string& Path) const
+        显示保存结果
+    - void CollectBackgroundSave(Controller& Controller, bool Wait) const
+        收取已结束的后台保存并显示结果
     - void ShowHelp() const
         显示帮助信息
     - void ShowStatistics(const Controller& Controller) const
@@ -45,8 +96,93 @@
         移除线
     - void ModifyLine(Controller& Controller) const
         修改线
+    - void BenchmarkCompression(const Controller& Controller) const
+        测评压缩模型格式
+    - void WeldPoints(Controller& Controller) const
+        焊接重合的点
+    - void SetWelding(Controller& Controller) const
+        设置加载与保存时是否焊接
+    - void Checkpoint(Controller& Controller) const
+        把编辑日志并入模型文件
+    - bool ConfirmExit(const Controller& Controller) const
+        有未保存的修改时请用户确认是否退出
+    - bool ConfirmReplace(const std::string& Path) const
+        有未保存的修改时请用户确认是否以后台加载的模型替换当前模型
+    - void SimplifyModel(Controller& Controller) const
+        用二次误差边折叠简化模型
+    - void OptimizeVertexCache(Controller& Controller) const
+        测量顶点缓存优化的效果，设置导出时是否优化面的顺序
+    - void ReorderSpatially(Controller& Controller) const
+        按Morton码重排模型的存储
+    - void ListComponents(const Controller& Controller) const
+        显示各个连通部分的统计信息
+    - void ExportComponents(const Controller& Controller) const
+        分别保存各个连通部分
+    - void ExportConvexHull(const Controller& Controller) const
+        求凸包并保存
+    - void BenchmarkConvexHull(const Controller& Controller) const
+        测评求凸包的耗时
+    - void ExportDistanceField(const Controller& Controller) const
+        求有向距离场并保存
+    - void FindSelfIntersections(const Controller& Controller) const
+        检测自相交
+    - void FindIntersectionsWith(const Controller& Controller) const
+        检测与另一个模型的相交
+    - void ClassifyPoints(const Controller& Controller) const
+        从文件读入点并判断是否在模型内部
+    - void FindLineFaceHits(const Controller& Controller) const
+        求各条线穿过的面
+    - void SubdivideModel(Controller& Controller) const
+        Loop细分模型
+    - void SmoothModel(Controller& Controller) const
+        Taubin光顺模型
+    - void AnalyzeQuality(const Controller& Controller) const
+        分析面的质量
+    - void TranslateModel(Controller& Controller) const
+        平移模型
+    - void RotateModel(Controller& Controller) const
+        绕坐标轴旋转模型
+    - void ScaleModel(Controller& Controller) const
+        沿坐标轴缩放模型
+    - void TransformModel(Controller& Controller) const
+        施加一般的仿射矩阵
+    - void ShowTransformResult(Controller::Result Result,
+        const TransformReport& Report) const
+        显示仿射变换的结果
+    - void FindGeodesicPath(Controller& Controller) const
+        求测地最短路径并加入模型
+    - void GeodesicDistances(const Controller& Controller) const
+        求测地距离场
+    - void ShowShapeProperties(const Controller& Controller) const
+        显示质量属性与有向包围盒
  Created by 朱昊东 on 2024/7/29
-【更改记录】 无
+【更改记录】 
+    2026/10/18
+    - 增添了BenchmarkCompression
+    - 增添了后台加载相关的方法
+    - 增添了惰性模式相关的方法
+    - 增添了WeldPoints、SetWelding
+    - SaveModel改为后台保存，增添了ShowSaveResult与CollectBackgroundSave
+    - 增添了Checkpoint
+    - 增添了SimplifyModel
+    - 增添了OptimizeVertexCache
+    - 增添了ReorderSpatially
+    - 增添了ListComponents、ExportComponents
+    - 增添了ExportConvexHull、BenchmarkConvexHull
+    - 增添了ExportDistanceField
+    - 增添了FindSelfIntersections、FindIntersectionsWith
+    - 增添了ClassifyPoints
+    - 增添了FindLineFaceHits
+    - 增添了SubdivideModel
+    - 增添了SmoothModel
+    - 增添了AnalyzeQuality
+    - 增添了TranslateModel、RotateModel、ScaleModel、TransformModel与
+    ShowTransformResult
+    - 增添了FindGeodesicPath与GeodesicDistances
+    - 增添了ConfirmExit
+    - OptimizeVertexCache改为设置导出时是否优化
+    - 增添了ShowShapeProperties
+    - 增添了ConfirmReplace
 *******************************************************************************/
 class ConsoleView: public AbstractView {
     public:
@@ -57,8 +193,37 @@ class ConsoleView: public AbstractView {
     private:
         //加载模型
         bool LoadModel(Controller& Controller, std::string* path) const;
+        //显示加载结果
+        bool ShowLoadResult(Controller::Result Result,
+            const std::string& Path) const;
+        //显示重放的编辑数
+        void ShowReplayedEdits(const Controller& Controller) const;
+        //输出加载进度
+        void PrintProgress(const Controller::LoadTask& Task) const;
+        //收取已结束的后台加载
+        void CollectBackgroundLoad(Controller& Controller,
+            std::string* Path) const;
+        //在后台加载新模型
+        void LoadModelInBackground(Controller& Controller) const;
+        //显示后台加载进度
+        void ShowLoadProgress(const Controller& Controller) const;
+        //取消后台加载
+        void CancelLoad(Controller& Controller) const;
+        //显示惰性模式操作的错误信息
+        bool ShowLazyResult(Controller::Result Result, std::size_t ID) const;
+        //以惰性模式打开.obj文件
+        void OpenModelLazy(Controller& Controller) const;
+        //列出惰性模式文件中指定范围的面
+        void ListLazyFaces(Controller& Controller) const;
+        //列出惰性模式文件中指定面的点
+        void ListLazyFace_sPoints(Controller& Controller) const;
         //保存模型
-        void SaveModel(const Controller& Controller, std::string defaultPath) const;
+        void SaveModel(Controller& Controller, std::string defaultPath) const;
+        //显示保存结果
+        void ShowSaveResult(Controller::Result Result,
+            const std::string& Path) const;
+        //收取已结束的后台保存
+        void CollectBackgroundSave(Controller& Controller, bool Wait) const;
         //显示帮助信息
         void ShowHelp() const;
         //显示统计信息
@@ -83,6 +248,65 @@ class ConsoleView: public AbstractView {
         void RemoveLine(Controller& Controller) const;
         //修改线
         void ModifyLine(Controller& Controller) const;
+        //测评压缩模型格式
+        void BenchmarkCompression(const Controller& Controller) const;
+        //焊接重合的点
+        void WeldPoints(Controller& Controller) const;
+        //设置加载与保存时是否焊接
+        void SetWelding(Controller& Controller) const;
+        //把编辑日志并入模型文件
+        void Checkpoint(Controller& Controller) const;
+        //有未保存的修改时确认是否退出
+        bool ConfirmExit(const Controller& Controller) const;
+        //有未保存的修改时确认是否替换当前模型
+        bool ConfirmReplace(const std::string& Path) const;
+        //用二次误差边折叠简化模型
+        void SimplifyModel(Controller& Controller) const;
+        //设置导出时是否按顶点缓存优化面的顺序
+        void OptimizeVertexCache(Controller& Controller) const;
+        //按Morton码重排模型的存储
+        void ReorderSpatially(Controller& Controller) const;
+        //显示各个连通部分的统计信息
+        void ListComponents(const Controller& Controller) const;
+        //分别保存各个连通部分
+        void ExportComponents(const Controller& Controller) const;
+        //求凸包并保存
+        void ExportConvexHull(const Controller& Controller) const;
+        //测评求凸包的耗时
+        void BenchmarkConvexHull(const Controller& Controller) const;
+        //求有向距离场并保存
+        void ExportDistanceField(const Controller& Controller) const;
+        //检测自相交
+        void FindSelfIntersections(const Controller& Controller) const;
+        //检测与另一个模型的相交
+        void FindIntersectionsWith(const Controller& Controller) const;
+        //从文件读入点并判断是否在模型内部
+        void ClassifyPoints(const Controller& Controller) const;
+        //求各条线穿过的面
+        void FindLineFaceHits(const Controller& Controller) const;
+        //Loop细分模型
+        void SubdivideModel(Controller& Controller) const;
+        //Taubin光顺模型
+        void SmoothModel(Controller& Controller) const;
+        //分析面的质量
+        void AnalyzeQuality(const Controller& Controller) const;
+        //平移模型
+        void TranslateModel(Controller& Controller) const;
+        //绕坐标轴旋转模型
+        void RotateModel(Controller& Controller) const;
+        //沿坐标轴缩放模型
+        void ScaleModel(Controller& Controller) const;
+        //施加一般的仿射矩阵
+        void TransformModel(Controller& Controller) const;
+        //显示仿射变换的结果
+        void ShowTransformResult(Controller::Result Result,
+            const TransformReport& Report) const;
+        //求测地最短路径并加入模型
+        void FindGeodesicPath(Controller& Controller) const;
+        //求测地距离场
+        void GeodesicDistances(const Controller& Controller) const;
+        //显示质量属性与有向包围盒
+        void ShowShapeProperties(const Controller& Controller) const;
 };
 
 